@@ -5,6 +5,8 @@
 #include "dataproxy.h"
 #include "gameutils.h"
 
+#include <algorithm>
+
 DataEntryPresenter::DataEntryPresenter(QObject *parent)
     : QObject(parent)
     , m_pDataEntryFacade{nullptr}
@@ -192,6 +194,10 @@ void DataEntryPresenter::_onStatusChanged()
         _updateStatusMessage(DataEntryStrings::Messages::c_DataEntryRequestMessage, Timing::c_ShortStatusUpdateDelay);
         Q_EMIT dataSavingInProgressChanged();
         break;
+    case DataEntryFacade::StatusCodes::DATA_SAVING_ERROR:
+        _updateStatusMessage(_getSavingErrorMessage(), Timing::c_NoDelay);
+        Q_EMIT dataSavingInProgressChanged();
+        break;
     case DataEntryFacade::StatusCodes::FETCHING_DATA:
         _updateStatusMessage(DataEntryStrings::Messages::c_FetchingDataMessage, Timing::c_NoDelay);
         break;
@@ -224,6 +230,36 @@ void DataEntryPresenter::_updateStatusMessage(const QString &message, int delay)
     }
 }
 
+QString DataEntryPresenter::_getSavingErrorMessage() const
+{
+    QString savingErrorMessage{DataEntryStrings::Messages::c_DataSavingErrorMessage};
+    const QVector<DataSource::DataEntry>& c_FailedSaveEntries{m_pDataEntryFacade->getFailedSaveEntries()};
+
+    // the pairs are only known if they have been rejected individually by database (e.g. not if the database could not be opened)
+    if (c_FailedSaveEntries.size() > 0)
+    {
+        // only the first few pairs are shown, a large batch would not fit into the status message
+        constexpr int c_MaxNrOfShownFailedPairs{3};
+        const int c_NrOfFailedPairs{static_cast<int>(c_FailedSaveEntries.size())};
+        const int c_NrOfShownFailedPairs{std::min(c_MaxNrOfShownFailedPairs, c_NrOfFailedPairs)};
+        QStringList failedPairs;
+
+        for (int entryIndex{0}; entryIndex < c_NrOfShownFailedPairs; ++entryIndex)
+        {
+            failedPairs.append(c_FailedSaveEntries[entryIndex].firstWord + " - " + c_FailedSaveEntries[entryIndex].secondWord);
+        }
+
+        if (c_NrOfFailedPairs > c_NrOfShownFailedPairs)
+        {
+            failedPairs.append(DataEntryStrings::Messages::c_MoreFailedPairsMessage.arg(c_NrOfFailedPairs - c_NrOfShownFailedPairs));
+        }
+
+        savingErrorMessage = DataEntryStrings::Messages::c_DataSavingFailedPairsMessage.arg(failedPairs.join(", "));
+    }
+
+    return savingErrorMessage;
+}
+
 void DataEntryPresenter::_updateMessage()
 {
     m_DataEntryPaneStatusMessage = m_CurrentStatusMessage;
@@ -63,6 +63,7 @@ private slots:
 private:
     void _updateStatusMessage(const QString& message, int delay);
     void _updateMessage();
+    QString _getSavingErrorMessage() const;
 
     DataEntryFacade* m_pDataEntryFacade;
     DataProxy* m_pDataProxy;
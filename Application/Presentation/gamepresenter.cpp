@@ -3,13 +3,15 @@
 
 #include "gamepresenter.h"
 #include "dataentrypresenter.h"
+#include "mixedwordspiecesmodel.h"
+#include "wordinputpiecesmodel.h"
 #include "gamestrings.h"
 #include "dataentrystrings.h"
-#include "gamecolors.h"
 #include "timing.h"
 #include "gamefacade.h"
 #include "exceptions.h"
 #include "gameproxy.h"
+#include "tracer.h"
 
 const QMap<GamePresenter::Panes, QString> GamePresenter::sc_WindowTitles
 {
@@ -22,13 +24,6 @@ const QMap<GamePresenter::Panes, QString> GamePresenter::sc_WindowTitles
     {GamePresenter::Panes::ERROR_PANE, GameStrings::Titles::c_FatalErrorWindowTitle}
 };
 
-const QMap<Game::PieceTypes, QColor> GamePresenter::sc_WordPieceTextColors
-{
-    {Game::PieceTypes::BEGIN_PIECE, Colors::c_BeginPieceTextColor},
-    {Game::PieceTypes::MIDDLE_PIECE, Colors::c_MiddlePieceTextColor},
-    {Game::PieceTypes::END_PIECE, Colors::c_EndPieceTextColor}
-};
-
 static_assert (static_cast<int>(GamePresenter::Levels::LEVEL_EASY) == static_cast<int>(Game::Levels::LEVEL_EASY) &&
                static_cast<int>(GamePresenter::Levels::LEVEL_MEDIUM) == static_cast<int>(Game::Levels::LEVEL_MEDIUM) &&
                static_cast<int>(GamePresenter::Levels::LEVEL_HARD) == static_cast<int>(Game::Levels::LEVEL_HARD) &&
@@ -52,24 +47,27 @@ GamePresenter::GamePresenter(QObject* parent)
     , m_pGameFacade{nullptr}
     , m_pGameProxy {new GameProxy{this}}
     , m_pStatusUpdateTimer {new QTimer{this}}
+    , m_pMixedWordsPiecesModel{nullptr}
+    , m_pFirstWordInputPiecesModel{nullptr}
+    , m_pSecondWordInputPiecesModel{nullptr}
 {
     m_pGameFacade = m_pGameProxy->getGameFacade();
     Q_ASSERT(m_pGameFacade);
 
+    m_pMixedWordsPiecesModel = new MixedWordsPiecesModel{m_pGameFacade, this};
+    m_pFirstWordInputPiecesModel = new WordInputPiecesModel{m_pGameFacade, Game::InputWordNumber::ONE, this};
+    m_pSecondWordInputPiecesModel = new WordInputPiecesModel{m_pGameFacade, Game::InputWordNumber::TWO, this};
+
     m_pStatusUpdateTimer->setSingleShot(true);
 
     auto connected{connect(m_pGameFacade, &GameFacade::statisticsChanged, this, &GamePresenter::_onStatisticsChanged)};
     Q_ASSERT(connected);
     connected = connect(m_pGameFacade, &GameFacade::statusChanged, this, &GamePresenter::_onStatusChanged);
     Q_ASSERT(connected);
-    connected = connect(m_pGameFacade, &GameFacade::newMixedWordsAvailable, this, &GamePresenter::mixedWordsChanged);
-    Q_ASSERT(connected);
     connected = connect(m_pGameFacade, &GameFacade::dataAvailableChanged, this, &GamePresenter::playEnabledChanged);
     Q_ASSERT(connected);
     connected = connect(m_pGameFacade, &GameFacade::inputChanged, this, &GamePresenter::_onInputChanged);
     Q_ASSERT(connected);
-    connected = connect(m_pGameFacade, &GameFacade::piecesAddedToInputChanged, this, &GamePresenter::selectionChanged);
-    Q_ASSERT(connected);
     connected = connect(m_pGameFacade, &GameFacade::completionChanged, this, &GamePresenter::submitMainPaneInputEnabledChanged);
     Q_ASSERT(connected);
     connected = connect(m_pGameFacade, &GameFacade::languageChanged, this, &GamePresenter::languageChanged);
@@ -368,67 +366,19 @@ void GamePresenter::setQuitGameDeferred(bool deferred)
     }
 }
 
-QList<QVariant> GamePresenter::getMixedWordsPiecesContent() const
+QObject* GamePresenter::getMixedWordsPiecesModel() const
 {
-    const QVector<QString> c_MixedWordsPiecesContent{m_pGameFacade->getMixedWordsPiecesContent()};
-    QList<QVariant> mixedWordsPiecesContent;
-
-    for (const auto& pieceContent : c_MixedWordsPiecesContent)
-    {
-        mixedWordsPiecesContent.append(pieceContent);
-    }
-
-    return mixedWordsPiecesContent;
+    return m_pMixedWordsPiecesModel;
 }
 
-QList<QVariant> GamePresenter::getMixedWordsPiecesTextColors() const
+QObject* GamePresenter::getFirstWordInputPiecesModel() const
 {
-    const QVector<Game::PieceTypes> c_MixedWordsPiecesTextColors{m_pGameFacade->getMixedWordsPiecesTypes()};
-    QList<QVariant> mixedWordsPiecesTextColors;
-
-    for (const auto& pieceType : c_MixedWordsPiecesTextColors)
-    {
-        mixedWordsPiecesTextColors.append(sc_WordPieceTextColors[pieceType]);
-    }
-
-    return mixedWordsPiecesTextColors;
-}
-
-QList<QVariant> GamePresenter::getMixedWordsPiecesSelections() const
-{
-    const QVector<bool> c_MixedWordsPiecesSelections{m_pGameFacade->getAreMixedWordsPiecesSelected()};
-    QList<QVariant> mixedWordsPiecesSelections;
-
-    for (const auto& isPieceSelected : c_MixedWordsPiecesSelections)
-    {
-        mixedWordsPiecesSelections.append(isPieceSelected);
-    }
-
-    return mixedWordsPiecesSelections;
-}
-
-QList<QVariant> GamePresenter::getFirstWordInputPiecesContent() const
-{
-    QList<QVariant> firstWordInputPiecesContent;
-
-    for (auto index : m_pGameFacade->getFirstWordInputIndexes())
-    {
-        firstWordInputPiecesContent.append(m_pGameFacade->getMixedWordsPiecesContent().at(index));
-    }
-
-    return firstWordInputPiecesContent;
+    return m_pFirstWordInputPiecesModel;
 }
 
-QList<QVariant> GamePresenter::getFirstWordInputPiecesTextColors() const
+QObject* GamePresenter::getSecondWordInputPiecesModel() const
 {
-    QList<QVariant> firstWordInputPiecesTextColors;
-
-    for (auto index : m_pGameFacade->getFirstWordInputIndexes())
-    {
-        firstWordInputPiecesTextColors.append(sc_WordPieceTextColors[m_pGameFacade->getMixedWordsPiecesTypes().at(index)]);
-    }
-
-    return firstWordInputPiecesTextColors;
+    return m_pSecondWordInputPiecesModel;
 }
 
 int GamePresenter::getFirstWordInputPiecesHoverIndex() const
@@ -441,30 +391,6 @@ bool GamePresenter::getAreFirstWordInputPiecesHovered() const
     return (m_FirstWordInputPiecesHoverIndex != -1);
 }
 
-QList<QVariant> GamePresenter::getSecondWordInputPiecesContent() const
-{
-    QList<QVariant> secondWordInputPiecesContent;
-
-    for (auto index : m_pGameFacade->getSecondWordInputIndexes())
-    {
-        secondWordInputPiecesContent.append(m_pGameFacade->getMixedWordsPiecesContent().at(index));
-    }
-
-    return secondWordInputPiecesContent;
-}
-
-QList<QVariant> GamePresenter::getSecondWordInputPiecesTextColors() const
-{
-    QList<QVariant> secondWordInputPiecesTextColors;
-
-    for (auto index : m_pGameFacade->getSecondWordInputIndexes())
-    {
-        secondWordInputPiecesTextColors.append(sc_WordPieceTextColors[m_pGameFacade->getMixedWordsPiecesTypes().at(index)]);
-    }
-
-    return secondWordInputPiecesTextColors;
-}
-
 bool GamePresenter::getAreSecondWordInputPiecesHovered() const
 {
     return (m_SecondWordInputPiecesHoverIndex != -1);
@@ -567,6 +493,8 @@ GamePresenter::~GamePresenter()
 
 void GamePresenter::_onInputChanged()
 {
+    TRACE_SCOPE("GamePresenter::_onInputChanged");
+
     clearWordInputHoverIndexes();
 
     if ((m_pGameFacade->getFirstWordInputIndexes().size() != 0 || m_pGameFacade->getSecondWordInputIndexes().size() != 0) && !m_ClearMainPaneInputEnabled)
@@ -579,12 +507,12 @@ void GamePresenter::_onInputChanged()
         m_ClearMainPaneInputEnabled = false;
         Q_EMIT clearMainPaneInputEnabledChanged();
     }
-
-    Q_EMIT inputChanged();
 }
 
 void GamePresenter::_onStatisticsChanged()
 {
+    TRACE_SCOPE("GamePresenter::_onStatisticsChanged");
+
     bool canReset{m_pGameFacade->canResetGameStatistics()};
 
     if (!m_MainPaneStatisticsResetEnabled && canReset)
@@ -608,6 +536,8 @@ void GamePresenter::_onDataSaveInProgress()
 
 void GamePresenter::_onStatusChanged()
 {
+    TRACE_SCOPE("GamePresenter::_onStatusChanged");
+
     GameFacade::StatusCodes statusCode{m_pGameFacade->getStatusCode()};
 
     // once main pane is accessed exclude handling the status codes that are only applicable for the intro pane (from status message display point of view) ...
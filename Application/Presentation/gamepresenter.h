@@ -2,9 +2,8 @@
 #define GAMEPRESENTER_H
 
 #include <QObject>
-#include <QVariant>
+#include <QMap>
 #include <QVector>
-#include <QColor>
 #include <QTimer>
 
 #include "gameutils.h"
@@ -13,6 +12,8 @@ class GameFacade;
 class GameProxy;
 
 class DataEntryPresenter;
+class MixedWordsPiecesModel;
+class WordInputPiecesModel;
 
 class GamePresenter : public QObject
 {
@@ -32,17 +33,13 @@ class GamePresenter : public QObject
     Q_PROPERTY(bool timeLimitEnabled READ isTimeLimitEnabled NOTIFY timeLimitEnabledChanged)
 
     /* game and user input properties */
-    Q_PROPERTY(QList<QVariant> mixedWordsPiecesContent READ getMixedWordsPiecesContent NOTIFY mixedWordsChanged)
-    Q_PROPERTY(QList<QVariant> mixedWordsPiecesTextColors READ getMixedWordsPiecesTextColors NOTIFY mixedWordsChanged)
-    Q_PROPERTY(QList<QVariant> mixedWordsPiecesSelections READ getMixedWordsPiecesSelections NOTIFY selectionChanged)
-    Q_PROPERTY(QList<QVariant> firstWordInputPiecesContent READ getFirstWordInputPiecesContent NOTIFY inputChanged)
-    Q_PROPERTY(QList<QVariant> firstWordInputPiecesTextColors READ getFirstWordInputPiecesTextColors NOTIFY inputChanged)
+    Q_PROPERTY(QObject* mixedWordsPiecesModel READ getMixedWordsPiecesModel CONSTANT)
+    Q_PROPERTY(QObject* firstWordInputPiecesModel READ getFirstWordInputPiecesModel CONSTANT)
+    Q_PROPERTY(QObject* secondWordInputPiecesModel READ getSecondWordInputPiecesModel CONSTANT)
     Q_PROPERTY(int languageIndex READ getLanguageIndex NOTIFY languageChanged)
     Q_PROPERTY(QStringList remainingTimeMinSec READ getRemainingTime NOTIFY remainingTimeChanged)
     Q_PROPERTY(bool areFirstWordInputPiecesHovered READ getAreFirstWordInputPiecesHovered NOTIFY hoverChanged)
     Q_PROPERTY(int firstWordInputPiecesHoverIndex READ getFirstWordInputPiecesHoverIndex NOTIFY hoverChanged)
-    Q_PROPERTY(QList<QVariant> secondWordInputPiecesContent READ getSecondWordInputPiecesContent NOTIFY inputChanged)
-    Q_PROPERTY(QList<QVariant> secondWordInputPiecesTextColors READ getSecondWordInputPiecesTextColors NOTIFY inputChanged)
     Q_PROPERTY(bool areSecondWordInputPiecesHovered READ getAreSecondWordInputPiecesHovered NOTIFY hoverChanged)
     Q_PROPERTY(int secondWordInputPiecesHoverIndex READ getSecondWordInputPiecesHoverIndex NOTIFY hoverChanged)
     Q_PROPERTY(int pieceSelectionCursorPosition READ getPieceSelectionCursorPosition NOTIFY pieceSelectionCursorPositionChanged)
@@ -141,15 +138,11 @@ public:
 
     void setQuitGameDeferred(bool deferred);
 
-    QList<QVariant> getMixedWordsPiecesContent() const;
-    QList<QVariant> getMixedWordsPiecesTextColors() const;
-    QList<QVariant> getMixedWordsPiecesSelections() const;
-    QList<QVariant> getFirstWordInputPiecesContent() const;
-    QList<QVariant> getFirstWordInputPiecesTextColors() const;
+    QObject* getMixedWordsPiecesModel() const;
+    QObject* getFirstWordInputPiecesModel() const;
+    QObject* getSecondWordInputPiecesModel() const;
     bool getAreFirstWordInputPiecesHovered() const;
     int getFirstWordInputPiecesHoverIndex() const;
-    QList<QVariant> getSecondWordInputPiecesContent() const;
-    QList<QVariant> getSecondWordInputPiecesTextColors() const;
     bool getAreSecondWordInputPiecesHovered() const;
     int getSecondWordInputPiecesHoverIndex() const;
     int getPieceSelectionCursorPosition() const;
@@ -188,9 +181,6 @@ signals:
     Q_SIGNAL void submitMainPaneInputEnabledChanged();
     Q_SIGNAL void errorOccuredChanged();
     Q_SIGNAL void quitGameDeferredChanged();
-    Q_SIGNAL void mixedWordsChanged();
-    Q_SIGNAL void inputChanged();
-    Q_SIGNAL void selectionChanged();
     Q_SIGNAL void introPaneMessageChanged();
     Q_SIGNAL void helpPaneContentChanged();
     Q_SIGNAL void mainPaneStatusMessageChanged();
@@ -216,7 +206,6 @@ private:
     void _launchErrorPane(const QString& errorMessage);
 
     static const QMap<GamePresenter::Panes, QString> sc_WindowTitles;
-    static const QMap<Game::PieceTypes, QColor> sc_WordPieceTextColors;
 
     static constexpr int sc_PaneSwitchingDelay{350};
     static constexpr int sc_GameQuitDelay{200};
@@ -248,6 +237,10 @@ private:
     GameProxy* m_pGameProxy;
 
     QTimer* m_pStatusUpdateTimer;
+
+    MixedWordsPiecesModel* m_pMixedWordsPiecesModel;
+    WordInputPiecesModel* m_pFirstWordInputPiecesModel;
+    WordInputPiecesModel* m_pSecondWordInputPiecesModel;
 };
 
 #endif // GAMEPRESENTER_H
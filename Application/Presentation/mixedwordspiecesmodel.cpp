@@ -0,0 +1,110 @@
+#include "mixedwordspiecesmodel.h"
+#include "gamecolors.h"
+#include "gamefacade.h"
+#include "tracer.h"
+
+const QMap<Game::PieceTypes, QColor> MixedWordsPiecesModel::sc_WordPieceTextColors
+{
+    {Game::PieceTypes::BEGIN_PIECE, Colors::c_BeginPieceTextColor},
+    {Game::PieceTypes::MIDDLE_PIECE, Colors::c_MiddlePieceTextColor},
+    {Game::PieceTypes::END_PIECE, Colors::c_EndPieceTextColor}
+};
+
+MixedWordsPiecesModel::MixedWordsPiecesModel(GameFacade* pGameFacade, QObject *parent)
+    : QAbstractListModel(parent)
+    , m_pGameFacade{pGameFacade}
+{
+    Q_ASSERT(m_pGameFacade);
+
+    auto connected{connect(m_pGameFacade, &GameFacade::newMixedWordsAvailable, this, &MixedWordsPiecesModel::_onNewMixedWordsAvailable)};
+    Q_ASSERT(connected);
+    connected = connect(m_pGameFacade, &GameFacade::piecesAddedToInputChanged, this, &MixedWordsPiecesModel::_onPiecesAddedToInputChanged);
+    Q_ASSERT(connected);
+}
+
+int MixedWordsPiecesModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : m_MixedWordsPiecesContent.size();
+}
+
+QVariant MixedWordsPiecesModel::data(const QModelIndex& index, int role) const
+{
+    QVariant result;
+
+    if (index.isValid() && index.row() < m_MixedWordsPiecesContent.size())
+    {
+        const int row{index.row()};
+
+        switch (role)
+        {
+        case Qt::DisplayRole:
+        case PieceContentRole:
+            result = m_MixedWordsPiecesContent[row];
+            break;
+        case PieceTextColorRole:
+            result = getPieceTextColor(m_MixedWordsPiecesTypes[row]);
+            break;
+        case PieceSelectedRole:
+            result = m_AreMixedWordsPiecesSelected[row];
+            break;
+        default:
+            break;
+        }
+    }
+
+    return result;
+}
+
+QHash<int, QByteArray> MixedWordsPiecesModel::roleNames() const
+{
+    return QHash<int, QByteArray>
+    {
+        {PieceContentRole, "pieceContent"},
+        {PieceTextColorRole, "pieceTextColor"},
+        {PieceSelectedRole, "pieceSelected"}
+    };
+}
+
+QColor MixedWordsPiecesModel::getPieceTextColor(Game::PieceTypes pieceType)
+{
+    return sc_WordPieceTextColors[pieceType];
+}
+
+void MixedWordsPiecesModel::_onNewMixedWordsAvailable()
+{
+    TRACE_SCOPE("MixedWordsPiecesModel::_onNewMixedWordsAvailable");
+
+    beginResetModel();
+    m_MixedWordsPiecesContent = m_pGameFacade->getMixedWordsPiecesContent();
+    m_MixedWordsPiecesTypes = m_pGameFacade->getMixedWordsPiecesTypes();
+    m_AreMixedWordsPiecesSelected = m_pGameFacade->getAreMixedWordsPiecesSelected();
+    endResetModel();
+}
+
+void MixedWordsPiecesModel::_onPiecesAddedToInputChanged()
+{
+    TRACE_SCOPE("MixedWordsPiecesModel::_onPiecesAddedToInputChanged");
+
+    const QVector<bool>& areMixedWordsPiecesSelected{m_pGameFacade->getAreMixedWordsPiecesSelected()};
+
+    // a different number of pieces means a new pair is being setup, the reset will follow
+    if (areMixedWordsPiecesSelected.size() == m_AreMixedWordsPiecesSelected.size())
+    {
+        QVector<int> changedRows;
+
+        for (int row{0}; row < m_AreMixedWordsPiecesSelected.size(); ++row)
+        {
+            if (m_AreMixedWordsPiecesSelected[row] != areMixedWordsPiecesSelected[row])
+            {
+                changedRows.append(row);
+            }
+        }
+
+        m_AreMixedWordsPiecesSelected = areMixedWordsPiecesSelected;
+
+        for (auto row : changedRows)
+        {
+            Q_EMIT dataChanged(index(row), index(row), QVector<int>{PieceSelectedRole});
+        }
+    }
+}
@@ -0,0 +1,53 @@
+/*
+   List model exposing the mixed words pieces to QML (one row per piece):
+   1) The rows are reset each time a new words pair is mixed.
+   2) When pieces are added to or removed from input only the rows whose selection state changed are notified.
+*/
+
+#ifndef MIXEDWORDSPIECESMODEL_H
+#define MIXEDWORDSPIECESMODEL_H
+
+#include <QAbstractListModel>
+#include <QVector>
+#include <QColor>
+#include <QMap>
+
+#include "gameutils.h"
+
+class GameFacade;
+
+class MixedWordsPiecesModel : public QAbstractListModel
+{
+    Q_OBJECT
+public:
+    enum Roles
+    {
+        PieceContentRole = Qt::UserRole + 1,
+        PieceTextColorRole,
+        PieceSelectedRole
+    };
+
+    explicit MixedWordsPiecesModel(GameFacade* pGameFacade, QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex{}) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    static QColor getPieceTextColor(Game::PieceTypes pieceType);
+
+private slots:
+    void _onNewMixedWordsAvailable();
+    void _onPiecesAddedToInputChanged();
+
+private:
+    static const QMap<Game::PieceTypes, QColor> sc_WordPieceTextColors;
+
+    GameFacade* m_pGameFacade;
+
+    // shallow copies of the facade data, kept so the rows stay consistent with the notifications sent to the view
+    QVector<QString> m_MixedWordsPiecesContent;
+    QVector<Game::PieceTypes> m_MixedWordsPiecesTypes;
+    QVector<bool> m_AreMixedWordsPiecesSelected;
+};
+
+#endif // MIXEDWORDSPIECESMODEL_H
@@ -0,0 +1,99 @@
+#include "wordinputpiecesmodel.h"
+#include "mixedwordspiecesmodel.h"
+#include "gamefacade.h"
+#include "tracer.h"
+
+WordInputPiecesModel::WordInputPiecesModel(GameFacade* pGameFacade, Game::InputWordNumber inputWordNumber, QObject *parent)
+    : QAbstractListModel(parent)
+    , m_pGameFacade{pGameFacade}
+    , m_InputWordNumber{inputWordNumber}
+{
+    Q_ASSERT(m_pGameFacade);
+
+    auto connected{connect(m_pGameFacade, &GameFacade::newMixedWordsAvailable, this, &WordInputPiecesModel::_onNewMixedWordsAvailable)};
+    Q_ASSERT(connected);
+    connected = connect(m_pGameFacade, &GameFacade::inputChanged, this, &WordInputPiecesModel::_onInputChanged);
+    Q_ASSERT(connected);
+}
+
+int WordInputPiecesModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : m_InputIndexes.size();
+}
+
+QVariant WordInputPiecesModel::data(const QModelIndex& index, int role) const
+{
+    QVariant result;
+
+    if (index.isValid() && index.row() < m_InputIndexes.size())
+    {
+        const int pieceIndex{m_InputIndexes[index.row()]};
+
+        switch (role)
+        {
+        case Qt::DisplayRole:
+        case PieceContentRole:
+            result = m_pGameFacade->getMixedWordsPiecesContent().at(pieceIndex);
+            break;
+        case PieceTextColorRole:
+            result = MixedWordsPiecesModel::getPieceTextColor(m_pGameFacade->getMixedWordsPiecesTypes().at(pieceIndex));
+            break;
+        default:
+            break;
+        }
+    }
+
+    return result;
+}
+
+QHash<int, QByteArray> WordInputPiecesModel::roleNames() const
+{
+    return QHash<int, QByteArray>
+    {
+        {PieceContentRole, "pieceContent"},
+        {PieceTextColorRole, "pieceTextColor"}
+    };
+}
+
+void WordInputPiecesModel::_onNewMixedWordsAvailable()
+{
+    TRACE_SCOPE("WordInputPiecesModel::_onNewMixedWordsAvailable");
+
+    beginResetModel();
+    m_InputIndexes = _getInputIndexes();
+    endResetModel();
+}
+
+void WordInputPiecesModel::_onInputChanged()
+{
+    TRACE_SCOPE("WordInputPiecesModel::_onInputChanged");
+
+    const QVector<int> inputIndexes{_getInputIndexes()};
+
+    // pieces are only appended to or removed from the end of the input word so the rows before the first difference stay untouched
+    int nrOfUnchangedRows{0};
+
+    while (nrOfUnchangedRows < m_InputIndexes.size() && nrOfUnchangedRows < inputIndexes.size() && m_InputIndexes[nrOfUnchangedRows] == inputIndexes[nrOfUnchangedRows])
+    {
+        ++nrOfUnchangedRows;
+    }
+
+    if (nrOfUnchangedRows < m_InputIndexes.size())
+    {
+        beginRemoveRows(QModelIndex{}, nrOfUnchangedRows, m_InputIndexes.size() - 1);
+        m_InputIndexes.resize(nrOfUnchangedRows);
+        endRemoveRows();
+    }
+
+    if (nrOfUnchangedRows < inputIndexes.size())
+    {
+        beginInsertRows(QModelIndex{}, nrOfUnchangedRows, inputIndexes.size() - 1);
+        m_InputIndexes = inputIndexes;
+        endInsertRows();
+    }
+}
+
+QVector<int> WordInputPiecesModel::_getInputIndexes() const
+{
+    return m_InputWordNumber == Game::InputWordNumber::ONE ? m_pGameFacade->getFirstWordInputIndexes() : m_pGameFacade->getSecondWordInputIndexes();
+}
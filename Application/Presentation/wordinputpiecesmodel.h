@@ -0,0 +1,48 @@
+/*
+   List model exposing the pieces added to one of the input words to QML (one row per input piece):
+   1) Adding a piece to input inserts a row at the end of the list.
+   2) Removing pieces from input removes the trailing rows starting with the first removed piece.
+   3) The rows are reset each time a new words pair is mixed.
+*/
+
+#ifndef WORDINPUTPIECESMODEL_H
+#define WORDINPUTPIECESMODEL_H
+
+#include <QAbstractListModel>
+#include <QVector>
+
+#include "gameutils.h"
+
+class GameFacade;
+
+class WordInputPiecesModel : public QAbstractListModel
+{
+    Q_OBJECT
+public:
+    enum Roles
+    {
+        PieceContentRole = Qt::UserRole + 1,
+        PieceTextColorRole
+    };
+
+    explicit WordInputPiecesModel(GameFacade* pGameFacade, Game::InputWordNumber inputWordNumber, QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex{}) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+private slots:
+    void _onNewMixedWordsAvailable();
+    void _onInputChanged();
+
+private:
+    QVector<int> _getInputIndexes() const;
+
+    GameFacade* m_pGameFacade;
+    Game::InputWordNumber m_InputWordNumber;
+
+    // indexes of the mixed words pieces added to input word, as last notified to the view
+    QVector<int> m_InputIndexes;
+};
+
+#endif // WORDINPUTPIECESMODEL_H
@@ -10,7 +10,7 @@ Repeater {
     property double pieceWidth
     property double pieceHeight
 
-    model: gamePresenter.mixedWordsPiecesContent
+    model: gamePresenter.mixedWordsPiecesModel
 
     property Timer cursorSelectedPieceTimer : Timer {
         interval: 100
@@ -20,7 +20,7 @@ Repeater {
         width: pieceWidth
         height: pieceHeight
 
-        visible: !gamePresenter.mixedWordsPiecesSelections[index] && !presenter.dataFetchingInProgress
+        visible: !model.pieceSelected && !presenter.dataFetchingInProgress
 
         color: Styles.mixedPiecesBackgroundColor
 
@@ -58,10 +58,10 @@ Repeater {
         }
 
         Text {
-            text: modelData
+            text: model.pieceContent
             font.pointSize: pieceHeight * 0.4
             anchors.centerIn: parent
-            color: gamePresenter.mixedWordsPiecesTextColors[index]
+            color: model.pieceTextColor
         }
 
         MouseArea {
@@ -83,7 +83,7 @@ Repeater {
         }
 
         ToolTip {
-            text: gamePresenter.mixedWordsPiecesSelections[index] ? GameStrings.wordPieceAlreadySelectedToolTip : GameStrings.selectWordPieceToolTip
+            text: model.pieceSelected ? GameStrings.wordPieceAlreadySelectedToolTip : GameStrings.selectWordPieceToolTip
             visible: !gamePresenter.persistentModeEnabled && mixedWordsCurrentPieceMouseArea.containsMouse
             delay: Animations.toolTipDelay
             timeout: Animations.toolTipTimeout
@@ -33,7 +33,7 @@ Repeater {
         }
     }
 
-    model: isFirstWord ? gamePresenter.firstWordInputPiecesContent : gamePresenter.secondWordInputPiecesContent
+    model: isFirstWord ? gamePresenter.firstWordInputPiecesModel : gamePresenter.secondWordInputPiecesModel
 
     property Timer clickRemovedPiecesTimer : Timer {
         interval: 100
@@ -83,8 +83,8 @@ Repeater {
         Text {
             font.pointSize: pieceHeight * 0.4
             anchors.centerIn: parent
-            text: modelData
-            color: isFirstWord ? gamePresenter.firstWordInputPiecesTextColors[index] : gamePresenter.secondWordInputPiecesTextColors[index]
+            text: model.pieceContent
+            color: model.pieceTextColor
         }
 
         MouseArea {
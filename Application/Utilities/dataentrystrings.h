@@ -96,6 +96,18 @@ namespace DataEntryStrings
         const QString c_DataSaveInProgressMessage           {    "Data is currently being saved..."                                                         };
         const QString c_DataSuccessfullySavedMessage        {    "%1 word pairs successfully saved to database, %2 pairs added to current game language"    };
 
+        const QString c_DataSavingErrorMessage              {
+                                                                 "The added pairs could not be saved to database.\n\n"
+                                                                 "Please save them again or discard them."
+                                                            };
+
+        const QString c_DataSavingFailedPairsMessage        {
+                                                                 "The following pairs could not be saved to database: %1\n\n"
+                                                                 "Please save them again or discard them."
+                                                            };
+
+        const QString c_MoreFailedPairsMessage              {    "and %1 more"                                                                              };
+
         // invalid pair entry reason messages
         const QString c_WordHasLessThanMinCharacters        {    "At least one word has less than minimum required number of characters."                   };
         const QString c_PairHasLessThanMinCharacters        {    "The entered word pair has less than the minimum required number of characters."           };
@@ -0,0 +1,536 @@
+#include <QtTest>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QTemporaryDir>
+#include <QStringView>
+
+#include <memory>
+
+#include "datasource.h"
+#include "datasourceloader.h"
+#include "datasourcesnapshot.h"
+#include "datasourceaccesshelper.h"
+#include "wordmixer.h"
+#include "wordpairowner.h"
+#include "inputbuilder.h"
+#include "gamemanager.h"
+#include "gamefacade.h"
+#include "databaseutils.h"
+#include "gameutils.h"
+
+/* Benchmarks for the backend components, driven by synthetic dictionaries (1k, 100k and 1M valid pairs):
+   - each dictionary is written to a temporary database as a separate language and is kept in memory for the components that don't read from database
+   - the components that don't depend on the dictionary size (mixer, pair owner, input builder) are run for each game level instead
+   - the GameFacade benchmark runs last as the game manager cannot be released and setup again within the same process
+   - use the run-benchmarks target (or the -o <file>,csv option) for getting machine-readable results
+*/
+
+class SystemFunctionalityBenchmarks : public QObject
+{
+    Q_OBJECT
+
+public:
+    SystemFunctionalityBenchmarks();
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void benchmarkDataSourceLoader_data();
+    void benchmarkDataSourceLoader();
+    void benchmarkDataSourceUpdate_data();
+    void benchmarkDataSourceUpdate();
+    void benchmarkDataSourceEntryAlreadyExists_data();
+    void benchmarkDataSourceEntryAlreadyExists();
+    void benchmarkGenerateEntryNumber_data();
+    void benchmarkGenerateEntryNumber();
+    void benchmarkMixWords_data();
+    void benchmarkMixWords();
+    void benchmarkWordPairOwner_data();
+    void benchmarkWordPairOwner();
+    void benchmarkInputBuilder_data();
+    void benchmarkInputBuilder();
+    void benchmarkHandleSubmitRequest_data();
+    void benchmarkHandleSubmitRequest();
+
+private:
+    void _addDictionarySizeColumns();
+    void _addGameLevelColumn();
+    void _writeDictionariesToDatabase();
+
+    static QString _getDictionarySizeRowName(int dictionarySize);
+    static QString _getSyntheticWord(QChar prefix, int wordNumber);
+    static QVector<int> _getWordPieceIndexes(const QString& word, const QVector<QString>& piecesContent, const QVector<Game::PieceTypes>& piecesTypes, QVector<bool>& arePiecesUsed);
+
+    static const QVector<int> sc_DictionarySizes;
+    static constexpr int sc_SyntheticWordSuffixSize{7};
+
+    QTemporaryDir m_DatabaseDir;
+    QString m_DatabasePath;
+    QVector<QVector<DataSource::DataEntry>> m_Dictionaries; // same order as sc_DictionarySizes, the dictionary index is also the language index used in database
+};
+
+// language codes are taken in the same order from Database::Query::c_LanguageCodes (one language per dictionary)
+const QVector<int> SystemFunctionalityBenchmarks::sc_DictionarySizes{1000, 100000, 1000000};
+
+SystemFunctionalityBenchmarks::SystemFunctionalityBenchmarks()
+{
+}
+
+void SystemFunctionalityBenchmarks::initTestCase()
+{
+    QVERIFY2(m_DatabaseDir.isValid(), "The temporary database directory could not be created!");
+    QVERIFY2(sc_DictionarySizes.size() <= Database::Query::c_LanguageCodes.size(), "Not enough languages for storing the synthetic dictionaries!");
+
+    m_DatabasePath = m_DatabaseDir.path() + "/" + Database::Query::c_DatabaseName;
+
+    for (auto dictionarySize : sc_DictionarySizes)
+    {
+        QVector<DataSource::DataEntry> dictionary;
+        dictionary.reserve(dictionarySize);
+
+        for (int entryNumber{0}; entryNumber < dictionarySize; ++entryNumber)
+        {
+            dictionary.append(DataSource::DataEntry{_getSyntheticWord('f', entryNumber), _getSyntheticWord('s', entryNumber), entryNumber % 2 == 0});
+        }
+
+        m_Dictionaries.append(dictionary);
+    }
+
+    _writeDictionariesToDatabase();
+}
+
+void SystemFunctionalityBenchmarks::cleanupTestCase()
+{
+    GameManager::getManager()->releaseResources();
+}
+
+void SystemFunctionalityBenchmarks::benchmarkDataSourceLoader_data()
+{
+    QTest::addColumn<int>("dictionarySize");
+    QTest::addColumn<int>("languageIndex");
+    QTest::addColumn<bool>("fromSnapshot");
+
+    for (int languageIndex{0}; languageIndex < sc_DictionarySizes.size(); ++languageIndex)
+    {
+        const int c_DictionarySize{sc_DictionarySizes.at(languageIndex)};
+
+        QTest::newRow((_getDictionarySizeRowName(c_DictionarySize) + " database").toLatin1().constData()) << c_DictionarySize << languageIndex << false;
+        QTest::newRow((_getDictionarySizeRowName(c_DictionarySize) + " snapshot").toLatin1().constData()) << c_DictionarySize << languageIndex << true;
+    }
+}
+
+void SystemFunctionalityBenchmarks::benchmarkDataSourceLoader()
+{
+    QFETCH(int, dictionarySize);
+    QFETCH(int, languageIndex);
+    QFETCH(bool, fromSnapshot);
+
+    bool success{true};
+    const QString c_SnapshotPath{DataSourceSnapshot::getFilePath(m_DatabasePath, languageIndex)};
+
+    // the first load from database (re)creates the snapshot
+    if (fromSnapshot && !QFile::exists(c_SnapshotPath))
+    {
+        DataSource dataSource;
+        DataSourceLoader dataSourceLoader{&dataSource, m_DatabasePath};
+
+        dataSourceLoader.onLoadDataFromDbForPrimaryLanguageRequested(0, languageIndex, false);
+    }
+
+    // a new data source is required for each load, otherwise the loader detects the language is already contained and skips loading
+    QBENCHMARK
+    {
+        // removing the snapshot forces the loader to read and validate the entries from database (the snapshot writing time is included)
+        if (!fromSnapshot)
+        {
+            QFile::remove(c_SnapshotPath);
+        }
+
+        std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+        std::unique_ptr<DataSourceLoader> pDataSourceLoader{new DataSourceLoader{pDataSource.get(), m_DatabasePath}};
+
+        pDataSourceLoader->onLoadDataFromDbForPrimaryLanguageRequested(0, languageIndex, false);
+        success = success && pDataSource->getPrimarySourceNrOfEntries() == dictionarySize;
+    }
+
+    QVERIFY2(success, "Incorrect number of entries loaded from database!");
+}
+
+void SystemFunctionalityBenchmarks::benchmarkDataSourceUpdate_data()
+{
+    _addDictionarySizeColumns();
+}
+
+void SystemFunctionalityBenchmarks::benchmarkDataSourceUpdate()
+{
+    QFETCH(int, dictionarySize);
+    QFETCH(int, languageIndex);
+
+    const QVector<DataSource::DataEntry>& c_Dictionary{m_Dictionaries.at(languageIndex)};
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+
+    QBENCHMARK
+    {
+        pDataSource->updateDataEntries(c_Dictionary, languageIndex, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+    }
+
+    QVERIFY2(pDataSource->getPrimarySourceNrOfEntries() == dictionarySize, "Incorrect number of entries in data source!");
+}
+
+void SystemFunctionalityBenchmarks::benchmarkDataSourceEntryAlreadyExists_data()
+{
+    _addDictionarySizeColumns();
+}
+
+void SystemFunctionalityBenchmarks::benchmarkDataSourceEntryAlreadyExists()
+{
+    QFETCH(int, dictionarySize);
+    QFETCH(int, languageIndex);
+
+    const QVector<DataSource::DataEntry>& c_Dictionary{m_Dictionaries.at(languageIndex)};
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+
+    pDataSource->updateDataEntries(c_Dictionary, languageIndex, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+
+    // both the existing and the missing entries are checked, words are swapped for the existing ones (same pair)
+    const DataSource::DataEntry c_ExistingEntry{c_Dictionary.at(dictionarySize / 2).secondWord, c_Dictionary.at(dictionarySize / 2).firstWord, true};
+    const DataSource::DataEntry c_MissingEntry{_getSyntheticWord('f', dictionarySize), _getSyntheticWord('s', dictionarySize), true};
+
+    bool success{true};
+
+    QBENCHMARK
+    {
+        success = success && pDataSource->entryAlreadyExists(c_ExistingEntry, languageIndex) && !pDataSource->entryAlreadyExists(c_MissingEntry, languageIndex);
+    }
+
+    QVERIFY2(success, "Incorrect result when checking the existence of the entries!");
+}
+
+void SystemFunctionalityBenchmarks::benchmarkGenerateEntryNumber_data()
+{
+    _addDictionarySizeColumns();
+}
+
+void SystemFunctionalityBenchmarks::benchmarkGenerateEntryNumber()
+{
+    QFETCH(int, dictionarySize);
+
+    std::unique_ptr<DataSourceAccessHelper> pDataSourceAccessHelper{new DataSourceAccessHelper{}};
+    pDataSourceAccessHelper->setEntriesTable(dictionarySize);
+
+    int entryNumber{-1};
+
+    QBENCHMARK
+    {
+        entryNumber = pDataSourceAccessHelper->generateEntryNumber();
+    }
+
+    QVERIFY2(entryNumber >= 0 && entryNumber < dictionarySize, "Invalid entry number generated!");
+}
+
+void SystemFunctionalityBenchmarks::benchmarkMixWords_data()
+{
+    _addGameLevelColumn();
+}
+
+void SystemFunctionalityBenchmarks::benchmarkMixWords()
+{
+    QFETCH(Game::Levels, level);
+
+    const QVector<DataSource::DataEntry>& c_Dictionary{m_Dictionaries.first()};
+    std::unique_ptr<WordMixer> pWordMixer{new WordMixer{}};
+
+    pWordMixer->setGameLevel(level);
+
+    int entryNumber{0};
+
+    QBENCHMARK
+    {
+        const DataSource::DataEntry& c_DataEntry{c_Dictionary.at(entryNumber)};
+        pWordMixer->mixWords(QPair<QString, QString>{c_DataEntry.firstWord, c_DataEntry.secondWord}, c_DataEntry.areSynonyms);
+        entryNumber = (entryNumber + 1) % static_cast<int>(c_Dictionary.size());
+    }
+
+    QVERIFY2(!pWordMixer->getMixedWordsPiecesContent().isEmpty(), "No words have been mixed!");
+}
+
+void SystemFunctionalityBenchmarks::benchmarkWordPairOwner_data()
+{
+    _addGameLevelColumn();
+}
+
+void SystemFunctionalityBenchmarks::benchmarkWordPairOwner()
+{
+    QFETCH(Game::Levels, level);
+
+    const DataSource::DataEntry& c_DataEntry{m_Dictionaries.first().first()};
+    std::unique_ptr<WordMixer> pWordMixer{new WordMixer{}};
+    std::unique_ptr<WordPairOwner> pWordPairOwner{new WordPairOwner{}};
+
+    pWordMixer->setGameLevel(level);
+    pWordMixer->mixWords(QPair<QString, QString>{c_DataEntry.firstWord, c_DataEntry.secondWord}, c_DataEntry.areSynonyms);
+
+    const WordMixer::MixedWordsPair c_MixedWordsPair{pWordMixer->getMixedWordsPair()};
+    QVector<int> allPiecesIndexes;
+
+    for (int pieceIndex{0}; pieceIndex < c_MixedWordsPair.piecesContent.size(); ++pieceIndex)
+    {
+        allPiecesIndexes.append(pieceIndex);
+    }
+
+    // a full round: new pair setup, all pieces added to input one by one, then all removed at once
+    QBENCHMARK
+    {
+        pWordPairOwner->setNewWordsPair(c_MixedWordsPair.piecesContent, c_MixedWordsPair.firstWord, c_MixedWordsPair.secondWord, c_MixedWordsPair.areSynonyms,
+                                        c_MixedWordsPair.firstWordFirstPieceIndex, c_MixedWordsPair.firstWordLastPieceIndex,
+                                        c_MixedWordsPair.secondWordFirstPieceIndex, c_MixedWordsPair.secondWordLastPieceIndex);
+
+        for (auto pieceIndex : allPiecesIndexes)
+        {
+            pWordPairOwner->markPieceAsAddedToInput(pieceIndex);
+        }
+
+        pWordPairOwner->markPiecesAsRemovedFromInput(allPiecesIndexes);
+    }
+
+    QVERIFY2(!pWordPairOwner->getAreMixedWordsPiecesAddedToInput().contains(true), "Pieces still marked as added to input!");
+}
+
+void SystemFunctionalityBenchmarks::benchmarkInputBuilder_data()
+{
+    _addGameLevelColumn();
+}
+
+void SystemFunctionalityBenchmarks::benchmarkInputBuilder()
+{
+    QFETCH(Game::Levels, level);
+
+    const DataSource::DataEntry& c_DataEntry{m_Dictionaries.first().first()};
+    std::unique_ptr<WordMixer> pWordMixer{new WordMixer{}};
+    std::unique_ptr<WordPairOwner> pWordPairOwner{new WordPairOwner{}};
+    std::unique_ptr<InputBuilder> pInputBuilder{new InputBuilder{}};
+
+    pWordMixer->setGameLevel(level);
+    pWordMixer->mixWords(QPair<QString, QString>{c_DataEntry.firstWord, c_DataEntry.secondWord}, c_DataEntry.areSynonyms);
+
+    const WordMixer::MixedWordsPair c_MixedWordsPair{pWordMixer->getMixedWordsPair()};
+
+    pWordPairOwner->setNewWordsPair(c_MixedWordsPair.piecesContent, c_MixedWordsPair.firstWord, c_MixedWordsPair.secondWord, c_MixedWordsPair.areSynonyms,
+                                    c_MixedWordsPair.firstWordFirstPieceIndex, c_MixedWordsPair.firstWordLastPieceIndex,
+                                    c_MixedWordsPair.secondWordFirstPieceIndex, c_MixedWordsPair.secondWordLastPieceIndex);
+
+    const QVector<Game::PieceTypes>& c_PiecesTypes{pWordPairOwner->getMixedWordsPiecesTypes()};
+    QVector<bool> arePiecesUsed(c_MixedWordsPair.piecesContent.size(), false);
+
+    const QVector<int> c_FirstWordPieceIndexes{_getWordPieceIndexes(c_MixedWordsPair.firstWord, c_MixedWordsPair.piecesContent, c_PiecesTypes, arePiecesUsed)};
+    const QVector<int> c_SecondWordPieceIndexes{_getWordPieceIndexes(c_MixedWordsPair.secondWord, c_MixedWordsPair.piecesContent, c_PiecesTypes, arePiecesUsed)};
+    const int c_TotalNrOfPieces{static_cast<int>(c_FirstWordPieceIndexes.size() + c_SecondWordPieceIndexes.size())};
+
+    bool isInputComplete{true};
+
+    // closing the input is only allowed for the last piece (normally granted by facade)
+    QBENCHMARK
+    {
+        int nrOfAddedPieces{0};
+
+        for (auto pieceIndex : c_FirstWordPieceIndexes)
+        {
+            pInputBuilder->setCloseInputAllowed(++nrOfAddedPieces == c_TotalNrOfPieces);
+            Q_UNUSED(pInputBuilder->addPieceToInputWord(Game::InputWordNumber::ONE, pieceIndex, c_PiecesTypes.at(pieceIndex)));
+        }
+
+        for (auto pieceIndex : c_SecondWordPieceIndexes)
+        {
+            pInputBuilder->setCloseInputAllowed(++nrOfAddedPieces == c_TotalNrOfPieces);
+            Q_UNUSED(pInputBuilder->addPieceToInputWord(Game::InputWordNumber::TWO, pieceIndex, c_PiecesTypes.at(pieceIndex)));
+        }
+
+        isInputComplete = isInputComplete && pInputBuilder->isInputComplete();
+        pInputBuilder->resetInput();
+    }
+
+    QVERIFY2(isInputComplete, "The input has not been completed!");
+}
+
+void SystemFunctionalityBenchmarks::benchmarkHandleSubmitRequest_data()
+{
+    _addDictionarySizeColumns();
+}
+
+void SystemFunctionalityBenchmarks::benchmarkHandleSubmitRequest()
+{
+    QFETCH(int, dictionarySize);
+    QFETCH(int, languageIndex);
+
+    GameManager* pGameManager{GameManager::getManager()};
+
+    // setup once (first data row), the manager lives until the end of the test case
+    if (!pGameManager->getGameFacade())
+    {
+        pGameManager->setEnvironment(m_DatabaseDir.path());
+        pGameManager->getGameFacade()->init();
+    }
+
+    GameFacade* pGameFacade{pGameManager->getGameFacade()};
+    QVERIFY2(pGameFacade, "The game facade has not been created!");
+
+    // the game can start as soon as the first chunk is loaded, however the benchmark should run with the complete dictionary
+    pGameFacade->setLanguage(languageIndex, false);
+    QTRY_VERIFY_WITH_TIMEOUT(pGameFacade->isDataAvailable() && pGameManager->getNrOfDataSourceEntries() == dictionarySize, 300000);
+
+    pGameFacade->startGame();
+
+    bool success{true};
+
+    // a game round: the correct input is built piece by piece (as the user would do), then submitted which provides the next pair; pending events are processed afterwards (e.g. prefetched pairs)
+    QBENCHMARK
+    {
+        const QVector<QString>& c_PiecesContent{pGameFacade->getMixedWordsPiecesContent()};
+        const QVector<Game::PieceTypes>& c_PiecesTypes{pGameFacade->getMixedWordsPiecesTypes()};
+        QVector<bool> arePiecesUsed(c_PiecesContent.size(), false);
+
+        const QVector<int> c_FirstWordPieceIndexes{_getWordPieceIndexes(pGameFacade->getFirstReferenceWord(), c_PiecesContent, c_PiecesTypes, arePiecesUsed)};
+        const QVector<int> c_SecondWordPieceIndexes{_getWordPieceIndexes(pGameFacade->getSecondReferenceWord(), c_PiecesContent, c_PiecesTypes, arePiecesUsed)};
+
+        for (auto pieceIndex : c_FirstWordPieceIndexes)
+        {
+            pGameFacade->addPieceToInputWord(Game::InputWordNumber::ONE, pieceIndex);
+        }
+
+        for (auto pieceIndex : c_SecondWordPieceIndexes)
+        {
+            pGameFacade->addPieceToInputWord(Game::InputWordNumber::TWO, pieceIndex);
+        }
+
+        pGameFacade->handleSubmitRequest();
+        success = success && pGameFacade->getStatusCode() == GameFacade::StatusCodes::CORRECT_USER_INPUT;
+
+        QCoreApplication::processEvents();
+    }
+
+    QVERIFY2(success, "Incorrect input submitted!");
+}
+
+void SystemFunctionalityBenchmarks::_addDictionarySizeColumns()
+{
+    QTest::addColumn<int>("dictionarySize");
+    QTest::addColumn<int>("languageIndex");
+
+    for (int languageIndex{0}; languageIndex < sc_DictionarySizes.size(); ++languageIndex)
+    {
+        const int c_DictionarySize{sc_DictionarySizes.at(languageIndex)};
+        QTest::newRow(_getDictionarySizeRowName(c_DictionarySize).toLatin1().constData()) << c_DictionarySize << languageIndex;
+    }
+}
+
+void SystemFunctionalityBenchmarks::_addGameLevelColumn()
+{
+    QTest::addColumn<Game::Levels>("level");
+
+    QTest::newRow("easy") << Game::Levels::LEVEL_EASY;
+    QTest::newRow("medium") << Game::Levels::LEVEL_MEDIUM;
+    QTest::newRow("hard") << Game::Levels::LEVEL_HARD;
+}
+
+void SystemFunctionalityBenchmarks::_writeDictionariesToDatabase()
+{
+    const QString c_ConnectionName{"BenchmarksSetupConnection"};
+
+    {
+        QSqlDatabase db{QSqlDatabase::addDatabase(Database::Query::c_DbDriverName, c_ConnectionName)};
+        db.setDatabaseName(m_DatabasePath);
+
+        QVERIFY2(db.open(), "Cannot open the benchmarks database!");
+
+        QSqlQuery createTableQuery{db};
+        QVERIFY2(createTableQuery.exec(Database::Query::c_CreateTableQuery), "Cannot create the benchmarks database table!");
+        QVERIFY2(createTableQuery.exec(Database::Query::c_CreateLanguageIndexQuery), "Cannot create the benchmarks database index!");
+
+        // a single transaction per dictionary, otherwise writing the large dictionaries takes far too long
+        for (int languageIndex{0}; languageIndex < m_Dictionaries.size(); ++languageIndex)
+        {
+            QVERIFY2(db.transaction(), "Cannot start the database transaction!");
+
+            QSqlQuery insertEntryQuery{db};
+            insertEntryQuery.prepare(Database::Query::c_InsertEntryForLanguageIntoDbQuery);
+
+            for (const auto& dataEntry : m_Dictionaries.at(languageIndex))
+            {
+                insertEntryQuery.bindValue(Database::Query::c_FirstWordFieldPlaceholder, dataEntry.firstWord);
+                insertEntryQuery.bindValue(Database::Query::c_SecondWordFieldPlaceholder, dataEntry.secondWord);
+                insertEntryQuery.bindValue(Database::Query::c_AreSynonymsFieldPlaceholder, static_cast<int>(dataEntry.areSynonyms));
+                insertEntryQuery.bindValue(Database::Query::c_LanguageFieldPlaceholder, Database::Query::c_LanguageCodes.at(languageIndex));
+
+                QVERIFY2(insertEntryQuery.exec(), "Cannot write the synthetic entry to database!");
+            }
+
+            QVERIFY2(db.commit(), "Cannot commit the database transaction!");
+        }
+
+        db.close();
+    }
+
+    QSqlDatabase::removeDatabase(c_ConnectionName);
+}
+
+QString SystemFunctionalityBenchmarks::_getDictionarySizeRowName(int dictionarySize)
+{
+    return dictionarySize >= 1000000 ? QString::number(dictionarySize / 1000000) + "M" : QString::number(dictionarySize / 1000) + "k";
+}
+
+// prefix character followed by the word number written in base 26 (one lowercase letter per digit) so each word is valid and unique
+QString SystemFunctionalityBenchmarks::_getSyntheticWord(QChar prefix, int wordNumber)
+{
+    QString word{prefix};
+    word.reserve(1 + sc_SyntheticWordSuffixSize);
+
+    for (int digitNumber{0}; digitNumber < sc_SyntheticWordSuffixSize; ++digitNumber)
+    {
+        word.append(QChar{'a' + wordNumber % 26});
+        wordNumber /= 26;
+    }
+
+    return word;
+}
+
+// the word is rebuilt from left to right: the chosen piece should match the next characters and have the type required by its position (pieces with same content and type are interchangeable)
+QVector<int> SystemFunctionalityBenchmarks::_getWordPieceIndexes(const QString& word, const QVector<QString>& piecesContent, const QVector<Game::PieceTypes>& piecesTypes, QVector<bool>& arePiecesUsed)
+{
+    QVector<int> wordPieceIndexes;
+    int position{0};
+
+    while (position < word.size())
+    {
+        int chosenPieceIndex{-1};
+
+        for (int pieceIndex{0}; pieceIndex < piecesContent.size(); ++pieceIndex)
+        {
+            const QString& c_PieceContent{piecesContent.at(pieceIndex)};
+            const Game::PieceTypes c_RequiredPieceType{position == 0 ? Game::PieceTypes::BEGIN_PIECE
+                                                                     : (position + c_PieceContent.size() == word.size() ? Game::PieceTypes::END_PIECE
+                                                                                                                         : Game::PieceTypes::MIDDLE_PIECE)};
+
+            if (!arePiecesUsed.at(pieceIndex) && piecesTypes.at(pieceIndex) == c_RequiredPieceType && QStringView{word}.mid(position).startsWith(QStringView{c_PieceContent}))
+            {
+                chosenPieceIndex = pieceIndex;
+                break;
+            }
+        }
+
+        if (chosenPieceIndex == -1)
+        {
+            break;
+        }
+
+        arePiecesUsed[chosenPieceIndex] = true;
+        wordPieceIndexes.append(chosenPieceIndex);
+        position += static_cast<int>(piecesContent.at(chosenPieceIndex).size());
+    }
+
+    return wordPieceIndexes;
+}
+
+QTEST_GUILESS_MAIN(SystemFunctionalityBenchmarks)
+
+#include "bench_systemfunctionality.moc"
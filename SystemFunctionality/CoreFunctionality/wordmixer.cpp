@@ -1,6 +1,12 @@
 #include "wordmixer.h"
 #include "gameutils.h"
 #include "exceptions.h"
+#include "tracer.h"
+
+#include <QElapsedTimer>
+
+#include <algorithm>
+#include <numeric>
 
 const QMap<Game::Levels, int> c_WordPieceSizes
 {
@@ -12,6 +18,7 @@ const QMap<Game::Levels, int> c_WordPieceSizes
 WordMixer::WordMixer(QObject *parent)
     : QObject(parent)
     , m_GameLevel{Game::Levels::LEVEL_NONE}
+    , m_CurrentPieceSize{-1}
     , m_WordsPair{}
     , m_MixedWordsPiecesContent{}
     , m_WordPieceSizes{c_WordPieceSizes}
@@ -22,65 +29,46 @@ WordMixer::WordMixer(QObject *parent)
                                     {WordsBeginEndPieces::SECOND_WORD_LAST_PIECE , -1}
                                  }
     , m_AreSynonyms{true}
+    , m_WordPiecePositions{}
+    , m_pMixLatencyHistogram{MetricsRegistry::getRegistry()->getHistogram("synant_mix_latency_seconds", "Time required for mixing a words pair.")}
 {
     std::random_device rDev2{};
     m_WordPieceIndexEngine.seed(rDev2());
 }
 
-void WordMixer::mixWords(QPair<QString, QString> newWordsPair, bool areSynonyms)
+void WordMixer::mixWords(const QPair<QString, QString>& newWordsPair, bool areSynonyms)
 {
-    Q_ASSERT(m_GameLevel != Game::Levels::LEVEL_NONE && m_WordPieceSizes.contains(m_GameLevel));
-    Q_ASSERT(newWordsPair.first.size() > m_WordPieceSizes[m_GameLevel] && newWordsPair.second.size() > m_WordPieceSizes[m_GameLevel] && m_WordPieceSizes[m_GameLevel] > 0);
-
-    auto insertWordPiece = [this](const QString& word, int firstCharPos, QVector<int>& wordPieceIndexes)
-    {
-        Q_ASSERT(wordPieceIndexes.size() > 0u);
-
-        // static_cast required for solving compiling error (there should be no overflow issue as the number of word piece indexes is reasonably low - to be refactored later if possible/required)
-        std::uniform_int_distribution<int> indexDist{0, static_cast<int>(wordPieceIndexes.size()) - 1};
-        int insertOnPositionIndex{indexDist(m_WordPieceIndexEngine)};
+    TRACE_SCOPE("WordMixer::mixWords");
 
-        int insertOnPosition{wordPieceIndexes[insertOnPositionIndex]};
-        m_MixedWordsPiecesContent[insertOnPosition] = word.mid(firstCharPos, m_WordPieceSizes[m_GameLevel]);
+    QElapsedTimer mixTimer;
+    mixTimer.start();
 
-        wordPieceIndexes.remove(insertOnPositionIndex);
-        return insertOnPosition;
-    };
+    Q_ASSERT(m_GameLevel != Game::Levels::LEVEL_NONE && m_CurrentPieceSize > 0);
+    Q_ASSERT(newWordsPair.first.size() > m_CurrentPieceSize && newWordsPair.second.size() > m_CurrentPieceSize);
 
     m_WordsPair = newWordsPair;
     m_AreSynonyms = areSynonyms;
 
-    int firstWordSize{static_cast<int>(m_WordsPair.first.size())}; // same note regarding static_cast (see above)
-    int secondWordSize{static_cast<int>(m_WordsPair.second.size())}; // same note regarding static_cast (see above)
-    int firstWordNrOfPieces{firstWordSize / m_WordPieceSizes[m_GameLevel] + ((firstWordSize % m_WordPieceSizes[m_GameLevel]) == 0 ? 0 : 1)};
-    int secondWordNrOfPieces{secondWordSize / m_WordPieceSizes[m_GameLevel] + ((secondWordSize % m_WordPieceSizes[m_GameLevel]) == 0 ? 0 : 1)};
-    int totalNrOfPieces{firstWordNrOfPieces + secondWordNrOfPieces};
+    const int c_FirstWordNrOfPieces{_getNrOfPieces(m_WordsPair.first)};
+    const int c_TotalNrOfPieces{c_FirstWordNrOfPieces + _getNrOfPieces(m_WordsPair.second)};
 
-    m_MixedWordsPiecesContent.resize(totalNrOfPieces);
+    // the capacity of both vectors is preserved when resizing so they only get reallocated when a pair with more pieces than all previous ones is mixed
+    m_WordPiecePositions.resize(c_TotalNrOfPieces);
+    m_MixedWordsPiecesContent.resize(c_TotalNrOfPieces);
 
-    QVector<int> wordPieceIndexes{};
+    std::iota(m_WordPiecePositions.begin(), m_WordPiecePositions.end(), 0);
+    std::shuffle(m_WordPiecePositions.begin(), m_WordPiecePositions.end(), m_WordPieceIndexEngine);
 
-    for (int pieceIndex{0}; pieceIndex<totalNrOfPieces; ++pieceIndex)
-    {
-        wordPieceIndexes.append(pieceIndex);
-    }
+    _writeWordPieces(m_WordsPair.first, m_WordPiecePositions.constData());
+    _writeWordPieces(m_WordsPair.second, m_WordPiecePositions.constData() + c_FirstWordNrOfPieces);
 
-    int firstWordLastPiecePos{m_WordPieceSizes[m_GameLevel]*(firstWordNrOfPieces-1)};
-    int secondWordLastPiecePos{m_WordPieceSizes[m_GameLevel]*(secondWordNrOfPieces-1)};
+    m_WordsBeginEndPieceIndexes[WordsBeginEndPieces::FIRST_WORD_FIRST_PIECE] = m_WordPiecePositions[0];
+    m_WordsBeginEndPieceIndexes[WordsBeginEndPieces::FIRST_WORD_LAST_PIECE] = m_WordPiecePositions[c_FirstWordNrOfPieces - 1];
+    m_WordsBeginEndPieceIndexes[WordsBeginEndPieces::SECOND_WORD_FIRST_PIECE] = m_WordPiecePositions[c_FirstWordNrOfPieces];
+    m_WordsBeginEndPieceIndexes[WordsBeginEndPieces::SECOND_WORD_LAST_PIECE] = m_WordPiecePositions[c_TotalNrOfPieces - 1];
 
-    m_WordsBeginEndPieceIndexes[WordsBeginEndPieces::FIRST_WORD_FIRST_PIECE] = insertWordPiece(m_WordsPair.first, 0, wordPieceIndexes);
-    for (int wordPieceStartPos{m_WordPieceSizes[m_GameLevel]}; wordPieceStartPos<firstWordLastPiecePos; wordPieceStartPos+=m_WordPieceSizes[m_GameLevel])
-    {
-        insertWordPiece(m_WordsPair.first, wordPieceStartPos, wordPieceIndexes);
-    }
-    m_WordsBeginEndPieceIndexes[WordsBeginEndPieces::FIRST_WORD_LAST_PIECE] = insertWordPiece(m_WordsPair.first, firstWordLastPiecePos, wordPieceIndexes);
-
-    m_WordsBeginEndPieceIndexes[WordsBeginEndPieces::SECOND_WORD_FIRST_PIECE] = insertWordPiece(m_WordsPair.second, 0, wordPieceIndexes);
-    for (int wordPieceStartPos{m_WordPieceSizes[m_GameLevel]}; wordPieceStartPos<secondWordLastPiecePos; wordPieceStartPos+=m_WordPieceSizes[m_GameLevel])
-    {
-        insertWordPiece(m_WordsPair.second, wordPieceStartPos, wordPieceIndexes);
-    }
-    m_WordsBeginEndPieceIndexes[WordsBeginEndPieces::SECOND_WORD_LAST_PIECE] = insertWordPiece(m_WordsPair.second, secondWordLastPiecePos, wordPieceIndexes);
+    // recorded before notifying so the handling of the mixed pair is not included
+    m_pMixLatencyHistogram->record(mixTimer.nsecsElapsed());
 
     Q_EMIT newWordsPairMixed();
 }
@@ -90,6 +78,7 @@ void WordMixer::setGameLevel(Game::Levels level)
     if (level != Game::Levels::LEVEL_NONE)
     {
         m_GameLevel = level;
+        m_CurrentPieceSize = m_WordPieceSizes[m_GameLevel];
     }
 }
 
@@ -98,9 +87,19 @@ void WordMixer::setPieceSizeForLevel(int size, Game::Levels level)
     if (size > 0 && level != Game::Levels::LEVEL_NONE)
     {
         m_WordPieceSizes[level] = size;
+
+        if (level == m_GameLevel)
+        {
+            m_CurrentPieceSize = size;
+        }
     }
 }
 
+void WordMixer::setSeed(quint32 seed)
+{
+    m_WordPieceIndexEngine.seed(seed);
+}
+
 const QVector<QString>& WordMixer::getMixedWordsPiecesContent() const
 {
     return m_MixedWordsPiecesContent;
@@ -118,7 +117,7 @@ QString WordMixer::getSecondWord() const
 
 int WordMixer::getCurrentPieceSize() const
 {
-    return m_WordPieceSizes.contains(m_GameLevel) ? m_WordPieceSizes[m_GameLevel] : -1;
+    return m_CurrentPieceSize;
 }
 
 Game::Levels WordMixer::getGameLevel() const
@@ -150,3 +149,59 @@ bool WordMixer::areSynonyms() const
 {
     return m_AreSynonyms;
 }
+
+WordMixer::MixedWordsPair WordMixer::getMixedWordsPair() const
+{
+    MixedWordsPair mixedWordsPair;
+
+    mixedWordsPair.piecesContent = m_MixedWordsPiecesContent;
+    mixedWordsPair.firstWord = m_WordsPair.first;
+    mixedWordsPair.secondWord = m_WordsPair.second;
+    mixedWordsPair.areSynonyms = m_AreSynonyms;
+    mixedWordsPair.firstWordFirstPieceIndex = m_WordsBeginEndPieceIndexes[WordsBeginEndPieces::FIRST_WORD_FIRST_PIECE];
+    mixedWordsPair.firstWordLastPieceIndex = m_WordsBeginEndPieceIndexes[WordsBeginEndPieces::FIRST_WORD_LAST_PIECE];
+    mixedWordsPair.secondWordFirstPieceIndex = m_WordsBeginEndPieceIndexes[WordsBeginEndPieces::SECOND_WORD_FIRST_PIECE];
+    mixedWordsPair.secondWordLastPieceIndex = m_WordsBeginEndPieceIndexes[WordsBeginEndPieces::SECOND_WORD_LAST_PIECE];
+
+    return mixedWordsPair;
+}
+
+int WordMixer::_getNrOfPieces(const QString& word) const
+{
+    const int c_WordSize{static_cast<int>(word.size())}; // static_cast required for solving compiling error when building with Qt6 (size is qsizetype)
+
+    return c_WordSize / m_CurrentPieceSize + ((c_WordSize % m_CurrentPieceSize) == 0 ? 0 : 1);
+}
+
+// the characters are copied into the already allocated piece strings (no new string is created for each piece as it would happen with QString::mid())
+void WordMixer::_writeWordPieces(const QString& word, const int* pWordPiecePositions)
+{
+    const int c_WordSize{static_cast<int>(word.size())}; // same note regarding static_cast (see above)
+    int pieceNr{0};
+
+    for (int pieceStartPos{0}; pieceStartPos < c_WordSize; pieceStartPos += m_CurrentPieceSize)
+    {
+        QString& piece{m_MixedWordsPiecesContent[pWordPiecePositions[pieceNr]]};
+
+        // a slot might get a shorter (last) piece, so it is reserved for the full piece size (new slot or piece size changed) in order to avoid reallocating when a full piece is written into it afterwards
+        if (piece.capacity() < m_CurrentPieceSize)
+        {
+            piece.reserve(m_CurrentPieceSize);
+        }
+
+        piece.setUnicode(word.constData() + pieceStartPos, std::min(m_CurrentPieceSize, c_WordSize - pieceStartPos));
+        ++pieceNr;
+    }
+}
+
+WordMixer::MixedWordsPair::MixedWordsPair()
+    : piecesContent{}
+    , firstWord{}
+    , secondWord{}
+    , areSynonyms{true}
+    , firstWordFirstPieceIndex{-1}
+    , firstWordLastPieceIndex{-1}
+    , secondWordFirstPieceIndex{-1}
+    , secondWordLastPieceIndex{-1}
+{
+}
@@ -5,6 +5,9 @@
    3) Hands over the mixed word pieces array and original words to an owner class (WordPairOwner) for further usage
 
    The size of the word piece is modifiable and depends on the selected level.
+   Mixing reuses the buffers of the previous mix, so no allocations occur once the mixer has been "warmed up" with pairs of similar sizes.
+   For this the mixed pieces should not be kept shared: WordPairOwner copies them into its own buffers (only the prefetched pairs keep sharing them until used).
+   The duration of each mix is recorded into the mix latency histogram (see MetricsRegistry).
 */
 
 
@@ -19,16 +22,32 @@
 #include <random>
 
 #include "../Utilities/gameutils.h"
+#include "../Utilities/metricsregistry.h"
 
 class WordMixer : public QObject
 {
     Q_OBJECT
 
 public:
+    // result of a mixing operation, can be handed over as a whole (e.g. when mixing is done in advance on another thread)
+    struct MixedWordsPair
+    {
+        MixedWordsPair();
+
+        QVector<QString> piecesContent;
+        QString firstWord;
+        QString secondWord;
+        bool areSynonyms;
+        int firstWordFirstPieceIndex;
+        int firstWordLastPieceIndex;
+        int secondWordFirstPieceIndex;
+        int secondWordLastPieceIndex;
+    };
+
     explicit WordMixer(QObject *parent = nullptr);
 
     // splits the words into equal pieces and mixes them into an array (last piece might have less characters than the others)
-    void mixWords(QPair<QString, QString> newWordsPair, bool areSynonyms);
+    void mixWords(const QPair<QString, QString>& newWordsPair, bool areSynonyms);
 
     // sets number of characters for each word piece
     void setGameLevel(Game::Levels level);
@@ -36,6 +55,9 @@ public:
     // personalize the word mixer
     void setPieceSizeForLevel(int size, Game::Levels level);
 
+    // same seed and same words pair result in the same mixed pieces (the engine is seeded from a random device by default)
+    void setSeed(quint32 seed);
+
     const QVector<QString>& getMixedWordsPiecesContent() const;
     QString getFirstWord() const;
     QString getSecondWord() const;
@@ -50,6 +72,8 @@ public:
 
     bool areSynonyms() const;
 
+    MixedWordsPair getMixedWordsPair() const;
+
 signals:
     Q_SIGNAL void newWordsPairMixed();
 
@@ -64,7 +88,11 @@ private:
         PiecesCount
     };
 
+    int _getNrOfPieces(const QString& word) const;
+    void _writeWordPieces(const QString& word, const int* pWordPiecePositions);
+
     Game::Levels m_GameLevel;
+    int m_CurrentPieceSize; // cached piece size for current level (-1 if no level set)
     QPair<QString,QString> m_WordsPair;
     QVector<QString> m_MixedWordsPiecesContent;
     QMap<Game::Levels, int> m_WordPieceSizes;
@@ -74,8 +102,14 @@ private:
 
     bool m_AreSynonyms;
 
-    // get the index of the mixed words string array where current piece is written
+    // positions in the mixed words string array for each piece (first word pieces followed by second word pieces, in the order they occur in the words); shuffled in place at each mix
+    QVector<int> m_WordPiecePositions;
+
     std::default_random_engine m_WordPieceIndexEngine;
+
+    MetricsRegistry::Histogram* m_pMixLatencyHistogram;
 };
 
+Q_DECLARE_METATYPE(WordMixer::MixedWordsPair)
+
 #endif // WORDMIXER_H
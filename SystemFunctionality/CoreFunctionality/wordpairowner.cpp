@@ -1,7 +1,12 @@
 #include "wordpairowner.h"
 
+#include <algorithm>
+
 WordPairOwner::WordPairOwner(QObject *parent)
     : QObject{parent}
+    , m_MixedWordsPiecesContentBuffers{}
+    , m_CurrentPiecesContentBufferIndex{0}
+    , m_NrOfPiecesNotAddedToInput{0}
     , m_AreSynonyms{false}
     , m_PersistentPieceSelectionIndex{-1}
     , m_NewPairAutoIndexSetupEnabled{false}
@@ -56,14 +61,14 @@ void WordPairOwner::setPersistentPieceSelectionIndex(bool isStartPieceRequired,
     {
         int firstAvailableIndex{-1};
 
-        for (int pieceIndex{0}; pieceIndex < m_MixedWordsPieces.size(); ++pieceIndex)
+        for (int pieceIndex{0}; pieceIndex < m_AreMixedWordsPiecesAddedToInput.size(); ++pieceIndex)
         {
-            if (excludeEndPiecesFromPersistentIndex && m_MixedWordsPieces[pieceIndex].pieceType == Game::PieceTypes::END_PIECE)
+            if (excludeEndPiecesFromPersistentIndex && m_MixedWordsPiecesTypes[pieceIndex] == Game::PieceTypes::END_PIECE)
             {
                 continue;
             }
 
-            if (!m_MixedWordsPieces[pieceIndex].isAddedToInput)
+            if (!m_AreMixedWordsPiecesAddedToInput[pieceIndex])
             {
                 firstAvailableIndex = pieceIndex;
                 break;
@@ -79,9 +84,9 @@ void WordPairOwner::setPersistentPieceSelectionIndex(bool isStartPieceRequired,
             else
             {
 
-                for (int pieceIndex{firstAvailableIndex}; pieceIndex < m_MixedWordsPieces.size(); ++pieceIndex)
+                for (int pieceIndex{firstAvailableIndex}; pieceIndex < m_AreMixedWordsPiecesAddedToInput.size(); ++pieceIndex)
                 {
-                    if (!m_MixedWordsPieces[pieceIndex].isAddedToInput && m_MixedWordsPieces[pieceIndex].pieceType == Game::PieceTypes::BEGIN_PIECE)
+                    if (!m_AreMixedWordsPiecesAddedToInput[pieceIndex] && m_MixedWordsPiecesTypes[pieceIndex] == Game::PieceTypes::BEGIN_PIECE)
                     {
                         m_PersistentPieceSelectionIndex = pieceIndex;
                         break;
@@ -109,9 +114,9 @@ void WordPairOwner::increasePersistentPieceSelectionIndex()
     {
         bool success{false};
 
-        for (int index{m_PersistentPieceSelectionIndex+1}; index < m_MixedWordsPieces.size(); ++index)
+        for (int index{m_PersistentPieceSelectionIndex+1}; index < m_AreMixedWordsPiecesAddedToInput.size(); ++index)
         {
-            if (!m_MixedWordsPieces[index].isAddedToInput)
+            if (!m_AreMixedWordsPiecesAddedToInput[index])
             {
                 m_PersistentPieceSelectionIndex = index;
                 success = true;
@@ -123,7 +128,7 @@ void WordPairOwner::increasePersistentPieceSelectionIndex()
         {
             for (int index{0}; index < m_PersistentPieceSelectionIndex; ++index)
             {
-                if (!m_MixedWordsPieces[index].isAddedToInput)
+                if (!m_AreMixedWordsPiecesAddedToInput[index])
                 {
                     m_PersistentPieceSelectionIndex = index;
                     success = true;
@@ -151,7 +156,7 @@ void WordPairOwner::decreasePersistentPieceSelectionIndex()
 
         for (int index{m_PersistentPieceSelectionIndex-1}; index >= 0; --index)
         {
-            if (!m_MixedWordsPieces[index].isAddedToInput)
+            if (!m_AreMixedWordsPiecesAddedToInput[index])
             {
                 m_PersistentPieceSelectionIndex = index;
                 success = true;
@@ -164,9 +169,9 @@ void WordPairOwner::decreasePersistentPieceSelectionIndex()
             /* static_cast required for solving compiling error (there should be no overflow issue as the number of indexes is reasonably low
                to be refactored later if required/possible)
             */
-            for (int index{static_cast<int>(m_MixedWordsPieces.size()) - 1}; index > m_PersistentPieceSelectionIndex; --index)
+            for (int index{static_cast<int>(m_AreMixedWordsPiecesAddedToInput.size()) - 1}; index > m_PersistentPieceSelectionIndex; --index)
             {
-                if (!m_MixedWordsPieces[index].isAddedToInput)
+                if (!m_AreMixedWordsPiecesAddedToInput[index])
                 {
                     m_PersistentPieceSelectionIndex = index;
                     success = true;
@@ -186,52 +191,31 @@ void WordPairOwner::decreasePersistentPieceSelectionIndex()
     }
 }
 
-QVector<QString> WordPairOwner::getMixedWordsPiecesContent() const
+const QVector<QString>& WordPairOwner::getMixedWordsPiecesContent() const
 {
-    QVector<QString> content;
-
-    for (const auto& piece : m_MixedWordsPieces)
-    {
-        content.append(piece.content);
-    }
-
-    return content;
+    return m_MixedWordsPiecesContentBuffers[m_CurrentPiecesContentBufferIndex];
 }
 
-QVector<Game::PieceTypes> WordPairOwner::getMixedWordsPiecesTypes() const
+const QVector<Game::PieceTypes>& WordPairOwner::getMixedWordsPiecesTypes() const
 {
-    QVector<Game::PieceTypes> piecesTypes;
-
-    for (const auto& piece : m_MixedWordsPieces)
-    {
-        piecesTypes.append(piece.pieceType);
-    }
-
-    return piecesTypes;
+    return m_MixedWordsPiecesTypes;
 }
 
-QVector<bool> WordPairOwner::getAreMixedWordsPiecesAddedToInput() const
+const QVector<bool>& WordPairOwner::getAreMixedWordsPiecesAddedToInput() const
 {
-    QVector<bool> areWordPiecesSelected;
-
-    for (const auto& piece : m_MixedWordsPieces)
-    {
-        areWordPiecesSelected.append(piece.isAddedToInput);
-    }
-
-    return areWordPiecesSelected;
+    return m_AreMixedWordsPiecesAddedToInput;
 }
 
 Game::PieceTypes WordPairOwner::getWordPieceType(int index) const
 {
-    Q_ASSERT(index>=0 && index<m_MixedWordsPieces.size());
-    return m_MixedWordsPieces.at(index).pieceType;
+    Q_ASSERT(index>=0 && index<m_MixedWordsPiecesTypes.size());
+    return m_MixedWordsPiecesTypes.at(index);
 }
 
 bool WordPairOwner::getIsWordPieceAddedToInput(int index) const
 {
-    Q_ASSERT(index>=0 && index<m_MixedWordsPieces.size());
-    return m_MixedWordsPieces.at(index).isAddedToInput;
+    Q_ASSERT(index>=0 && index<m_AreMixedWordsPiecesAddedToInput.size());
+    return m_AreMixedWordsPiecesAddedToInput.at(index);
 }
 
 int WordPairOwner::getPersistentPieceSelectionIndex() const
@@ -251,23 +235,7 @@ QString WordPairOwner::getSecondReferenceWord() const
 
 bool WordPairOwner::isOnePieceLeftToAddToInput() const
 {
-    bool result{false};
-    int nrOfPiecesNotSelected{0};
-
-    for (auto piece : m_MixedWordsPieces)
-    {
-        if (!piece.isAddedToInput)
-        {
-            ++nrOfPiecesNotSelected;
-        }
-    }
-
-    if (nrOfPiecesNotSelected == 1)
-    {
-        result = true;
-    }
-
-    return result;
+    return m_NrOfPiecesNotAddedToInput == 1;
 }
 
 bool WordPairOwner::areSynonyms() const
@@ -277,40 +245,53 @@ bool WordPairOwner::areSynonyms() const
 
 void WordPairOwner::_buildMixedWordsPiecesArray(const QVector<QString>& content, int firstBeginIndex, int firstEndIndex, int secondBeginIndex, int secondEndIndex)
 {
-    m_MixedWordsPieces.clear();
-    m_MixedWordsPieces.resize(content.size());
+    // static_cast required for solving compiling error (same note as for the other size related conversions from this class)
+    const int c_NrOfPieces{static_cast<int>(content.size())};
 
-    int index{0};
+    QVector<QString>& piecesContent{m_MixedWordsPiecesContentBuffers[1 - m_CurrentPiecesContentBufferIndex]};
 
-    for (auto& piece : m_MixedWordsPieces)
+    int maxPieceSize{0};
+
+    for (const auto& piece : content)
     {
-        piece.content = content.at(index);
-        piece.isAddedToInput = false;
+        maxPieceSize = std::max(maxPieceSize, static_cast<int>(piece.size()));
+    }
 
-        if (index == firstBeginIndex || index == secondBeginIndex)
-        {
-            piece.pieceType = Game::PieceTypes::BEGIN_PIECE;
-        }
-        else if (index == firstEndIndex || index == secondEndIndex)
-        {
-            piece.pieceType = Game::PieceTypes::END_PIECE;
-        }
-        else
+    piecesContent.resize(c_NrOfPieces);
+
+    // copied by content (not by sharing the strings of the mixer), each slot being reserved for the largest piece as the pieces get shuffled between slots (same as in WordMixer)
+    for (int pieceIndex{0}; pieceIndex < c_NrOfPieces; ++pieceIndex)
+    {
+        const QString& c_Piece{content.at(pieceIndex)};
+        QString& ownedPiece{piecesContent[pieceIndex]};
+
+        if (ownedPiece.capacity() < maxPieceSize)
         {
-            piece.pieceType = Game::PieceTypes::MIDDLE_PIECE;
+            ownedPiece.reserve(maxPieceSize);
         }
 
-        ++index;
+        ownedPiece.setUnicode(c_Piece.constData(), c_Piece.size());
     }
+
+    m_CurrentPiecesContentBufferIndex = 1 - m_CurrentPiecesContentBufferIndex;
+    m_MixedWordsPiecesTypes.fill(Game::PieceTypes::MIDDLE_PIECE, c_NrOfPieces);
+    m_AreMixedWordsPiecesAddedToInput.fill(false, c_NrOfPieces);
+    m_NrOfPiecesNotAddedToInput = c_NrOfPieces;
+
+    m_MixedWordsPiecesTypes[firstBeginIndex] = Game::PieceTypes::BEGIN_PIECE;
+    m_MixedWordsPiecesTypes[secondBeginIndex] = Game::PieceTypes::BEGIN_PIECE;
+    m_MixedWordsPiecesTypes[firstEndIndex] = Game::PieceTypes::END_PIECE;
+    m_MixedWordsPiecesTypes[secondEndIndex] = Game::PieceTypes::END_PIECE;
 }
 
 void WordPairOwner::_updateSingleWordPieceStatus(int wordPieceIndex, bool selected)
 {
-    Q_ASSERT(wordPieceIndex >= 0 && wordPieceIndex < m_MixedWordsPieces.size());
+    Q_ASSERT(wordPieceIndex >= 0 && wordPieceIndex < m_AreMixedWordsPiecesAddedToInput.size());
 
-    if (m_MixedWordsPieces[wordPieceIndex].isAddedToInput != selected)
+    if (m_AreMixedWordsPiecesAddedToInput[wordPieceIndex] != selected)
     {
-        m_MixedWordsPieces[wordPieceIndex].isAddedToInput = selected;
+        m_AreMixedWordsPiecesAddedToInput[wordPieceIndex] = selected;
+        m_NrOfPiecesNotAddedToInput += selected ? -1 : 1;
         Q_EMIT piecesAddedToInputStateChanged();
     }
 }
@@ -321,11 +302,12 @@ void WordPairOwner::_updateMultipleWordPiecesStatus(QVector<int> wordPieceIndex,
 
     for (auto index : wordPieceIndex)
     {
-        Q_ASSERT(index >= 0 && index < m_MixedWordsPieces.size());
+        Q_ASSERT(index >= 0 && index < m_AreMixedWordsPiecesAddedToInput.size());
 
-        if (m_MixedWordsPieces[index].isAddedToInput != selected)
+        if (m_AreMixedWordsPiecesAddedToInput[index] != selected)
         {
-            m_MixedWordsPieces[index].isAddedToInput = selected;
+            m_AreMixedWordsPiecesAddedToInput[index] = selected;
+            m_NrOfPiecesNotAddedToInput += selected ? -1 : 1;
 
             if (!isSelectionChanged)
             {
@@ -346,14 +328,14 @@ void WordPairOwner::_updatePersistentPieceSelectionIndex(bool excludeEndPiecesFr
     {
         bool success{false};
 
-        for (int index{m_PersistentPieceSelectionIndex+1}; index < m_MixedWordsPieces.size(); ++index)
+        for (int index{m_PersistentPieceSelectionIndex+1}; index < m_AreMixedWordsPiecesAddedToInput.size(); ++index)
         {
-            if (excludeEndPiecesFromPersistentIndex && m_MixedWordsPieces[index].pieceType == Game::PieceTypes::END_PIECE)
+            if (excludeEndPiecesFromPersistentIndex && m_MixedWordsPiecesTypes[index] == Game::PieceTypes::END_PIECE)
             {
                 continue;
             }
 
-            if (!m_MixedWordsPieces[index].isAddedToInput)
+            if (!m_AreMixedWordsPiecesAddedToInput[index])
             {
                 m_PersistentPieceSelectionIndex = index;
                 success = true;
@@ -365,12 +347,12 @@ void WordPairOwner::_updatePersistentPieceSelectionIndex(bool excludeEndPiecesFr
         {
             for (int index{m_PersistentPieceSelectionIndex-1}; index >= 0; --index)
             {
-                if (excludeEndPiecesFromPersistentIndex && m_MixedWordsPieces[index].pieceType == Game::PieceTypes::END_PIECE)
+                if (excludeEndPiecesFromPersistentIndex && m_MixedWordsPiecesTypes[index] == Game::PieceTypes::END_PIECE)
                 {
                     continue;
                 }
 
-                if (!m_MixedWordsPieces[index].isAddedToInput)
+                if (!m_AreMixedWordsPiecesAddedToInput[index])
                 {
                     m_PersistentPieceSelectionIndex = index;
                     success = true;
@@ -388,7 +370,3 @@ void WordPairOwner::_updatePersistentPieceSelectionIndex(bool excludeEndPiecesFr
         Q_EMIT persistentIndexChanged();
     }
 }
-
-WordPairOwner::WordPiece::WordPiece()
-{
-}
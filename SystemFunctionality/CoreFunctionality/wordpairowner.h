@@ -8,6 +8,9 @@
    1) Provides the owned data to the "consumer" classes (facade, presenter) on demand
    2) Keeps track of the selection status of the mixed words pieces (when a piece is added to input it is marked as selected and viceversa)
    3) Holds the persistent index which is used for adding pieces to input by using the keyboard cursor
+
+   The pieces data is stored as separate arrays (content, types, added to input statuses) so each of them can be read by reference without being copied.
+   The received pieces are copied into buffers owned by this class, so the mixer buffers don't remain shared (the next mix would detach them, i.e. allocate).
 */
 
 #ifndef WORDPAIROWNER_H
@@ -36,9 +39,9 @@ public:
     void increasePersistentPieceSelectionIndex();
     void decreasePersistentPieceSelectionIndex();
 
-    QVector<QString> getMixedWordsPiecesContent() const;
-    QVector<Game::PieceTypes> getMixedWordsPiecesTypes() const;
-    QVector<bool> getAreMixedWordsPiecesAddedToInput() const;
+    const QVector<QString>& getMixedWordsPiecesContent() const;
+    const QVector<Game::PieceTypes>& getMixedWordsPiecesTypes() const;
+    const QVector<bool>& getAreMixedWordsPiecesAddedToInput() const;
     Game::PieceTypes getWordPieceType(int index) const;
     bool getIsWordPieceAddedToInput(int index) const;
 
@@ -61,18 +64,18 @@ private:
     void _updateMultipleWordPiecesStatus(QVector<int> wordPieceIndexes, bool addedToInput);
     void _updatePersistentPieceSelectionIndex(bool excludeEndPiecesFromPersistentIndex);
 
-    struct WordPiece
-    {
-        WordPiece();
-
-        QString content;
-        Game::PieceTypes pieceType;
-        bool isAddedToInput;
-    };
-
     QString m_FirstReferenceWord;
     QString m_SecondReferenceWord;
-    QVector<WordPiece> m_MixedWordsPieces;
+
+    /* same size, the element with a given index from each array belongs to the same piece
+       the content buffers are used alternately: a consumer keeping a shallow copy of the current pieces (e.g. the presentation model) only releases it when copying the next ones,
+       so the new pieces are always written into a buffer which is no longer shared (allocations only occur until the buffers are large enough) */
+    QVector<QString> m_MixedWordsPiecesContentBuffers[2];
+    int m_CurrentPiecesContentBufferIndex;
+    QVector<Game::PieceTypes> m_MixedWordsPiecesTypes;
+    QVector<bool> m_AreMixedWordsPiecesAddedToInput;
+
+    int m_NrOfPiecesNotAddedToInput;
     bool m_AreSynonyms;
     int m_PersistentPieceSelectionIndex;
     bool m_NewPairAutoIndexSetupEnabled;
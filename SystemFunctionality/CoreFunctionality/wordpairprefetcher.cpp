@@ -0,0 +1,30 @@
+#include "wordpairprefetcher.h"
+#include "datasource.h"
+
+WordPairPrefetcher::WordPairPrefetcher(DataSource* pDataSource, QObject *parent)
+    : QObject(parent)
+    , m_pDataSource{pDataSource}
+    , m_pWordMixer{new WordMixer{this}}
+{
+    Q_ASSERT(m_pDataSource);
+}
+
+void WordPairPrefetcher::onWordsPairPrefetchRequested(int requestId, int entryNumber, int languageIndex, Game::Levels level, quint32 mixSeed)
+{
+    Q_ASSERT(level != Game::Levels::LEVEL_NONE);
+
+    DataSource::DataEntry dataEntry;
+    WordMixer::MixedWordsPair mixedWordsPair;
+
+    const bool c_IsEntryAvailable{m_pDataSource->getPrimarySourceDataEntry(entryNumber, languageIndex, dataEntry)};
+
+    if (c_IsEntryAvailable)
+    {
+        m_pWordMixer->setGameLevel(level);
+        m_pWordMixer->setSeed(mixSeed);
+        m_pWordMixer->mixWords(QPair<QString, QString>{dataEntry.firstWord, dataEntry.secondWord}, dataEntry.areSynonyms);
+        mixedWordsPair = m_pWordMixer->getMixedWordsPair();
+    }
+
+    Q_EMIT wordsPairPrefetched(requestId, c_IsEntryAvailable, mixedWordsPair);
+}
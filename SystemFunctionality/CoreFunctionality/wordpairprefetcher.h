@@ -0,0 +1,38 @@
+/*
+   This class fulfills following tasks:
+   1) Runs in a separate thread and mixes the data source entries requested by the GameManager in advance
+   2) Hands the mixed words pairs back to GameManager so the facade can use them when advancing to the next pair without mixing on the GUI thread
+   3) Mixes each pair with the seed provided by the facade, so a prefetched pair is identical to the one the facade would mix itself for the same request
+
+   It uses its own WordMixer so the one owned by GameManager (used by facade as fallback when no prefetched pair is available) is never accessed from this thread.
+*/
+
+#ifndef WORDPAIRPREFETCHER_H
+#define WORDPAIRPREFETCHER_H
+
+#include <QObject>
+
+#include "wordmixer.h"
+#include "../Utilities/gameutils.h"
+
+class DataSource;
+
+class WordPairPrefetcher : public QObject
+{
+    Q_OBJECT
+public:
+    explicit WordPairPrefetcher(DataSource* pDataSource, QObject *parent = nullptr);
+
+public slots:
+    void onWordsPairPrefetchRequested(int requestId, int entryNumber, int languageIndex, Game::Levels level, quint32 mixSeed);
+
+signals:
+    // each request is acknowledged exactly once, success is false if the entry could not be retrieved (e.g. data source primary language changed meanwhile)
+    Q_SIGNAL void wordsPairPrefetched(int requestId, bool success, WordMixer::MixedWordsPair mixedWordsPair);
+
+private:
+    DataSource* m_pDataSource;
+    WordMixer* m_pWordMixer;
+};
+
+#endif // WORDPAIRPREFETCHER_H
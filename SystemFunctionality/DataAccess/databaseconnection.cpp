@@ -0,0 +1,104 @@
+#include <QSqlDatabase>
+#include <QSqlQuery>
+
+#include "databaseconnection.h"
+#include "databaseutils.h"
+
+DatabaseConnection::DatabaseConnection(const QString& connectionName, const QString& databasePath, const Settings& settings)
+    : m_ConnectionName{connectionName}
+    , m_DatabasePath{databasePath}
+    , m_Settings{settings}
+{
+    Q_ASSERT(m_ConnectionName.size() > 0);
+}
+
+DatabaseConnection::~DatabaseConnection()
+{
+    close();
+}
+
+bool DatabaseConnection::open()
+{
+    bool success{true};
+
+    if (!QSqlDatabase::contains(m_ConnectionName))
+    {
+        QSqlDatabase db{QSqlDatabase::addDatabase(Database::Query::c_DbDriverName, m_ConnectionName)};
+        db.setDatabaseName(m_DatabasePath);
+    }
+
+    QSqlDatabase db{QSqlDatabase::database(m_ConnectionName, false)};
+
+    if (!db.isOpen())
+    {
+        success = db.open() && _applySettings(db);
+
+        if (!success && db.isOpen())
+        {
+            db.close();
+        }
+    }
+
+    return success;
+}
+
+void DatabaseConnection::close()
+{
+    if (QSqlDatabase::contains(m_ConnectionName))
+    {
+        // ensure all database related objects are destroyed before the connection is removed
+        {
+            QSqlDatabase db{QSqlDatabase::database(m_ConnectionName, false)};
+
+            if (db.isOpen())
+            {
+                db.close();
+            }
+        }
+
+        QSqlDatabase::removeDatabase(m_ConnectionName);
+    }
+}
+
+bool DatabaseConnection::isOpen() const
+{
+    return QSqlDatabase::contains(m_ConnectionName) && QSqlDatabase::database(m_ConnectionName, false).isOpen();
+}
+
+QSqlDatabase DatabaseConnection::getDatabase() const
+{
+    return QSqlDatabase::database(m_ConnectionName, false);
+}
+
+QString DatabaseConnection::getConnectionName() const
+{
+    return m_ConnectionName;
+}
+
+QString DatabaseConnection::getDatabasePath() const
+{
+    return m_DatabasePath;
+}
+
+bool DatabaseConnection::_applySettings(QSqlDatabase& db)
+{
+    QSqlQuery pragmaQuery{db};
+
+    return (m_Settings.journalMode.isEmpty() || pragmaQuery.exec(Database::Query::c_SetJournalModePragma.arg(m_Settings.journalMode))) &&
+           pragmaQuery.exec(Database::Query::c_SetMmapSizePragma.arg(m_Settings.mmapSize)) &&
+           pragmaQuery.exec(Database::Query::c_SetCacheSizePragma.arg(m_Settings.cacheSize));
+}
+
+DatabaseConnection::Settings::Settings()
+    : journalMode{Database::Connection::c_DefaultJournalMode}
+    , mmapSize{Database::Connection::c_DefaultMmapSize}
+    , cacheSize{Database::Connection::c_DefaultCacheSize}
+{
+}
+
+DatabaseConnection::Settings::Settings(const QString& journalMode, qint64 mmapSize, int cacheSize)
+    : journalMode{journalMode}
+    , mmapSize{mmapSize}
+    , cacheSize{cacheSize}
+{
+}
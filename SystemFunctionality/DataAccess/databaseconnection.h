@@ -0,0 +1,50 @@
+/*
+   This class fulfills following tasks:
+   1) Owns a named, long-lived database connection to be used by a single (worker) thread
+   2) Opens the connection once and configures it by applying the required PRAGMAs (journal mode if requested, memory mapping, page cache size)
+   3) Closes and removes the connection when destroyed (should happen in the thread that uses it)
+*/
+
+#ifndef DATABASECONNECTION_H
+#define DATABASECONNECTION_H
+
+#include <QString>
+
+class QSqlDatabase;
+
+class DatabaseConnection
+{
+public:
+    struct Settings
+    {
+        Settings();
+        Settings(const QString& journalMode, qint64 mmapSize, int cacheSize);
+
+        QString journalMode; // empty if the journal mode of the database should be kept
+        qint64 mmapSize; // bytes
+        int cacheSize;   // same semantics as the SQLite PRAGMA (negative value means KiB, positive means number of pages)
+    };
+
+    DatabaseConnection(const QString& connectionName, const QString& databasePath, const Settings& settings = Settings{});
+    ~DatabaseConnection();
+
+    bool open();
+    void close();
+
+    bool isOpen() const;
+    QSqlDatabase getDatabase() const;
+    QString getConnectionName() const;
+    QString getDatabasePath() const;
+
+private:
+    DatabaseConnection(const DatabaseConnection&) = delete;
+    DatabaseConnection& operator=(const DatabaseConnection&) = delete;
+
+    bool _applySettings(QSqlDatabase& db);
+
+    QString m_ConnectionName;
+    QString m_DatabasePath;
+    Settings m_Settings;
+};
+
+#endif // DATABASECONNECTION_H
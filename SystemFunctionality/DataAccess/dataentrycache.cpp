@@ -1,18 +1,23 @@
-#include <QThread>
 #include <QSqlDatabase>
-#include <QSqlField>
 #include <QSqlQuery>
 #include <QFile>
+#include <QMap>
+#include <QElapsedTimer>
 
 #include "dataentrycache.h"
 #include "databaseutils.h"
+#include "tracer.h"
 
-DataEntryCache::DataEntryCache(DataSource* pDataSource, QString databasePath, QObject *parent)
+DataEntryCache::DataEntryCache(DataSource* pDataSource, QString databasePath, const DatabaseConnection::Settings& connectionSettings, QObject *parent)
     : QObject(parent)
     , m_CacheEntries{}
     , m_LanguageIndexes{}
     , m_pDataSource{pDataSource}
-    , m_DatabasePath{databasePath}
+    , m_DatabaseConnection{Database::Connection::c_CacheConnectionName, databasePath, connectionSettings}
+    , m_pSavesCounter{MetricsRegistry::getRegistry()->getCounter("synant_saves_total", "Successful saves of the added words pairs to database.")}
+    , m_pSaveFailuresCounter{MetricsRegistry::getRegistry()->getCounter("synant_save_failures_total", "Failed saves of the added words pairs to database.")}
+    , m_pSavedPairsCounter{MetricsRegistry::getRegistry()->getCounter("synant_saved_words_pairs_total", "Words pairs saved to database.")}
+    , m_pSaveLatencyHistogram{MetricsRegistry::getRegistry()->getHistogram("synant_save_latency_seconds", "Time required for saving the added words pairs to database.")}
 {
 }
 
@@ -21,6 +26,15 @@ int DataEntryCache::getNrOfCachedEntries() const
     return m_CacheEntries.size();
 }
 
+void DataEntryCache::onOpenDatabaseConnectionRequested()
+{
+    // the connection should be opened within the cache thread as it can only be used by the thread that created it
+    if (!m_DatabaseConnection.open())
+    {
+        qWarning("Cannot open the data entry cache database connection, another attempt will be made when saving data");
+    }
+}
+
 void DataEntryCache::onValidEntryReceived(DataSource::DataEntry dataEntry, int languageIndex)
 {
     Q_ASSERT(m_CacheEntries.size() == m_LanguageIndexes.size());
@@ -47,73 +61,97 @@ void DataEntryCache::onValidEntryReceived(DataSource::DataEntry dataEntry, int l
     }
 }
 
-void DataEntryCache::onResetCacheRequested()
+void DataEntryCache::onResetCacheRequested(int requestId)
 {
     m_CacheEntries.clear();
     m_LanguageIndexes.clear();
 
-    // for sync purposes only
-    QThread::msleep(sc_ResetCacheDelay);
-
-    Q_EMIT cacheReset();
+    Q_EMIT cacheReset(requestId);
 }
 
-void DataEntryCache::onWriteDataToDbRequested()
+void DataEntryCache::onWriteDataToDbRequested(int requestId)
 {
-    Q_ASSERT(QFile{m_DatabasePath}.exists());
+    Q_ASSERT(QFile{m_DatabaseConnection.getDatabasePath()}.exists());
     Q_ASSERT(m_CacheEntries.size() == m_LanguageIndexes.size());
 
-    if (m_CacheEntries.size() > 0)
+    if (m_CacheEntries.size() == 0)
+    {
+        // nothing to save but the request still needs to be acknowledged
+        Q_EMIT writeDataToDbFinished(requestId, 0, 0);
+    }
+    else
     {
-        Q_UNUSED(QSqlDatabase::addDatabase(Database::Query::c_DbDriverName));
+        // normally the connection is already open (see onOpenDatabaseConnectionRequested()), just in case it isn't (e.g. previous failure) another attempt is made
+        QVector<DataSource::DataEntry> failedEntries;
+        QElapsedTimer saveTimer;
 
-        // ensure all database related objects are destroyed before the connection is removed
+        saveTimer.start();
+
+        if (m_DatabaseConnection.open() && _writeCachedEntriesToDb(failedEntries))
         {
-            QSqlDatabase db{QSqlDatabase::database(QSqlDatabase::defaultConnection)};
+            m_pSaveLatencyHistogram->record(saveTimer.nsecsElapsed());
+            m_pSavesCounter->increment();
+            m_pSavedPairsCounter->increment(static_cast<quint64>(m_CacheEntries.size()));
 
-            db.setDatabaseName(m_DatabasePath);
+            // static_cast required to solve compiling error (normally there should be no overflow - to be refactored to use size_t if required)
+            int totalNrOfSavedEntries{static_cast<int>(m_CacheEntries.size())};
+            int nrOfPrimaryLanguageSavedEntries{0};
 
-            if (db.open())
-            {
-                QSqlQuery query;
+            _moveCachedEntriesToDataSource(nrOfPrimaryLanguageSavedEntries);
 
-                for (int entry{0}; entry < m_CacheEntries.size(); ++entry)
-                {
-                    query.prepare(Database::Query::c_InsertEntryForLanguageIntoDbQuery);
-
-                    query.bindValue(Database::Query::c_FirstWordFieldPlaceholder, m_CacheEntries[entry].firstWord);
-                    query.bindValue(Database::Query::c_SecondWordFieldPlaceholder, m_CacheEntries[entry].secondWord);
-                    query.bindValue(Database::Query::c_AreSynonymsFieldPlaceholder, static_cast<int>(m_CacheEntries[entry].areSynonyms));
-                    query.bindValue(Database::Query::c_LanguageFieldPlaceholder, Database::Query::c_LanguageCodes[m_LanguageIndexes[entry]]);
+            Q_EMIT writeDataToDbFinished(requestId, nrOfPrimaryLanguageSavedEntries, totalNrOfSavedEntries);
+        }
+        else
+        {
+            // user entered data valid but error when writing to DB (nothing written, the entries are kept in cache)
+            m_pSaveFailuresCounter->increment();
+            Q_EMIT writeDataToDbErrorOccured(requestId, failedEntries);
+        }
+    }
+}
 
-                    if (!query.exec())
-                    {
-                        Q_EMIT writeDataToDbErrorOccured();
-                    }
-                }
+bool DataEntryCache::_writeCachedEntriesToDb(QVector<DataSource::DataEntry>& failedEntries)
+{
+    TRACE_SCOPE("DataEntryCache::_writeCachedEntriesToDb");
 
-                db.close();
+    QSqlDatabase db{m_DatabaseConnection.getDatabase()};
 
-                // static_cast required to solve compiling error (normally there should be no overflow - to be refactored to use size_t if required)
-                int totalNrOfSavedEntries{static_cast<int>(m_CacheEntries.size())};
-                int nrOfPrimaryLanguageSavedEntries{0};
+    // all entries are written within a single transaction: either all of them get saved or none
+    bool success{db.transaction()};
 
-                _moveCachedEntriesToDataSource(nrOfPrimaryLanguageSavedEntries);
+    if (success)
+    {
+        // ensure the query is destroyed before committing/rolling back the transaction
+        {
+            QSqlQuery query{db};
 
-                // for sync purposes only
-                QThread::msleep(sc_WriteDataThreadDelay);
+            // query is prepared only once and then re-executed with new bound values for each entry
+            success = query.prepare(Database::Query::c_InsertEntryForLanguageIntoDbQuery);
 
-                Q_EMIT writeDataToDbFinished(nrOfPrimaryLanguageSavedEntries, totalNrOfSavedEntries);
-            }
-            else
+            for (int entry{0}; success && entry < m_CacheEntries.size(); ++entry)
             {
-                // user entered data valid but error when writing to DB
-                Q_EMIT writeDataToDbErrorOccured();
+                query.bindValue(Database::Query::c_FirstWordFieldPlaceholder, m_CacheEntries[entry].firstWord);
+                query.bindValue(Database::Query::c_SecondWordFieldPlaceholder, m_CacheEntries[entry].secondWord);
+                query.bindValue(Database::Query::c_AreSynonymsFieldPlaceholder, static_cast<int>(m_CacheEntries[entry].areSynonyms));
+                query.bindValue(Database::Query::c_LanguageFieldPlaceholder, Database::Query::c_LanguageCodes[m_LanguageIndexes[entry]]);
+
+                // keep on writing the remaining entries so all failing ones get reported (the transaction is anyway rolled back)
+                if (!query.exec())
+                {
+                    failedEntries.append(m_CacheEntries[entry]);
+                }
             }
         }
 
-        QSqlDatabase::removeDatabase(QSqlDatabase::defaultConnection);
+        success = success && failedEntries.size() == 0 && db.commit();
+
+        if (!success)
+        {
+            db.rollback();
+        }
     }
+
+    return success;
 }
 
 void DataEntryCache::_moveCachedEntriesToDataSource(int& nrOfEntriesSavedToPrimaryLanguage)
@@ -122,32 +160,23 @@ void DataEntryCache::_moveCachedEntriesToDataSource(int& nrOfEntriesSavedToPrima
 
     if (m_CacheEntries.size() != 0)
     {
-        QVector<DataSource::DataEntry> primaryLanguageEntriesBuffer;
-        QVector<DataSource::DataEntry> secondaryLanguageEntriesBuffer;
+        // all resident languages (not only primary and secondary) need to be updated, otherwise they would become stale
+        QMap<int, QVector<DataSource::DataEntry>> languageEntriesBuffers;
 
         for (int entry{0}; entry < m_LanguageIndexes.size(); ++entry)
         {
-            if (m_LanguageIndexes[entry] == m_pDataSource->getPrimarySourceLanguageIndex())
-            {
-                primaryLanguageEntriesBuffer.append(m_CacheEntries[entry]);
-            }
-            else if (m_LanguageIndexes[entry] == m_pDataSource->getSecondarySourceLanguageIndex())
+            if (m_pDataSource->isLanguageResident(m_LanguageIndexes[entry]))
             {
-                secondaryLanguageEntriesBuffer.append(m_CacheEntries[entry]);
+                languageEntriesBuffers[m_LanguageIndexes[entry]].append(m_CacheEntries[entry]);
             }
         }
 
-        if (primaryLanguageEntriesBuffer.size() != 0)
-        {
-            m_pDataSource->updateDataEntries(primaryLanguageEntriesBuffer, m_pDataSource->getPrimarySourceLanguageIndex(), DataSource::UpdateOperation::APPEND);
-        }
-
-        if (secondaryLanguageEntriesBuffer.size() != 0)
+        for (auto languageEntriesIt{languageEntriesBuffers.cbegin()}; languageEntriesIt != languageEntriesBuffers.cend(); ++languageEntriesIt)
         {
-            m_pDataSource->updateDataEntries(secondaryLanguageEntriesBuffer, m_pDataSource->getSecondarySourceLanguageIndex(), DataSource::UpdateOperation::APPEND);
+            m_pDataSource->updateDataEntries(languageEntriesIt.value(), languageEntriesIt.key(), DataSource::UpdateOperation::APPEND);
         }
 
-        nrOfEntriesSavedToPrimaryLanguage = primaryLanguageEntriesBuffer.size();
+        nrOfEntriesSavedToPrimaryLanguage = languageEntriesBuffers.value(m_pDataSource->getPrimarySourceLanguageIndex()).size();
 
         m_CacheEntries.clear();
         m_LanguageIndexes.clear();
@@ -2,6 +2,7 @@
    This class fulfills following tasks:
    1) Provides temporary storage to the pairs added to game through data entry page and validated by data entry validator
    2) Saves the stored pairs to database and appends them to datasource per user request
+   3) Updates the saving metrics (saves, failures, saved pairs, save latency)
 */
 
 #ifndef DATAENTRYCACHE_H
@@ -11,38 +12,44 @@
 #include <QVector>
 
 #include "datasource.h"
+#include "databaseconnection.h"
+#include "../Utilities/metricsregistry.h"
 
 class DataEntryCache : public QObject
 {
     Q_OBJECT
 public:
-    explicit DataEntryCache(DataSource* pDataSource, QString databasePath, QObject *parent = nullptr);
+    explicit DataEntryCache(DataSource* pDataSource, QString databasePath, const DatabaseConnection::Settings& connectionSettings = DatabaseConnection::Settings{}, QObject *parent = nullptr);
 
     // for testing purposes only
     int getNrOfCachedEntries() const;
 
 public slots:
+    void onOpenDatabaseConnectionRequested();
     void onValidEntryReceived(DataSource::DataEntry dataEntry, int languageIndex);
-    void onResetCacheRequested();
-    void onWriteDataToDbRequested();
+    void onResetCacheRequested(int requestId);
+    void onWriteDataToDbRequested(int requestId);
 
 signals:
     Q_SIGNAL void newWordsPairAddedToCache();
     Q_SIGNAL void wordsPairAlreadyContainedInCache();
-    Q_SIGNAL void cacheReset();
-    Q_SIGNAL void writeDataToDbFinished(int nrOfPrimaryLanguageSavedEntries, int totalNrOfSavedEntries);
-    Q_SIGNAL void writeDataToDbErrorOccured();
+    // each reset/write request is acknowledged by passing its ID back to requester
+    Q_SIGNAL void cacheReset(int requestId);
+    Q_SIGNAL void writeDataToDbFinished(int requestId, int nrOfPrimaryLanguageSavedEntries, int totalNrOfSavedEntries);
+    Q_SIGNAL void writeDataToDbErrorOccured(int requestId, QVector<DataSource::DataEntry> failedEntries);
 
 private:
+    bool _writeCachedEntriesToDb(QVector<DataSource::DataEntry>& failedEntries);
     void _moveCachedEntriesToDataSource(int& nrOfEntriesSavedToPrimaryLanguage);
 
-    static constexpr int sc_WriteDataThreadDelay{1000};
-    static constexpr int sc_ResetCacheDelay{250};
-
     QVector<DataSource::DataEntry> m_CacheEntries;
     QVector<int> m_LanguageIndexes;
     DataSource* m_pDataSource;
-    QString m_DatabasePath;
+    DatabaseConnection m_DatabaseConnection; // kept open for the whole lifetime of the cache thread
+    MetricsRegistry::Counter* m_pSavesCounter;
+    MetricsRegistry::Counter* m_pSaveFailuresCounter;
+    MetricsRegistry::Counter* m_pSavedPairsCounter;
+    MetricsRegistry::Histogram* m_pSaveLatencyHistogram;
 };
 
 #endif // DATAENTRYCACHE_H
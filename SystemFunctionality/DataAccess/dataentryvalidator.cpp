@@ -1,5 +1,13 @@
 #include "dataentryvalidator.h"
 #include "gameutils.h"
+#include "tracer.h"
+
+namespace
+{
+    // metric labels, same order as the invalid codes
+    const QVector<QString> c_InvalidCodeLabels{"less_min_chars_per_word", "less_min_total_pair_chars", "more_max_total_pair_chars", "invalid_characters",
+                                               "pair_already_exists", "identical_words"};
+}
 
 DataEntryValidator::DataEntryValidator(DataSource* pDataSource, QObject *parent)
     : QObject(parent)
@@ -7,10 +15,19 @@ DataEntryValidator::DataEntryValidator(DataSource* pDataSource, QObject *parent)
     , m_pDataSource{pDataSource}
 {
     Q_ASSERT(pDataSource);
+    Q_ASSERT(c_InvalidCodeLabels.size() == static_cast<int>(ValidationCodes::InvalidCodesCount));
+
+    for (const auto& invalidCodeLabel : c_InvalidCodeLabels)
+    {
+        m_RejectedPairsCounters.append(MetricsRegistry::getRegistry()->getCounter("synant_words_pairs_rejected_total", "Words pairs entered by user and rejected by validation.",
+                                                                                    "reason=\"" + invalidCodeLabel + "\""));
+    }
 }
 
 void DataEntryValidator::validateWordsPair(QPair<QString, QString> newWordsPair, bool areSynonyms, int languageIndex)
 {
+    TRACE_SCOPE("DataEntryValidator::validateWordsPair");
+
     DataSource::DataEntry dataEntry;
 
     bool isEntryValid{_isValidDataEntry(dataEntry, newWordsPair.first, newWordsPair.second, areSynonyms, languageIndex)};
@@ -21,6 +38,9 @@ void DataEntryValidator::validateWordsPair(QPair<QString, QString> newWordsPair,
     }
     else
     {
+        Q_ASSERT(m_ValidationCode < ValidationCodes::InvalidCodesCount);
+
+        m_RejectedPairsCounters.at(static_cast<int>(m_ValidationCode))->increment();
         Q_EMIT addInvalidWordsPairRequested();
     }
 }
@@ -30,6 +50,13 @@ uint16_t DataEntryValidator::getInvalidPairReasonCode() const
     return (m_ValidationCode < DataEntryValidator::ValidationCodes::InvalidCodesCount ? sc_InvalidPairBaseReasonCode >> static_cast<uint16_t>(m_ValidationCode) : uint16_t{0xFFFF});
 }
 
+QString DataEntryValidator::getInvalidCodeLabel(ValidationCodes validationCode)
+{
+    Q_ASSERT(validationCode < ValidationCodes::InvalidCodesCount);
+
+    return c_InvalidCodeLabels.at(static_cast<int>(validationCode));
+}
+
 bool DataEntryValidator::isGivenWordsPairValid(const QString &firstWord, const QString &secondWord, bool areSynonyms, int languageIndex)
 {
     DataSource::DataEntry entry;
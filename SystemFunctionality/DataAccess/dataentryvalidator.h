@@ -2,6 +2,7 @@
    This class fulfills following tasks:
    1) Validates the new word pairs added to the game through the data entry page
    2) Stores the validated pairs into the data entry cache
+   3) Counts the rejected pairs per reason (metrics)
 */
 
 #ifndef DATAENTRYVALIDATOR_H
@@ -10,6 +11,7 @@
 #include <QObject>
 
 #include "datasource.h"
+#include "../Utilities/metricsregistry.h"
 
 class DataEntryValidator : public QObject
 {
@@ -33,6 +35,9 @@ public:
     void validateWordsPair(QPair<QString, QString> newWordsPair, bool areSynonyms, int languageIndex);
     uint16_t getInvalidPairReasonCode() const;
 
+    // metric label of each invalid code, shared by all the metrics counting rejections (entered pairs, loaded database rows) so they can be joined
+    static QString getInvalidCodeLabel(ValidationCodes validationCode);
+
     // for testing purposes only
     bool isGivenWordsPairValid(const QString& firstWord, const QString& secondWord, bool areSynonyms, int languageIndex);
 
@@ -47,6 +52,7 @@ private:
 
     ValidationCodes m_ValidationCode;
     DataSource* m_pDataSource;
+    QVector<MetricsRegistry::Counter*> m_RejectedPairsCounters; // one counter per invalid code
 };
 
 #endif // DATAENTRYVALIDATOR_H
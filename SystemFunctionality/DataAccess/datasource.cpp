@@ -1,100 +1,314 @@
 #include <QMutexLocker>
 
+#include <algorithm>
+
 #include "datasource.h"
+#include "tracer.h"
 
 DataSource::DataSource(QObject *parent)
     : QObject (parent)
-    , m_PrimarySource{}
-    , m_SecondarySource{}
-    , m_DataSourceMutex{}
+    , m_pSources{std::make_shared<Sources>()}
+    , m_UpdateMutex{}
+    , m_NrOfPinsPerLanguage{}
+    , m_MaxNrOfResidentLanguages{sc_DefaultMaxNrOfResidentLanguages}
+    , m_MemoryBudget{sc_DefaultMemoryBudget}
+{
+}
+
+void DataSource::setResidencyLimits(int maxNrOfResidentLanguages, qint64 memoryBudget)
+{
+    Q_ASSERT(maxNrOfResidentLanguages >= 2 && memoryBudget >= 0);
+
+    QMutexLocker mutexLocker{&m_UpdateMutex};
+
+    m_MaxNrOfResidentLanguages = maxNrOfResidentLanguages;
+    m_MemoryBudget = memoryBudget;
+
+    std::shared_ptr<Sources> pSources{std::make_shared<Sources>(*_getSources())};
+    _evictLeastRecentlyUsedSources(*pSources);
+    std::atomic_store(&m_pSources, std::shared_ptr<const Sources>{pSources});
+}
+
+bool DataSource::pinLanguage(int languageIndex)
+{
+    QMutexLocker mutexLocker{&m_UpdateMutex};
+
+    // checked under lock so the language cannot get evicted before the pin is taken into account
+    const bool c_IsLanguageResident{_getSources()->findSource(languageIndex) != nullptr};
+
+    if (c_IsLanguageResident)
+    {
+        ++m_NrOfPinsPerLanguage[languageIndex];
+    }
+
+    return c_IsLanguageResident;
+}
+
+void DataSource::unpinLanguage(int languageIndex)
 {
+    QMutexLocker mutexLocker{&m_UpdateMutex};
+
+    auto pinsIt{m_NrOfPinsPerLanguage.find(languageIndex)};
+    Q_ASSERT(pinsIt != m_NrOfPinsPerLanguage.end());
+
+    if (pinsIt != m_NrOfPinsPerLanguage.end() && --pinsIt.value() == 0)
+    {
+        m_NrOfPinsPerLanguage.erase(pinsIt);
+    }
+}
+
+bool DataSource::isLanguagePinned(int languageIndex) const
+{
+    QMutexLocker mutexLocker{&m_UpdateMutex};
+
+    return m_NrOfPinsPerLanguage.contains(languageIndex);
 }
 
-void DataSource::updateDataEntries(const QVector<DataSource::DataEntry>& dataEntries, int languageIndex, DataSource::UpdateOperation updateOperation)
+bool DataSource::updateDataEntries(const QVector<DataSource::DataEntry>& dataEntries, int languageIndex, DataSource::UpdateOperation updateOperation)
 {
-    QMutexLocker mutexLocker{&m_DataSourceMutex};
+    TRACE_SCOPE("DataSource::updateDataEntries");
+
+    QMutexLocker mutexLocker{&m_UpdateMutex};
+
+    bool success{false};
 
     if (languageIndex >= 0)
     {
+        // the new version is built aside (only the chunk pointers get copied) while readers keep on using the currently published one
+        std::shared_ptr<Sources> pSources{std::make_shared<Sources>(*_getSources())};
+
+        const bool c_IsLanguageResident{pSources->findSource(languageIndex) != nullptr};
+        success = true;
+
         switch (updateOperation)
         {
         case DataSource::UpdateOperation::LOAD_TO_PRIMARY:
-            if (m_PrimarySource.languageIndex != -1)
+            // the previous primary source becomes secondary (same as before the residency of multiple languages was introduced)
+            if (pSources->primaryLanguageIndex != -1 && pSources->primaryLanguageIndex != languageIndex)
             {
-                m_SecondarySource.entries = m_PrimarySource.entries;
-                m_SecondarySource.languageIndex = m_PrimarySource.languageIndex;
+                pSources->secondaryLanguageIndex = pSources->primaryLanguageIndex;
             }
-            m_PrimarySource.entries = dataEntries;
-            m_PrimarySource.languageIndex = languageIndex;
+            pSources->setAsMostRecentlyUsed(languageIndex).setEntries(dataEntries);
+            pSources->primaryLanguageIndex = languageIndex;
             break;
         case DataSource::UpdateOperation::LOAD_TO_SECONDARY:
-            m_SecondarySource.entries = dataEntries;
-            m_SecondarySource.languageIndex = languageIndex;
+            pSources->setAsMostRecentlyUsed(languageIndex).setEntries(dataEntries);
+            pSources->secondaryLanguageIndex = languageIndex;
             break;
-        case DataSource::UpdateOperation::SWAP:
+        case DataSource::UpdateOperation::SET_AS_PRIMARY:
             Q_UNUSED(dataEntries);
-            std::swap(m_PrimarySource.entries, m_SecondarySource.entries);
-            std::swap(m_PrimarySource.languageIndex, m_SecondarySource.languageIndex);
+            success = c_IsLanguageResident;
+            if (success)
+            {
+                if (pSources->primaryLanguageIndex != -1 && pSources->primaryLanguageIndex != languageIndex)
+                {
+                    pSources->secondaryLanguageIndex = pSources->primaryLanguageIndex;
+                }
+                pSources->setAsMostRecentlyUsed(languageIndex);
+                pSources->primaryLanguageIndex = languageIndex;
+            }
             break;
-        case DataSource::UpdateOperation::APPEND:
-            Q_ASSERT(m_PrimarySource.languageIndex != m_SecondarySource.languageIndex);
-            if (languageIndex == m_PrimarySource.languageIndex)
+        case DataSource::UpdateOperation::SET_AS_SECONDARY:
+            Q_UNUSED(dataEntries);
+            success = c_IsLanguageResident;
+            if (success)
             {
-                m_PrimarySource.entries.append(dataEntries);
+                pSources->setAsMostRecentlyUsed(languageIndex);
+                pSources->secondaryLanguageIndex = languageIndex;
             }
-            else if (languageIndex == m_SecondarySource.languageIndex)
+            break;
+        case DataSource::UpdateOperation::LOAD_AS_RESIDENT:
+            // not used yet so it only takes free capacity: it gets evicted first (even right away) instead of evicting a language that has actually been used
+            pSources->findOrAddAsLeastRecentlyUsed(languageIndex).setEntries(dataEntries);
+            break;
+        case DataSource::UpdateOperation::UNLOAD:
+            Q_UNUSED(dataEntries);
+            success = c_IsLanguageResident && languageIndex != pSources->primaryLanguageIndex && languageIndex != pSources->secondaryLanguageIndex &&
+                      !m_NrOfPinsPerLanguage.contains(languageIndex);
+            if (success)
             {
-                m_SecondarySource.entries.append(dataEntries);
+                const Source* c_pSource{pSources->findSource(languageIndex)};
+                pSources->residentSources.removeAt(static_cast<int>(c_pSource - pSources->residentSources.constData()));
             }
-            else
+            break;
+        case DataSource::UpdateOperation::APPEND:
+            success = c_IsLanguageResident;
+            if (success)
             {
-                qWarning("Cannot append entries for language index %d as it is not set for any of the sources", languageIndex);
+                pSources->findSource(languageIndex)->appendEntries(dataEntries);
             }
             break;
         }
+
+        if (success)
+        {
+            /* appending doesn't evict so only the loader (single thread) changes the set of resident languages
+               (the languages found resident by the loader remain resident until it requests the next update) */
+            if (updateOperation != DataSource::UpdateOperation::APPEND)
+            {
+                _evictLeastRecentlyUsedSources(*pSources);
+            }
+
+            std::atomic_store(&m_pSources, std::shared_ptr<const Sources>{pSources});
+        }
+        else
+        {
+            qWarning("Cannot update the entries for language index %d (not resident or in use)", languageIndex);
+        }
     }
+
+    return success;
 }
 
 void DataSource::provideDataEntryToConsumer(int entryNumber)
 {
-    QMutexLocker mutexLocker{&m_DataSourceMutex};
+    const std::shared_ptr<const Sources> c_pSources{_getSources()};
+    const Source* c_pPrimarySource{c_pSources->findSource(c_pSources->primaryLanguageIndex)};
 
-    Q_ASSERT(entryNumber >= 0 && entryNumber < m_PrimarySource.entries.size());
+    Q_ASSERT(c_pPrimarySource && entryNumber >= 0 && entryNumber < c_pPrimarySource->nrOfEntries);
 
-    DataEntry fetchedDataEntry{m_PrimarySource.entries[entryNumber]};
+    DataEntry fetchedDataEntry{c_pPrimarySource->getEntry(entryNumber)};
     Q_EMIT entryProvidedToConsumer(QPair<QString, QString>(fetchedDataEntry.firstWord, fetchedDataEntry.secondWord), fetchedDataEntry.areSynonyms);
 }
 
+bool DataSource::getPrimarySourceDataEntry(int entryNumber, int languageIndex, DataSource::DataEntry& dataEntry) const
+{
+    // language and range are checked against the same published version the entry is read from
+    const std::shared_ptr<const Sources> c_pSources{_getSources()};
+    const Source* c_pPrimarySource{c_pSources->findSource(c_pSources->primaryLanguageIndex)};
+    const bool c_IsEntryAvailable{c_pPrimarySource && languageIndex == c_pSources->primaryLanguageIndex && entryNumber >= 0 && entryNumber < c_pPrimarySource->nrOfEntries};
+
+    if (c_IsEntryAvailable)
+    {
+        dataEntry = c_pPrimarySource->getEntry(entryNumber);
+    }
+
+    return c_IsEntryAvailable;
+}
+
+bool DataSource::getDataEntry(int entryNumber, int languageIndex, DataSource::DataEntry& dataEntry) const
+{
+    const std::shared_ptr<const Sources> c_pSources{_getSources()};
+    const Source* c_pSource{c_pSources->findSource(languageIndex)};
+    const bool c_IsEntryAvailable{c_pSource && entryNumber >= 0 && entryNumber < c_pSource->nrOfEntries};
+
+    if (c_IsEntryAvailable)
+    {
+        dataEntry = c_pSource->getEntry(entryNumber);
+    }
+
+    return c_IsEntryAvailable;
+}
+
 int DataSource::getPrimarySourceLanguageIndex() const
 {
-    QMutexLocker mutexLocker{&m_DataSourceMutex};
-    return m_PrimarySource.languageIndex;
+    return _getSources()->primaryLanguageIndex;
 }
 
 int DataSource::getSecondarySourceLanguageIndex() const
 {
-    QMutexLocker mutexLocker{&m_DataSourceMutex};
-    return m_SecondarySource.languageIndex;
+    return _getSources()->secondaryLanguageIndex;
 }
 
 int DataSource::getPrimarySourceNrOfEntries() const
 {
-    QMutexLocker mutexLocker{&m_DataSourceMutex};
-    return m_PrimarySource.entries.size();
+    // language index and entries read from the same snapshot, a concurrent language switch cannot mix them up
+    const std::shared_ptr<const Sources> c_pSources{_getSources()};
+    const Source* c_pSource{c_pSources->findSource(c_pSources->primaryLanguageIndex)};
+
+    return c_pSource ? c_pSource->nrOfEntries : 0;
 }
 
 int DataSource::getSecondarySourceNrOfEntries() const
 {
-    QMutexLocker mutexLocker{&m_DataSourceMutex};
-    return m_SecondarySource.entries.size();
+    const std::shared_ptr<const Sources> c_pSources{_getSources()};
+    const Source* c_pSource{c_pSources->findSource(c_pSources->secondaryLanguageIndex)};
+
+    return c_pSource ? c_pSource->nrOfEntries : 0;
+}
+
+bool DataSource::isLanguageResident(int languageIndex) const
+{
+    return _getSources()->findSource(languageIndex) != nullptr;
+}
+
+int DataSource::getNrOfEntries(int languageIndex) const
+{
+    const std::shared_ptr<const Sources> c_pSources{_getSources()};
+    const Source* c_pSource{c_pSources->findSource(languageIndex)};
+
+    return c_pSource ? c_pSource->nrOfEntries : 0;
+}
+
+QVector<int> DataSource::getResidentLanguageIndexes() const
+{
+    QVector<int> residentLanguageIndexes;
+
+    for (const auto& source : _getSources()->residentSources)
+    {
+        residentLanguageIndexes.append(source.languageIndex);
+    }
+
+    return residentLanguageIndexes;
+}
+
+qint64 DataSource::getMemoryUsage() const
+{
+    const std::shared_ptr<const Sources> c_pSources{_getSources()};
+    qint64 memoryUsage{0};
+
+    for (const auto& source : c_pSources->residentSources)
+    {
+        memoryUsage += source.getMemoryUsage();
+    }
+
+    return memoryUsage;
 }
 
 bool DataSource::entryAlreadyExists(const DataSource::DataEntry &dataEntry, int languageIndex)
 {
-    QMutexLocker mutexLocker{&m_DataSourceMutex};
-    return languageIndex == m_PrimarySource.languageIndex ? m_PrimarySource.entries.contains(dataEntry)
-                                                          : languageIndex == m_SecondarySource.languageIndex ? m_SecondarySource.entries.contains(dataEntry)
-                                                                                                             : false;
+    const std::shared_ptr<const Sources> c_pSources{_getSources()};
+    const Source* c_pSource{c_pSources->findSource(languageIndex)};
+
+    return c_pSource ? c_pSource->containsEntry(dataEntry) : false;
+}
+
+std::shared_ptr<const DataSource::Sources> DataSource::_getSources() const
+{
+    return std::atomic_load(&m_pSources);
+}
+
+void DataSource::_evictLeastRecentlyUsedSources(DataSource::Sources& sources) const
+{
+    qint64 memoryUsage{0};
+
+    for (const auto& source : sources.residentSources)
+    {
+        memoryUsage += source.getMemoryUsage();
+    }
+
+    // the sources that are still used by readers (previously published versions) only get released once these versions are no longer referenced
+    for (int sourceIndex{static_cast<int>(sources.residentSources.size()) - 1};
+         sourceIndex >= 0 && (sources.residentSources.size() > m_MaxNrOfResidentLanguages || memoryUsage > m_MemoryBudget);
+         --sourceIndex)
+    {
+        const Source& c_Source{sources.residentSources.at(sourceIndex)};
+
+        if (c_Source.languageIndex != sources.primaryLanguageIndex && c_Source.languageIndex != sources.secondaryLanguageIndex &&
+            !m_NrOfPinsPerLanguage.contains(c_Source.languageIndex))
+        {
+            memoryUsage -= c_Source.getMemoryUsage();
+            sources.residentSources.removeAt(sourceIndex);
+        }
+    }
+}
+
+uint DataSource::_getEntryKey(QStringView firstWord, QStringView secondWord)
+{
+    const uint c_FirstWordHash{static_cast<uint>(qHash(firstWord))};
+    const uint c_SecondWordHash{static_cast<uint>(qHash(secondWord))};
+
+    return c_FirstWordHash < c_SecondWordHash ? c_FirstWordHash * 31u + c_SecondWordHash : c_SecondWordHash * 31u + c_FirstWordHash;
 }
 
 DataSource::DataEntry::DataEntry()
@@ -114,8 +328,214 @@ bool DataSource::DataEntry::operator==(const DataSource::DataEntry& dataEntry) c
     return ((firstWord == dataEntry.firstWord && secondWord == dataEntry.secondWord) || (firstWord == dataEntry.secondWord && secondWord == dataEntry.firstWord));
 }
 
+DataSource::Chunk::Chunk(const QVector<DataSource::DataEntry>& dataEntries)
+{
+    entryRecords.reserve(dataEntries.size());
+    entryKeys.reserve(dataEntries.size());
+
+    for (const auto& dataEntry : dataEntries)
+    {
+        _appendEntry(dataEntry.firstWord, dataEntry.secondWord, dataEntry.areSynonyms);
+    }
+}
+
+DataSource::Chunk::Chunk(const DataSource::Chunk& olderChunk, const DataSource::Chunk& newerChunk)
+{
+    words.reserve(olderChunk.words.size() + newerChunk.words.size());
+    entryRecords.reserve(olderChunk.getNrOfEntries() + newerChunk.getNrOfEntries());
+    entryKeys.reserve(olderChunk.getNrOfEntries() + newerChunk.getNrOfEntries());
+
+    for (const auto* pChunk : {&olderChunk, &newerChunk})
+    {
+        for (const auto& entryRecord : pChunk->entryRecords)
+        {
+            _appendEntry(pChunk->getFirstWord(entryRecord), pChunk->getSecondWord(entryRecord), entryRecord.areSynonyms);
+        }
+    }
+}
+
+bool DataSource::Chunk::containsEntry(const DataSource::DataEntry& dataEntry) const
+{
+    bool isEntryContained{false};
+
+    // entries with same hash are compared by words (in both orders) against the arena
+    const auto c_SameKeyEntries{entryKeys.equal_range(_getEntryKey(dataEntry.firstWord, dataEntry.secondWord))};
+
+    for (auto entryIt{c_SameKeyEntries.first}; entryIt != c_SameKeyEntries.second; ++entryIt)
+    {
+        const EntryRecord& c_EntryRecord{entryRecords.at(entryIt.value())};
+        const QStringView c_FirstWord{getFirstWord(c_EntryRecord)};
+        const QStringView c_SecondWord{getSecondWord(c_EntryRecord)};
+
+        if ((c_FirstWord == QStringView{dataEntry.firstWord} && c_SecondWord == QStringView{dataEntry.secondWord}) ||
+            (c_FirstWord == QStringView{dataEntry.secondWord} && c_SecondWord == QStringView{dataEntry.firstWord}))
+        {
+            isEntryContained = true;
+            break;
+        }
+    }
+
+    return isEntryContained;
+}
+
+DataSource::DataEntry DataSource::Chunk::getEntry(int entryNumber) const
+{
+    const EntryRecord& c_EntryRecord{entryRecords.at(entryNumber)};
+
+    return DataEntry{getFirstWord(c_EntryRecord).toString(), getSecondWord(c_EntryRecord).toString(), c_EntryRecord.areSynonyms};
+}
+
+int DataSource::Chunk::getNrOfEntries() const
+{
+    return entryRecords.size();
+}
+
+qint64 DataSource::Chunk::getMemoryUsage() const
+{
+    // hash node: key, value and (roughly) two pointers
+    return words.size() * static_cast<qint64>(sizeof(QChar)) +
+           entryRecords.size() * static_cast<qint64>(sizeof(EntryRecord)) +
+           entryKeys.size() * static_cast<qint64>(sizeof(uint) + sizeof(int) + 2 * sizeof(void*));
+}
+
+QStringView DataSource::Chunk::getFirstWord(const EntryRecord& entryRecord) const
+{
+    return QStringView{words.constData() + entryRecord.firstWordPosition, entryRecord.firstWordSize};
+}
+
+QStringView DataSource::Chunk::getSecondWord(const EntryRecord& entryRecord) const
+{
+    return QStringView{words.constData() + entryRecord.firstWordPosition + entryRecord.firstWordSize, entryRecord.secondWordSize};
+}
+
+void DataSource::Chunk::_appendEntry(QStringView firstWord, QStringView secondWord, bool areSynonyms)
+{
+    Q_ASSERT(firstWord.size() <= 0xFFFF && secondWord.size() <= 0xFFFF);
+
+    const EntryRecord c_EntryRecord{static_cast<int>(words.size()), static_cast<quint16>(firstWord.size()), static_cast<quint16>(secondWord.size()), areSynonyms};
+
+    words.append(firstWord.data(), static_cast<int>(firstWord.size()));
+    words.append(secondWord.data(), static_cast<int>(secondWord.size()));
+    entryKeys.insert(_getEntryKey(firstWord, secondWord), entryRecords.size());
+    entryRecords.append(c_EntryRecord);
+}
+
 DataSource::Source::Source()
     : languageIndex{-1}
-    , entries{}
+    , nrOfEntries{0}
+    , chunks{}
+    , chunkFirstEntryNumbers{}
+{
+}
+
+void DataSource::Source::setEntries(const QVector<DataSource::DataEntry>& dataEntries)
 {
+    nrOfEntries = 0;
+    chunks.clear();
+    chunkFirstEntryNumbers.clear();
+
+    appendEntries(dataEntries);
+}
+
+/* appending is copy-on-write at chunk level: the new entries get into a new chunk, the existing chunks remain untouched (they might still be used by readers)
+   the new chunk is merged with the previous ones as long as these are not larger, which keeps the number of chunks (and so the lookup cost) logarithmic */
+void DataSource::Source::appendEntries(const QVector<DataSource::DataEntry>& dataEntries)
+{
+    if (dataEntries.size() != 0)
+    {
+        std::shared_ptr<const Chunk> pNewChunk{std::make_shared<Chunk>(dataEntries)};
+
+        while (chunks.size() != 0 && chunks.last()->getNrOfEntries() <= pNewChunk->getNrOfEntries())
+        {
+            pNewChunk = std::make_shared<Chunk>(*chunks.last(), *pNewChunk);
+            chunks.removeLast();
+            chunkFirstEntryNumbers.removeLast();
+        }
+
+        nrOfEntries += dataEntries.size();
+        chunkFirstEntryNumbers.append(nrOfEntries - pNewChunk->getNrOfEntries());
+        chunks.append(pNewChunk);
+    }
+}
+
+bool DataSource::Source::containsEntry(const DataSource::DataEntry& dataEntry) const
+{
+    return std::any_of(chunks.cbegin(), chunks.cend(), [&dataEntry](const std::shared_ptr<const Chunk>& pChunk) {return pChunk->containsEntry(dataEntry);});
+}
+
+DataSource::DataEntry DataSource::Source::getEntry(int entryNumber) const
+{
+    Q_ASSERT(entryNumber >= 0 && entryNumber < nrOfEntries);
+
+    // last chunk whose first entry number is not greater than the requested one
+    const int c_ChunkIndex{static_cast<int>(std::upper_bound(chunkFirstEntryNumbers.cbegin(), chunkFirstEntryNumbers.cend(), entryNumber) - chunkFirstEntryNumbers.cbegin()) - 1};
+
+    return chunks.at(c_ChunkIndex)->getEntry(entryNumber - chunkFirstEntryNumbers.at(c_ChunkIndex));
+}
+
+qint64 DataSource::Source::getMemoryUsage() const
+{
+    qint64 memoryUsage{0};
+
+    for (const auto& pChunk : chunks)
+    {
+        memoryUsage += pChunk->getMemoryUsage();
+    }
+
+    return memoryUsage;
+}
+
+DataSource::Sources::Sources()
+    : residentSources{}
+    , primaryLanguageIndex{-1}
+    , secondaryLanguageIndex{-1}
+{
+}
+
+const DataSource::Source* DataSource::Sources::findSource(int languageIndex) const
+{
+    const auto c_SourceIt{std::find_if(residentSources.cbegin(), residentSources.cend(), [languageIndex](const Source& source) {return source.languageIndex == languageIndex;})};
+
+    return c_SourceIt != residentSources.cend() ? &(*c_SourceIt) : nullptr;
+}
+
+DataSource::Source* DataSource::Sources::findSource(int languageIndex)
+{
+    // non-const access detaches the sources from the published version (implicitly shared container)
+    const auto c_SourceIt{std::find_if(residentSources.begin(), residentSources.end(), [languageIndex](const Source& source) {return source.languageIndex == languageIndex;})};
+
+    return c_SourceIt != residentSources.end() ? &(*c_SourceIt) : nullptr;
+}
+
+DataSource::Source& DataSource::Sources::setAsMostRecentlyUsed(int languageIndex)
+{
+    const Source* c_pSource{static_cast<const Sources*>(this)->findSource(languageIndex)};
+
+    if (c_pSource)
+    {
+        residentSources.move(static_cast<int>(c_pSource - residentSources.constData()), 0);
+    }
+    else
+    {
+        Source source;
+        source.languageIndex = languageIndex;
+        residentSources.prepend(source);
+    }
+
+    return residentSources.first();
+}
+
+DataSource::Source& DataSource::Sources::findOrAddAsLeastRecentlyUsed(int languageIndex)
+{
+    Source* pSource{findSource(languageIndex)};
+
+    if (!pSource)
+    {
+        Source source;
+        source.languageIndex = languageIndex;
+        residentSources.append(source);
+        pSource = &residentSources.last();
+    }
+
+    return *pSource;
 }
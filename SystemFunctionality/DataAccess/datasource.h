@@ -2,6 +2,10 @@
    This class fulfills following tasks:
    1) Stores the valid entries from the game database so they are immediately available per user request
    2) Based on a received valid entry number it hands over the requested data entry to the consumer class (WordMixer).
+   3) Keeps the words of a language in contiguous buffers (arenas) referenced by compact per-entry records instead of storing two separately allocated strings per entry
+   4) Publishes the sources as immutable snapshots which are atomically replaced by writers, so readers (e.g. GUI thread) never block
+   5) Keeps the recently used languages resident (LRU eviction within configurable limits), the primary (game) and secondary (data entry) sources being views over the resident languages
+   6) Keeps the languages pinned by their users (e.g. game sessions) resident until all pins are released
 */
 
 #ifndef DATASOURCE_H
@@ -9,7 +13,12 @@
 
 #include <QObject>
 #include <QVector>
+#include <QHash>
+#include <QPair>
 #include <QMutex>
+#include <QStringView>
+
+#include <memory>
 
 class DataSource : public QObject
 {
@@ -31,37 +40,126 @@ public:
     {
         LOAD_TO_PRIMARY,
         LOAD_TO_SECONDARY,
-        SWAP,
+        SET_AS_PRIMARY,     // language should already be resident
+        SET_AS_SECONDARY,   // language should already be resident
+        LOAD_AS_RESIDENT,   // language is kept resident without becoming primary or secondary (e.g. preloading), as least recently used until set as primary/secondary
+        UNLOAD,             // primary, secondary and pinned languages cannot be unloaded
         APPEND,
     };
 
     explicit DataSource(QObject *parent = nullptr);
 
-    void updateDataEntries(const QVector<DataEntry>& dataEntries, int languageIndex, DataSource::UpdateOperation updateOperation = DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+    // the primary, secondary and pinned languages are never evicted, even if the limits are exceeded
+    void setResidencyLimits(int maxNrOfResidentLanguages, qint64 memoryBudget);
+
+    /* thread safe, each successful pin should be released by an unpin call (pins are counted per language)
+       pinning fails if the language is not resident, unpinning doesn't evict (the limits are applied again by the next update) */
+    bool pinLanguage(int languageIndex);
+    void unpinLanguage(int languageIndex);
+    bool isLanguagePinned(int languageIndex) const;
+
+    // returns false if the operation cannot be performed (language not resident)
+    bool updateDataEntries(const QVector<DataEntry>& dataEntries, int languageIndex, DataSource::UpdateOperation updateOperation = DataSource::UpdateOperation::LOAD_TO_PRIMARY);
     void provideDataEntryToConsumer(int entryNumber);
 
+    // thread safe alternative to provideDataEntryToConsumer(), fails if the primary source got changed to another language or the entry number is out of range
+    bool getPrimarySourceDataEntry(int entryNumber, int languageIndex, DataEntry& dataEntry) const;
+
+    // thread safe, any resident language can be read (e.g. by game sessions playing other languages than the primary one)
+    bool getDataEntry(int entryNumber, int languageIndex, DataEntry& dataEntry) const;
+
     int getPrimarySourceLanguageIndex() const;
     int getSecondarySourceLanguageIndex() const;
     int getPrimarySourceNrOfEntries() const;
     int getSecondarySourceNrOfEntries() const;
 
+    bool isLanguageResident(int languageIndex) const;
+    int getNrOfEntries(int languageIndex) const;
+    QVector<int> getResidentLanguageIndexes() const; // most recently used first
+    qint64 getMemoryUsage() const; // estimated (bytes), all resident languages
+
     bool entryAlreadyExists(const DataEntry& dataEntry, int languageIndex);
 
 signals:
     Q_SIGNAL void entryProvidedToConsumer(QPair<QString, QString> newWordsPair, bool areSynonyms);
 
 private:
+    // the words of an entry are stored next to each other within the buffer, the second one starting right after the first one
+    struct EntryRecord
+    {
+        int firstWordPosition;
+        quint16 firstWordSize;
+        quint16 secondWordSize;
+        bool areSynonyms;
+    };
+
+    // immutable once created, shared by all published source versions that contain it
+    struct Chunk
+    {
+        explicit Chunk(const QVector<DataEntry>& dataEntries);
+        Chunk(const Chunk& olderChunk, const Chunk& newerChunk); // merges the chunks by keeping the entries order
+
+        bool containsEntry(const DataEntry& dataEntry) const;
+        DataEntry getEntry(int entryNumber) const;
+        int getNrOfEntries() const;
+        qint64 getMemoryUsage() const; // estimated
+
+        QStringView getFirstWord(const EntryRecord& entryRecord) const;
+        QStringView getSecondWord(const EntryRecord& entryRecord) const;
+
+        QString words;                     // arena: all words of the chunk, without separators
+        QVector<EntryRecord> entryRecords;
+        QMultiHash<uint, int> entryKeys;   // entry key hash to (chunk) entry number, used for fast duplicate checks
+
+    private:
+        void _appendEntry(QStringView firstWord, QStringView secondWord, bool areSynonyms);
+    };
+
+    // copying a source only copies the chunk pointers, the entries themselves are shared
     struct Source
     {
         Source();
 
+        void setEntries(const QVector<DataEntry>& dataEntries);
+        void appendEntries(const QVector<DataEntry>& dataEntries);
+        bool containsEntry(const DataEntry& dataEntry) const;
+        DataEntry getEntry(int entryNumber) const;
+        qint64 getMemoryUsage() const;
+
         int languageIndex;
-        QVector<DataEntry> entries;
+        int nrOfEntries;
+        QVector<std::shared_ptr<const Chunk>> chunks; // oldest entries first, each chunk is larger than the next one (see appendEntries())
+        QVector<int> chunkFirstEntryNumbers;
     };
 
-    Source m_PrimarySource;
-    Source m_SecondarySource;
-    mutable QMutex m_DataSourceMutex;
+    struct Sources
+    {
+        Sources();
+
+        const Source* findSource(int languageIndex) const;
+        Source* findSource(int languageIndex);
+        Source& setAsMostRecentlyUsed(int languageIndex); // the source gets created if not resident
+        Source& findOrAddAsLeastRecentlyUsed(int languageIndex); // the source keeps its position if resident
+
+        QVector<Source> residentSources; // most recently used first
+        int primaryLanguageIndex;
+        int secondaryLanguageIndex;
+    };
+
+    std::shared_ptr<const Sources> _getSources() const;
+    void _evictLeastRecentlyUsedSources(Sources& sources) const;
+
+    // same hash no matter which of the words is first (same logic as DataEntry::operator==)
+    static uint _getEntryKey(QStringView firstWord, QStringView secondWord);
+
+    std::shared_ptr<const Sources> m_pSources; // should only be accessed by using the atomic shared pointer operations
+    mutable QMutex m_UpdateMutex;             // only serializes the writers (and the pin updates), the readers access the published sources without locking
+    QHash<int, int> m_NrOfPinsPerLanguage;    // only pinned languages are contained
+    int m_MaxNrOfResidentLanguages;
+    qint64 m_MemoryBudget;                    // bytes
+
+    static constexpr int sc_DefaultMaxNrOfResidentLanguages{4};
+    static constexpr qint64 sc_DefaultMemoryBudget{256 * 1024 * 1024};
 };
 
 Q_DECLARE_METATYPE(DataSource::DataEntry)
@@ -2,6 +2,7 @@
 
 DataSourceAccessHelper::DataSourceAccessHelper(QObject *parent)
     : QObject(parent)
+    , m_NrOfUsedEntries{0}
 {
     std::random_device randomDevice{};
     m_ChooseEntryNumberEngine.seed(randomDevice());
@@ -11,74 +12,95 @@ void DataSourceAccessHelper::setEntriesTable(int nrOfEntries)
 {
     if (nrOfEntries > 0)
     {
-        m_EntryUsedStatuses.fill(false, nrOfEntries);
+        m_EntryNumbers.clear();
+        m_EntryNumbers.reserve(nrOfEntries);
+        m_NrOfUsedEntries = 0;
+        _appendEntryNumbers(nrOfEntries);
     }
 }
 
 void DataSourceAccessHelper::resetUsedEntries()
 {
-    m_EntryUsedStatuses.fill(false, m_EntryUsedStatuses.size());
+    // no need to restore the initial order, the remaining permutation is as good as any other for random picking
+    m_NrOfUsedEntries = 0;
 }
 
 void DataSourceAccessHelper::addEntriesToTable(int nrOfEntries)
 {
     if (nrOfEntries > 0)
     {
-        QVector<bool> newEntriesUsedStatuses;
-        newEntriesUsedStatuses.fill(false, nrOfEntries);
-        m_EntryUsedStatuses.append(newEntriesUsedStatuses);
+        _appendEntryNumbers(nrOfEntries);
     }
 }
 
 void DataSourceAccessHelper::clearEntriesTable()
 {
-    if (m_EntryUsedStatuses.size() != 0)
+    if (m_EntryNumbers.size() != 0)
     {
-        m_EntryUsedStatuses.clear();
-        m_EntryUsedStatuses.squeeze();
+        m_EntryNumbers.clear();
+        m_EntryNumbers.squeeze();
+        m_NrOfUsedEntries = 0;
     }
 }
 
 int DataSourceAccessHelper::generateEntryNumber()
 {
-    Q_ASSERT(m_EntryUsedStatuses.size() > 0);
+    Q_ASSERT(m_EntryNumbers.size() > 0);
 
-    // static_cast required to solve compiling error (normally there should be no overflow - to be refactored to use size_t if required)
-    int alreadyAccessedEntriesCount{static_cast<int>(m_EntryUsedStatuses.count(true))};
-
-    if (alreadyAccessedEntriesCount == m_EntryUsedStatuses.size())
+    if (m_NrOfUsedEntries == m_EntryNumbers.size())
     {
-        m_EntryUsedStatuses.fill(false);
-        alreadyAccessedEntriesCount = 0;
+        m_NrOfUsedEntries = 0;
     }
 
-    // same note regarding static_cast as above
-    std::uniform_int_distribution<int> chooseEntryNumberDist{0, static_cast<int>(m_EntryUsedStatuses.size()) - alreadyAccessedEntriesCount - 1};
+    // pick a random entry from the available ones and move it to the used area by swapping it with the first available entry
+    std::uniform_int_distribution<int> chooseEntryNumberDist{m_NrOfUsedEntries, m_EntryNumbers.size() - 1};
 
-    int chosenAvailableEntryRelativeNr{chooseEntryNumberDist(m_ChooseEntryNumberEngine)};
-    int chosenAvailableEntryAbsoluteNr{-1};
+    int chosenAvailableEntryPosition{chooseEntryNumberDist(m_ChooseEntryNumberEngine)};
+    std::swap(m_EntryNumbers[chosenAvailableEntryPosition], m_EntryNumbers[m_NrOfUsedEntries]);
 
-    for (int iterationNr{0}; iterationNr <= chosenAvailableEntryRelativeNr; ++iterationNr)
-    {
-        ++chosenAvailableEntryAbsoluteNr;
+    return m_EntryNumbers[m_NrOfUsedEntries++];
+}
 
-        while(m_EntryUsedStatuses[chosenAvailableEntryAbsoluteNr])
+bool DataSourceAccessHelper::releaseEntryNumber(int entryNumber)
+{
+    bool released{false};
+
+    // the released entry numbers are usually the last generated ones, so searching starts from the end of the used area
+    for (int usedEntryPosition{m_NrOfUsedEntries - 1}; usedEntryPosition >= 0; --usedEntryPosition)
+    {
+        if (m_EntryNumbers[usedEntryPosition] == entryNumber)
         {
-            ++chosenAvailableEntryAbsoluteNr;
+            --m_NrOfUsedEntries;
+            std::swap(m_EntryNumbers[usedEntryPosition], m_EntryNumbers[m_NrOfUsedEntries]);
+            released = true;
+            break;
         }
     }
 
-    m_EntryUsedStatuses[chosenAvailableEntryAbsoluteNr] = true;
+    return released;
+}
 
-    return chosenAvailableEntryAbsoluteNr;
+void DataSourceAccessHelper::setSeed(quint32 seed)
+{
+    m_ChooseEntryNumberEngine.seed(seed);
 }
 
 int DataSourceAccessHelper::getNrOfUsedEntries() const
 {
-    return m_EntryUsedStatuses.count(true);
+    return m_NrOfUsedEntries;
 }
 
 int DataSourceAccessHelper::getTotalNrOfEntries() const
 {
-    return m_EntryUsedStatuses.size();
+    return m_EntryNumbers.size();
+}
+
+void DataSourceAccessHelper::_appendEntryNumbers(int nrOfEntries)
+{
+    const int c_FirstNewEntryNumber{m_EntryNumbers.size()};
+
+    for (int entryNumber{c_FirstNewEntryNumber}; entryNumber < c_FirstNewEntryNumber + nrOfEntries; ++entryNumber)
+    {
+        m_EntryNumbers.append(entryNumber);
+    }
 }
@@ -2,6 +2,7 @@
    This class fulfills following tasks:
    1) Supports the facade connection to the DataSource.
    2) Generates a random (but valid and still not requested) entry number based on which the DataSource delivers the required data to the consumer.
+   3) Takes back the generated entry numbers which have not been consumed.
 */
 
 #ifndef DATASOURCEACCESS_H
@@ -24,12 +25,23 @@ public:
     void clearEntriesTable();
     int generateEntryNumber();
 
+    // makes a generated but unconsumed entry number (e.g. discarded prefetch) available again, returns false if it is not in use (anymore)
+    bool releaseEntryNumber(int entryNumber);
+
+    // same seed and same sequence of table operations result in the same sequence of entry numbers
+    void setSeed(quint32 seed);
+
     int getNrOfUsedEntries() const;
     int getTotalNrOfEntries() const;
 
 private:
+    void _appendEntryNumbers(int nrOfEntries);
+
     std::default_random_engine m_ChooseEntryNumberEngine;
-    QVector<bool> m_EntryUsedStatuses;
+
+    // partial Fisher-Yates permutation of all entry numbers: the first m_NrOfUsedEntries are used, the remaining ones are still available
+    QVector<int> m_EntryNumbers;
+    int m_NrOfUsedEntries;
 };
 
 #endif // DATASOURCEACCESS_H
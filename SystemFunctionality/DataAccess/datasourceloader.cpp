@@ -1,202 +1,509 @@
 #include <QVector>
-#include <QThread>
 #include <QSqlDatabase>
-#include <QSqlField>
 #include <QSqlQuery>
+#include <QSqlError>
 #include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QThread>
+#include <QElapsedTimer>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <numeric>
 
 #include "datasourceloader.h"
 #include "gameutils.h"
 #include "databaseutils.h"
+#include "tracer.h"
 
-DataSourceLoader::DataSourceLoader(DataSource* pDataSource, QString databasePath, QObject *parent)
+DataSourceLoader::DataSourceLoader(DataSource* pDataSource, QString databasePath, const DatabaseConnection::Settings& connectionSettings, QObject *parent)
     : QObject(parent)
+    , m_NrOfRejectedEntries(static_cast<int>(DataEntryValidator::ValidationCodes::InvalidCodesCount), 0)
+    , m_NrOfPushedEntries{0}
     , m_pDataSource{pDataSource}
-    , m_DatabasePath{databasePath}
+    , m_DatabaseConnection{Database::Connection::c_LoaderConnectionName, databasePath, connectionSettings}
+    , m_IsPreloadCancelRequested{0}
+    , m_pDatabaseLoadsCounter{MetricsRegistry::getRegistry()->getCounter("synant_language_loads_total", "Languages loaded (entirely).", "source=\"database\"")}
+    , m_pSnapshotLoadsCounter{MetricsRegistry::getRegistry()->getCounter("synant_language_loads_total", "Languages loaded (entirely).", "source=\"snapshot\"")}
+    , m_pResidentLanguageHitsCounter{MetricsRegistry::getRegistry()->getCounter("synant_language_cache_hits_total", "Language requests served by the data source without loading.")}
+    , m_pReadRowsCounter{MetricsRegistry::getRegistry()->getCounter("synant_database_rows_read_total", "Rows read from database when loading languages.")}
+    , m_pLoadLatencyHistogram{MetricsRegistry::getRegistry()->getHistogram("synant_language_load_latency_seconds", "Time required for loading a language.")}
 {
     Q_ASSERT(m_pDataSource);
     Q_ASSERT(QFile{databasePath}.exists());
+
+    // same labels as for the pairs entered by user (existing pairs are not rejected by loader)
+    for (int rejectionCode{0}; rejectionCode < static_cast<int>(DataEntryValidator::ValidationCodes::InvalidCodesCount); ++rejectionCode)
+    {
+        const QString c_RejectionReason{DataEntryValidator::getInvalidCodeLabel(static_cast<DataEntryValidator::ValidationCodes>(rejectionCode))};
+
+        m_RejectedRowsCounters.append(MetricsRegistry::getRegistry()->getCounter("synant_database_rows_rejected_total", "Database rows rejected by validation (either by the load query or by the loader).",
+                                                                                   "reason=\"" + c_RejectionReason + "\""));
+    }
+}
+
+int DataSourceLoader::getNrOfRejectedEntries(DataEntryValidator::ValidationCodes rejectionCode) const
+{
+    Q_ASSERT(rejectionCode < DataEntryValidator::ValidationCodes::InvalidCodesCount);
+
+    return m_NrOfRejectedEntries.at(static_cast<int>(rejectionCode));
+}
+
+void DataSourceLoader::cancelPreload()
+{
+    m_IsPreloadCancelRequested.storeRelease(1);
+}
+
+void DataSourceLoader::onOpenDatabaseConnectionRequested()
+{
+    // the connection should be opened within the loader thread as it can only be used by the thread that created it
+    if (!m_DatabaseConnection.open())
+    {
+        qWarning("Cannot open the data source loader database connection, another attempt will be made when loading data");
+    }
 }
 
-void DataSourceLoader::onLoadDataFromDbForPrimaryLanguageRequested(int languageIndex, bool allowEmptyResult)
+void DataSourceLoader::onLoadDataFromDbForPrimaryLanguageRequested(int requestId, int languageIndex, bool allowEmptyResult)
 {
-    if (languageIndex >= 0 && m_pDataSource->getPrimarySourceLanguageIndex() != languageIndex)
+    // the preloads queued before this request have already been aborted, the ones requested afterwards are allowed
+    m_IsPreloadCancelRequested.storeRelease(0);
+
+    if (languageIndex < 0 || languageIndex >= Database::Query::c_LanguageCodes.size())
+    {
+        qWarning("Invalid language index requested: %d", languageIndex);
+
+        // an invalid request is still acknowledged (as failed) so the requester doesn't keep waiting for it
+        Q_EMIT loadDataFromDbForPrimaryLanguageFinished(requestId, false, false);
+    }
+    else if (m_pDataSource->getPrimarySourceLanguageIndex() == languageIndex)
     {
-        if (m_pDataSource->getSecondarySourceLanguageIndex() == languageIndex)
+        m_pResidentLanguageHitsCounter->increment();
+
+        /* nothing to load but the request still needs to be acknowledged: the requester (facade) resets its data before each request
+           and waits for the acknowledgement to start using the (unchanged) primary language again */
+        Q_EMIT requestedPrimaryLanguageAlreadyContainedInDataSource(requestId, m_pDataSource->getPrimarySourceNrOfEntries() != 0);
+    }
+    else if (m_pDataSource->isLanguageResident(languageIndex))
+    {
+        // any recently used language (not only the secondary one) is still resident so it can be used without reloading
+        m_pResidentLanguageHitsCounter->increment();
+
+        bool areEntriesAvailable{m_pDataSource->getNrOfEntries(languageIndex) != 0};
+
+        if (areEntriesAvailable || allowEmptyResult)
         {
-            bool areEntriesAvailable{m_pDataSource->getSecondarySourceNrOfEntries() != 0};
+            m_pDataSource->updateDataEntries(QVector<DataSource::DataEntry>{}, languageIndex, DataSource::UpdateOperation::SET_AS_PRIMARY);
+        }
 
-            if (areEntriesAvailable || allowEmptyResult)
-            {
-                m_pDataSource->updateDataEntries(QVector<DataSource::DataEntry>{}, languageIndex, DataSource::UpdateOperation::SWAP);
-            }
+        Q_EMIT requestedPrimaryLanguageAlreadyContainedInDataSource(requestId, areEntriesAvailable);
+    }
+    else
+    {
+        bool success{_loadEntriesFromDb(requestId, languageIndex, DataSource::UpdateOperation::LOAD_TO_PRIMARY)};
+        bool validEntriesLoaded{m_NrOfPushedEntries != 0};
 
-            Q_EMIT requestedPrimaryLanguageAlreadyContainedInDataSource(areEntriesAvailable);
+        if (success && !validEntriesLoaded && allowEmptyResult)
+        {
+            m_pDataSource->updateDataEntries(QVector<DataSource::DataEntry>{}, languageIndex, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
         }
-        else
+
+        Q_EMIT loadDataFromDbForPrimaryLanguageFinished(requestId, success, validEntriesLoaded);
+    }
+}
+
+void DataSourceLoader::onLoadDataFromDbForSecondaryLanguageRequested(int requestId, int languageIndex)
+{
+    Q_ASSERT(m_pDataSource->getPrimarySourceLanguageIndex() != -1);
+
+    m_IsPreloadCancelRequested.storeRelease(0);
+
+    if (languageIndex == m_pDataSource->getPrimarySourceLanguageIndex() || languageIndex == m_pDataSource->getSecondarySourceLanguageIndex())
+    {
+        Q_EMIT requestedSecondaryLanguageAlreadySetAsPrimary(requestId);
+    }
+    else if (m_pDataSource->isLanguageResident(languageIndex))
+    {
+        m_pResidentLanguageHitsCounter->increment();
+
+        bool success{m_pDataSource->updateDataEntries(QVector<DataSource::DataEntry>{}, languageIndex, DataSource::UpdateOperation::SET_AS_SECONDARY)};
+
+        Q_EMIT loadDataFromDbForSecondaryLanguageFinished(requestId, success);
+    }
+    else
+    {
+        bool success{_loadEntriesFromDb(requestId, languageIndex, DataSource::UpdateOperation::LOAD_TO_SECONDARY)};
+
+        Q_EMIT loadDataFromDbForSecondaryLanguageFinished(requestId, success);
+    }
+}
+
+void DataSourceLoader::onPreloadLanguageRequested(int languageIndex)
+{
+    Q_ASSERT(languageIndex >= 0);
+
+    bool success{m_pDataSource->isLanguageResident(languageIndex)};
+
+    // a canceled preload is not even started: a real request has been queued behind it
+    if (!success && !m_IsPreloadCancelRequested.loadAcquire())
+    {
+        QThread* pLoaderThread{QThread::currentThread()};
+        const QThread::Priority c_LoaderThreadPriority{pLoaderThread->priority()};
+
+        pLoaderThread->setPriority(QThread::LowPriority);
+
+        success = _loadEntriesFromDb(-1, languageIndex, DataSource::UpdateOperation::LOAD_AS_RESIDENT);
+
+        pLoaderThread->setPriority(c_LoaderThreadPriority == QThread::InheritPriority ? QThread::NormalPriority : c_LoaderThreadPriority);
+
+        // the preloaded language might have been evicted right away if there was no room left for it
+        success = success && m_pDataSource->isLanguageResident(languageIndex);
+
+        // an aborted preload should not leave an incomplete language behind
+        if (!success && m_pDataSource->isLanguageResident(languageIndex))
         {
-            bool success{true};
-            bool validEntriesLoaded{false};
+            m_pDataSource->updateDataEntries(QVector<DataSource::DataEntry>{}, languageIndex, DataSource::UpdateOperation::UNLOAD);
+        }
+    }
 
-            QVector<DataSource::DataEntry> loadedDataEntries;
+    Q_EMIT preloadLanguageFinished(languageIndex, success);
+}
 
-            if (_loadEntriesFromDb(loadedDataEntries, languageIndex))
-            {
-                validEntriesLoaded = (loadedDataEntries.size() != 0);
-                if (validEntriesLoaded)
-                {
-                    _validateLoadedDataEntries(loadedDataEntries);
-                }
+bool DataSourceLoader::_loadEntriesFromDb(int requestId, int languageIndex, DataSource::UpdateOperation loadOperation)
+{
+    TRACE_SCOPE("DataSourceLoader::_loadEntriesFromDb");
 
-                if (m_ValidDataEntries.size() != 0 || allowEmptyResult)
-                {
-                    m_pDataSource->updateDataEntries(m_ValidDataEntries, languageIndex, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
-                    m_ValidDataEntries.resize(0);
-                    m_ValidDataEntries.squeeze();
-                }
+    Q_ASSERT(loadOperation == DataSource::UpdateOperation::LOAD_TO_PRIMARY ||
+             loadOperation == DataSource::UpdateOperation::LOAD_TO_SECONDARY ||
+             loadOperation == DataSource::UpdateOperation::LOAD_AS_RESIDENT);
+
+    bool success{true};
+    QElapsedTimer loadTimer;
+
+    loadTimer.start();
+    m_NrOfPushedEntries = 0;
+    m_NrOfRejectedEntries.fill(0);
+    m_LoadedDataEntries.reserve(sc_LoadedEntriesChunkSize);
+    m_ValidDataEntries.reserve(sc_LoadedEntriesChunkSize);
+
+    // normally the connection is already open (see onOpenDatabaseConnectionRequested()), just in case it isn't (e.g. previous failure) another attempt is made
+    if (m_DatabaseConnection.open())
+    {
+        DataSourceSnapshot::Stamp stamp;
+        const bool c_IsStampAvailable{_retrieveSnapshotStamp(languageIndex, stamp)};
+        DataSourceSnapshot snapshot{DataSourceSnapshot::getFilePath(m_DatabaseConnection.getDatabasePath(), languageIndex)};
 
-                // for sync purposes only
-                QThread::msleep(sc_LoadDataThreadDelay);
+        bool isSnapshotRead{false};
+
+        // the snapshot contains already validated entries so it is used whenever the database content (language) didn't change since it has been written
+        if (c_IsStampAvailable && snapshot.openForReading(stamp))
+        {
+            bool isSnapshotDamaged{false};
+
+            success = _readEntriesFromSnapshot(requestId, languageIndex, loadOperation, snapshot, isSnapshotDamaged);
+
+            // a damaged snapshot can be replaced by the database content as long as none of its entries have been pushed, otherwise the load fails (the next one reads the database)
+            isSnapshotRead = !isSnapshotDamaged || m_NrOfPushedEntries != 0;
+
+            if (success)
+            {
+                m_pSnapshotLoadsCounter->increment();
             }
-            else
+        }
+
+        if (!isSnapshotRead)
+        {
+            success = _readEntriesFromDb(requestId, languageIndex, loadOperation, snapshot);
+
+            if (success)
             {
-                success = false;
+                m_pDatabaseLoadsCounter->increment();
             }
 
-            Q_EMIT loadDataFromDbForPrimaryLanguageFinished(success, validEntriesLoaded);
+            if (success && c_IsStampAvailable && !snapshot.save(stamp))
+            {
+                qWarning("Cannot write the snapshot file %s", qUtf8Printable(snapshot.getFilePath()));
+            }
         }
     }
+    else
+    {
+        success = false;
+    }
+
+    m_LoadedDataEntries.resize(0);
+    m_LoadedDataEntries.squeeze();
+    m_ValidDataEntries.resize(0);
+    m_ValidDataEntries.squeeze();
+
+    // only the completed loads are taken into account (canceled preloads or failures would distort the latency)
+    if (success)
+    {
+        m_pLoadLatencyHistogram->record(loadTimer.nsecsElapsed());
+    }
+
+    return success;
 }
 
-void DataSourceLoader::onLoadDataFromDbForSecondaryLanguageRequested(int languageIndex)
+bool DataSourceLoader::_readEntriesFromDb(int requestId, int languageIndex, DataSource::UpdateOperation loadOperation, DataSourceSnapshot& snapshot)
 {
-    Q_ASSERT(m_pDataSource->getPrimarySourceLanguageIndex() != -1);
+    QSqlDatabase database{m_DatabaseConnection.getDatabase()};
 
-    if (languageIndex != m_pDataSource->getPrimarySourceLanguageIndex() && languageIndex != m_pDataSource->getSecondarySourceLanguageIndex())
-    {
-        bool success{true};
-        QVector<DataSource::DataEntry> loadedDataEntries;
+    // the rows discarded by the retrieve query are counted within the same (read) transaction so the rejection counts match the retrieved rows
+    const bool c_IsTransactionStarted{database.transaction()};
+    bool success{_retrieveNrOfDiscardedEntries(languageIndex)};
+
+    const QString c_RetrieveDataQueryString{Database::Query::c_RetrieveEntriesFromLanguageQuery.arg(Database::Query::c_LanguageCodes[languageIndex])
+                                                                                                 .arg(Game::Constraints::c_MinPairSize)
+                                                                                                 .arg(Game::Constraints::c_MaxPairSize)};
 
-        if (_loadEntriesFromDb(loadedDataEntries, languageIndex))
+    QSqlQuery retrieveDataQuery{database};
+    if (success && retrieveDataQuery.exec(c_RetrieveDataQueryString))
+    {
+        /* entries are read (sequentially) in chunks, each chunk being validated in parallel before its valid entries are pushed to data source
+           (the query already discards most invalid entries, the remaining checks, e.g. non-letter characters, cannot be reliably done by the database) */
+        while (retrieveDataQuery.next())
         {
-            if (loadedDataEntries.size() != 0)
-            {
-                _validateLoadedDataEntries(loadedDataEntries);
-            }
+            m_LoadedDataEntries.append(DataSource::DataEntry{retrieveDataQuery.value(0).toString(),                       // field 0: first word
+                                                             retrieveDataQuery.value(1).toString(),                       // field 1: second word
+                                                             static_cast<bool>(retrieveDataQuery.value(2).toInt())});     // field 2: synonym/antonym flag
 
-            if (m_ValidDataEntries.size() != 0)
+            if (m_LoadedDataEntries.size() == sc_LoadedEntriesChunkSize)
             {
-                m_pDataSource->updateDataEntries(m_ValidDataEntries, languageIndex, DataSource::UpdateOperation::LOAD_TO_SECONDARY);
-                m_ValidDataEntries.resize(0);
-                m_ValidDataEntries.squeeze();
+                if (_isLoadCanceled(languageIndex, loadOperation))
+                {
+                    success = false;
+                    break;
+                }
+
+                _validateLoadedDataEntries(m_LoadedDataEntries);
+                m_LoadedDataEntries.resize(0);
+
+                if (m_ValidDataEntries.size() != 0)
+                {
+                    snapshot.appendEntries(m_ValidDataEntries);
+                    _pushValidEntriesChunkToDataSource(requestId, languageIndex, loadOperation);
+                }
             }
+        }
+
+        // next() also returns false when the query fails while iterating (e.g. database locked or corrupted), which should not be mistaken for the end of data
+        if (success && retrieveDataQuery.lastError().isValid())
+        {
+            qWarning("Reading language %s from database failed: %s", qUtf8Printable(Database::Query::c_LanguageCodes[languageIndex]),
+                                                                     qUtf8Printable(retrieveDataQuery.lastError().text()));
+            success = false;
+        }
 
-            // for sync purposes only
-            QThread::msleep(sc_LoadDataThreadDelay);
+        if (success && m_LoadedDataEntries.size() != 0)
+        {
+            _validateLoadedDataEntries(m_LoadedDataEntries);
+            m_LoadedDataEntries.resize(0);
         }
-        else
+
+        if (success && m_ValidDataEntries.size() != 0 && _isLoadCanceled(languageIndex, loadOperation))
         {
             success = false;
         }
 
-        Q_EMIT loadDataFromDbForSecondaryLanguageFinished(success);
+        if (success && m_ValidDataEntries.size() != 0)
+        {
+            snapshot.appendEntries(m_ValidDataEntries);
+            _pushValidEntriesChunkToDataSource(requestId, languageIndex, loadOperation);
+        }
+
+        const int c_NrOfRejectedEntries{std::accumulate(m_NrOfRejectedEntries.cbegin(), m_NrOfRejectedEntries.cend(), 0)};
+
+        for (int rejectionCode{0}; rejectionCode < m_NrOfRejectedEntries.size(); ++rejectionCode)
+        {
+            m_RejectedRowsCounters.at(rejectionCode)->increment(static_cast<quint64>(m_NrOfRejectedEntries.at(rejectionCode)));
+        }
+
+        if (c_NrOfRejectedEntries != 0)
+        {
+            qInfo("%d invalid entries rejected when loading language %s", c_NrOfRejectedEntries, qUtf8Printable(Database::Query::c_LanguageCodes[languageIndex]));
+        }
+    }
+    else
+    {
+        success = false;
     }
-    else if (languageIndex == m_pDataSource->getPrimarySourceLanguageIndex() || languageIndex == m_pDataSource->getSecondarySourceLanguageIndex())
+
+    // nothing has been written so the transaction is only ended (the query needs to be finished first)
+    if (c_IsTransactionStarted)
     {
-        Q_EMIT requestedSecondaryLanguageAlreadySetAsPrimary();
+        retrieveDataQuery.finish();
+        Q_UNUSED(database.commit());
     }
+
+    return success;
 }
 
-bool DataSourceLoader::_loadEntriesFromDb(QVector<DataSource::DataEntry>& dbEntries, int languageIndex)
+bool DataSourceLoader::_retrieveNrOfDiscardedEntries(int languageIndex)
 {
-    bool success{true};
+    bool success{false};
 
-    Q_UNUSED(QSqlDatabase::addDatabase(Database::Query::c_DbDriverName));
+    QSqlQuery countDiscardedEntriesQuery{Database::Query::c_CountDiscardedEntriesFromLanguageQuery.arg(Database::Query::c_LanguageCodes[languageIndex])
+                                                                                                  .arg(Game::Constraints::c_MinPairSize)
+                                                                                                  .arg(Game::Constraints::c_MaxPairSize),
+                                         m_DatabaseConnection.getDatabase()};
 
-    // ensure all database related objects are destroyed before the connection is removed
+    // each sum is NULL (i.e. 0) if the language has no rows
+    if (countDiscardedEntriesQuery.isActive() && countDiscardedEntriesQuery.next())
     {
-        QSqlDatabase db{QSqlDatabase::database(QSqlDatabase::defaultConnection)};
+        m_NrOfRejectedEntries[static_cast<int>(DataEntryValidator::ValidationCodes::LESS_MIN_TOTAL_PAIR_CHARS)] = countDiscardedEntriesQuery.value(0).toInt();      // field 0: pair too short
+        m_NrOfRejectedEntries[static_cast<int>(DataEntryValidator::ValidationCodes::MORE_MAX_TOTAL_PAIR_CHARS)] = countDiscardedEntriesQuery.value(1).toInt();       // field 1: pair too long
+        m_NrOfRejectedEntries[static_cast<int>(DataEntryValidator::ValidationCodes::INVALID_CHARACTERS)] = countDiscardedEntriesQuery.value(2).toInt();  // field 2: ASCII uppercase letters
+        success = true;
+    }
 
-        db.setDatabaseName(m_DatabasePath);
+    return success;
+}
 
-        if (db.open())
-        {
-            QSqlQuery retrieveDataQuery{Database::Query::c_RetrieveEntriesFromLanguageQuery.arg(Database::Query::c_LanguageCodes[languageIndex])};
-            if (retrieveDataQuery.isActive())
-            {
-                while (retrieveDataQuery.next())
-                {
-                    dbEntries.append(DataSource::DataEntry{retrieveDataQuery.value(1).toString(),                       // field 1: first word
-                                                           retrieveDataQuery.value(2).toString(),                       // field 2: second word
-                                                           static_cast<bool>(retrieveDataQuery.value(3).toInt())});     // field 3: synonym/antonym flag
-                }
-            }
-            else
-            {
-                success = false;
-            }
+bool DataSourceLoader::_readEntriesFromSnapshot(int requestId, int languageIndex, DataSource::UpdateOperation loadOperation, DataSourceSnapshot& snapshot, bool& isSnapshotDamaged)
+{
+    bool success{true};
+    int nrOfReadEntries{0};
 
-            db.close();
-        }
-        else
+    isSnapshotDamaged = false;
+
+    // each snapshot section contains (at most) one chunk, as written when loading from database
+    while ((nrOfReadEntries = snapshot.readEntries(m_ValidDataEntries)) > 0)
+    {
+        if (_isLoadCanceled(languageIndex, loadOperation))
         {
             success = false;
+            break;
         }
+
+        _pushValidEntriesChunkToDataSource(requestId, languageIndex, loadOperation);
     }
 
-    QSqlDatabase::removeDatabase(QSqlDatabase::defaultConnection);
+    if (nrOfReadEntries < 0)
+    {
+        qWarning("The snapshot file %s is damaged and gets removed", qUtf8Printable(snapshot.getFilePath()));
+
+        m_ValidDataEntries.resize(0);
+        Q_UNUSED(QFile::remove(snapshot.getFilePath()));
+        isSnapshotDamaged = true;
+        success = false;
+    }
 
     return success;
 }
 
-void DataSourceLoader::_validateLoadedDataEntries(const QVector<DataSource::DataEntry> dbEntries)
+bool DataSourceLoader::_retrieveSnapshotStamp(int languageIndex, DataSourceSnapshot::Stamp& stamp)
 {
-    m_ValidDataEntries.reserve(dbEntries.size());
+    bool success{false};
+
+    QSqlQuery retrieveStampQuery{Database::Query::c_RetrieveLanguageStampQuery.arg(Database::Query::c_LanguageCodes[languageIndex]), m_DatabaseConnection.getDatabase()};
+
+    if (retrieveStampQuery.isActive() && retrieveStampQuery.next())
+    {
+        const QFileInfo c_WalFileInfo{m_DatabaseConnection.getDatabasePath() + Database::Snapshot::c_WalFileSuffix};
+
+        // an empty log (e.g. created when opening the database) contains no writes, its time is not taken into account so the snapshot remains valid when reopening the database
+        const bool c_IsWalContentAvailable{c_WalFileInfo.exists() && c_WalFileInfo.size() > 0};
+
+        stamp = DataSourceSnapshot::Stamp{QFileInfo{m_DatabaseConnection.getDatabasePath()}.lastModified().toMSecsSinceEpoch(),
+                                          c_IsWalContentAvailable ? c_WalFileInfo.lastModified().toMSecsSinceEpoch() : 0,
+                                          c_IsWalContentAvailable ? c_WalFileInfo.size() : 0,
+                                          retrieveStampQuery.value(0).toLongLong(),   // field 0: number of language rows
+                                          retrieveStampQuery.value(1).toLongLong()};  // field 1: highest language row ID (NULL, i.e. 0, if no rows)
+        success = true;
+    }
+
+    return success;
+}
+
+void DataSourceLoader::_pushValidEntriesChunkToDataSource(int requestId, int languageIndex, DataSource::UpdateOperation loadOperation)
+{
+    const bool isFirstChunk{m_NrOfPushedEntries == 0};
+    const int nrOfEntries{m_ValidDataEntries.size()};
+
+    // first chunk replaces the content of the source, the next ones are appended to it
+    m_pDataSource->updateDataEntries(m_ValidDataEntries, languageIndex, isFirstChunk ? loadOperation : DataSource::UpdateOperation::APPEND);
+    m_NrOfPushedEntries += nrOfEntries;
+    m_ValidDataEntries.resize(0);
 
-    for (int row{0}; row < dbEntries.size(); ++row)
+    if (loadOperation == DataSource::UpdateOperation::LOAD_TO_PRIMARY)
     {
-        if (_isValidDataEntry(dbEntries[row]))
+        if (isFirstChunk)
         {
-            m_ValidDataEntries.append(dbEntries[row]);
+            Q_EMIT loadDataFromDbForPrimaryLanguageFirstChunkReady(requestId, languageIndex, nrOfEntries);
+        }
+        else
+        {
+            Q_EMIT loadDataFromDbForPrimaryLanguageChunkReady(requestId, languageIndex, nrOfEntries);
         }
     }
 }
 
-bool DataSourceLoader::_isValidDataEntry(const DataSource::DataEntry &dataEntry)
+void DataSourceLoader::_validateLoadedDataEntries(const QVector<DataSource::DataEntry>& loadedDataEntries)
 {
-    auto isValidWord = [](const QString &word)
+    TRACE_SCOPE("DataSourceLoader::_validateLoadedDataEntries");
+
+    // the mapped sequence has the same order as the input so the valid entries are stored in the same order in which they were read
+    const QVector<DataEntryValidator::ValidationCodes> c_ValidationCodes{QtConcurrent::blockingMapped<QVector<DataEntryValidator::ValidationCodes>>(loadedDataEntries, &DataSourceLoader::_getValidationCode)};
+
+    Q_ASSERT(c_ValidationCodes.size() == loadedDataEntries.size());
+
+    m_pReadRowsCounter->increment(static_cast<quint64>(loadedDataEntries.size()));
+
+    for (int entryIndex{0}; entryIndex < loadedDataEntries.size(); ++entryIndex)
     {
-        bool success{true};
+        const DataEntryValidator::ValidationCodes c_ValidationCode{c_ValidationCodes.at(entryIndex)};
 
-        for (auto currentCharacter : word)
+        if (c_ValidationCode == DataEntryValidator::ValidationCodes::VALID_PAIR)
         {
-            if (!currentCharacter.isLower())
-            {
-                success = false;
-                break;
-            }
+            m_ValidDataEntries.append(loadedDataEntries.at(entryIndex));
+        }
+        else
+        {
+            ++m_NrOfRejectedEntries[static_cast<int>(c_ValidationCode)];
         }
+    }
+}
+
+bool DataSourceLoader::_isLoadCanceled(int languageIndex, DataSource::UpdateOperation loadOperation) const
+{
+    // only preloads can be canceled, either on request or because the preloaded language got evicted (least recently used until first used, so no room left for it)
+    return loadOperation == DataSource::UpdateOperation::LOAD_AS_RESIDENT &&
+           (m_IsPreloadCancelRequested.loadAcquire() || (m_NrOfPushedEntries != 0 && !m_pDataSource->isLanguageResident(languageIndex)));
+}
 
-        return (success && (word.size() >= Game::Constraints::c_MinWordSize));
+DataEntryValidator::ValidationCodes DataSourceLoader::_getValidationCode(const DataSource::DataEntry& dataEntry)
+{
+    auto containsOnlyLowercaseCharacters = [](const QString& word)
+    {
+        return std::all_of(word.cbegin(), word.cend(), [](const QChar& character) {return character.isLower();});
     };
 
-    bool isValidPair{true};
+    DataEntryValidator::ValidationCodes validationCode{DataEntryValidator::ValidationCodes::VALID_PAIR};
 
     // static_cast required to solve compiling error (normally there should be no overflow - to be refactored to use size_t if required)
     const int totalPairSize{static_cast<int>(dataEntry.firstWord.size() + dataEntry.secondWord.size())};
 
-    if (totalPairSize < Game::Constraints::c_MinPairSize || totalPairSize > Game::Constraints::c_MaxPairSize)
+    if (totalPairSize < Game::Constraints::c_MinPairSize)
+    {
+        validationCode = DataEntryValidator::ValidationCodes::LESS_MIN_TOTAL_PAIR_CHARS;
+    }
+    else if (totalPairSize > Game::Constraints::c_MaxPairSize)
+    {
+        validationCode = DataEntryValidator::ValidationCodes::MORE_MAX_TOTAL_PAIR_CHARS;
+    }
+    else if (!containsOnlyLowercaseCharacters(dataEntry.firstWord) || !containsOnlyLowercaseCharacters(dataEntry.secondWord))
     {
-        isValidPair = false;
+        validationCode = DataEntryValidator::ValidationCodes::INVALID_CHARACTERS;
     }
-    else if (!isValidWord(dataEntry.firstWord) || !isValidWord(dataEntry.secondWord))
+    else if (dataEntry.firstWord.size() < Game::Constraints::c_MinWordSize || dataEntry.secondWord.size() < Game::Constraints::c_MinWordSize)
     {
-        isValidPair = false;
+        validationCode = DataEntryValidator::ValidationCodes::LESS_MIN_CHARS_PER_WORD;
     }
     else if (dataEntry.firstWord == dataEntry.secondWord)
     {
-        isValidPair = false;
+        validationCode = DataEntryValidator::ValidationCodes::IDENTICAL_WORDS;
     }
 
-    return isValidPair;
+    return validationCode;
 }
@@ -1,42 +1,81 @@
 /*
    This class fulfills following tasks:
    1) Loads the valid word pairs from database for the chosen language
-   2) Hands the loaded data to the datasource
+   2) Hands the loaded data to the datasource in chunks so the consumer can start using the first chunk while the remaining ones are still being loaded
+   3) Validates each chunk of read entries in parallel (worker thread pool) and keeps track of the number of rejected entries per reason
+   4) Stores the valid entries of each language loaded from database into a binary snapshot and reads them from it (no validation required) as long as the language content doesn't change
+   5) Preloads languages in background (low priority, abortable) so they are already available when requested
+   6) Updates the loading metrics (loads, read and rejected rows, resident languages reused, load latency)
 */
 
 #ifndef DATASOURCELOADER_H
 #define DATASOURCELOADER_H
 
 #include <QObject>
+#include <QAtomicInt>
 
 #include "datasource.h"
+#include "databaseconnection.h"
+#include "datasourcesnapshot.h"
+#include "dataentryvalidator.h"
+#include "../Utilities/metricsregistry.h"
 
 class DataSourceLoader : public QObject
 {
     Q_OBJECT
 public:
-    explicit DataSourceLoader(DataSource* pDataSource, QString dataBasePath, QObject *parent = nullptr);
+    explicit DataSourceLoader(DataSource* pDataSource, QString dataBasePath, const DatabaseConnection::Settings& connectionSettings = DatabaseConnection::Settings{}, QObject *parent = nullptr);
+
+    // refers to the last load operation (always 0 if loaded from snapshot), should only be read once it finished (same rules as for the pairs entered by user, duplicates excepted)
+    int getNrOfRejectedEntries(DataEntryValidator::ValidationCodes rejectionCode) const;
+
+    // thread safe: should be called before requesting a (non-preload) load so any ongoing or queued preload gets aborted
+    void cancelPreload();
 
 public slots:
-    void onLoadDataFromDbForPrimaryLanguageRequested(int languageIndex, bool allowEmptyResult);
-    void onLoadDataFromDbForSecondaryLanguageRequested(int languageIndex);
+    void onOpenDatabaseConnectionRequested();
+    void onLoadDataFromDbForPrimaryLanguageRequested(int requestId, int languageIndex, bool allowEmptyResult);
+    void onLoadDataFromDbForSecondaryLanguageRequested(int requestId, int languageIndex);
+    void onPreloadLanguageRequested(int languageIndex);
 
 signals:
-    Q_SIGNAL void loadDataFromDbForPrimaryLanguageFinished(bool success, bool validEntriesLoaded);
-    Q_SIGNAL void requestedPrimaryLanguageAlreadyContainedInDataSource(bool entriesAvailable);
-    Q_SIGNAL void loadDataFromDbForSecondaryLanguageFinished(bool success);
-    Q_SIGNAL void requestedSecondaryLanguageAlreadySetAsPrimary();
+    // each request is acknowledged by exactly one of the finished/already contained signals, the request ID being passed back to requester
+    Q_SIGNAL void loadDataFromDbForPrimaryLanguageFirstChunkReady(int requestId, int languageIndex, int nrOfEntries);
+    Q_SIGNAL void loadDataFromDbForPrimaryLanguageChunkReady(int requestId, int languageIndex, int nrOfEntries);
+    Q_SIGNAL void loadDataFromDbForPrimaryLanguageFinished(int requestId, bool success, bool validEntriesLoaded);
+    Q_SIGNAL void requestedPrimaryLanguageAlreadyContainedInDataSource(int requestId, bool entriesAvailable);
+    Q_SIGNAL void loadDataFromDbForSecondaryLanguageFinished(int requestId, bool success);
+    Q_SIGNAL void requestedSecondaryLanguageAlreadySetAsPrimary(int requestId);
+    Q_SIGNAL void preloadLanguageFinished(int languageIndex, bool success);
 
 private:
-    bool _loadEntriesFromDb(QVector<DataSource::DataEntry>& dbEntries, int languageIndex);
-    void _validateLoadedDataEntries(const QVector<DataSource::DataEntry> dbEntries);
-    bool _isValidDataEntry(const DataSource::DataEntry& dataEntry);
+    bool _loadEntriesFromDb(int requestId, int languageIndex, DataSource::UpdateOperation loadOperation);
+    bool _readEntriesFromDb(int requestId, int languageIndex, DataSource::UpdateOperation loadOperation, DataSourceSnapshot& snapshot);
+    bool _readEntriesFromSnapshot(int requestId, int languageIndex, DataSource::UpdateOperation loadOperation, DataSourceSnapshot& snapshot, bool& isSnapshotDamaged);
+    bool _retrieveSnapshotStamp(int languageIndex, DataSourceSnapshot::Stamp& stamp);
+    bool _retrieveNrOfDiscardedEntries(int languageIndex);
+    void _pushValidEntriesChunkToDataSource(int requestId, int languageIndex, DataSource::UpdateOperation loadOperation);
+    void _validateLoadedDataEntries(const QVector<DataSource::DataEntry>& loadedDataEntries);
+    bool _isLoadCanceled(int languageIndex, DataSource::UpdateOperation loadOperation) const;
+
+    // static (no member access) so it can be safely run concurrently by the worker threads
+    static DataEntryValidator::ValidationCodes _getValidationCode(const DataSource::DataEntry& dataEntry);
 
-    static constexpr int sc_LoadDataThreadDelay{1000};
+    static constexpr int sc_LoadedEntriesChunkSize{5000};
 
-    QVector<DataSource::DataEntry> m_ValidDataEntries;
+    QVector<DataSource::DataEntry> m_LoadedDataEntries; // entries read from database and not validated yet
+    QVector<DataSource::DataEntry> m_ValidDataEntries; // current chunk, emptied each time it gets pushed to data source
+    QVector<int> m_NrOfRejectedEntries; // one counter per invalid code (see DataEntryValidator)
+    int m_NrOfPushedEntries;
     DataSource* m_pDataSource;
-    QString m_DatabasePath;
+    DatabaseConnection m_DatabaseConnection; // kept open for the whole lifetime of the loader thread
+    QAtomicInt m_IsPreloadCancelRequested;   // set by requester thread, reset by loader thread when handling a non-preload request
+    MetricsRegistry::Counter* m_pDatabaseLoadsCounter;
+    MetricsRegistry::Counter* m_pSnapshotLoadsCounter;
+    MetricsRegistry::Counter* m_pResidentLanguageHitsCounter;
+    MetricsRegistry::Counter* m_pReadRowsCounter;
+    QVector<MetricsRegistry::Counter*> m_RejectedRowsCounters; // one counter per invalid code
+    MetricsRegistry::Histogram* m_pLoadLatencyHistogram;
 };
 
 #endif // DATASOURCELOADER_H
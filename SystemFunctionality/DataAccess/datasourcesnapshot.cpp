@@ -0,0 +1,329 @@
+#include <QFileInfo>
+#include <QDir>
+#include <QSaveFile>
+
+#include <cstring>
+
+#include "datasourcesnapshot.h"
+#include "databaseutils.h"
+
+namespace
+{
+    struct Header
+    {
+        quint32 magic;
+        quint32 formatVersion;
+        qint64 dbLastModified;
+        qint64 walLastModified;
+        qint64 walSize;
+        qint64 nrOfLanguageRows;
+        qint64 maxLanguageRowId;
+        quint32 nrOfEntries;
+        quint32 nrOfSections;
+    };
+
+    // each section header is followed by the entries of the section (payload), the checksum covering the payload only
+    struct SectionHeader
+    {
+        quint32 nrOfEntries;
+        quint32 payloadSize;
+        quint64 payloadChecksum;
+    };
+
+    // each entry: areSynonyms flag, first word size, second word size (all quint16), followed by the UTF-16 characters of the two words
+    static constexpr int c_EntryFieldsSize{3 * static_cast<int>(sizeof(quint16))};
+
+    static_assert(sizeof(Header) == 56, "The snapshot header should not contain padding");
+    static_assert(sizeof(SectionHeader) == 16, "The snapshot section header should not contain padding");
+    static_assert(sizeof(QChar) == sizeof(quint16), "The snapshot stores the words as UTF-16 characters");
+}
+
+DataSourceSnapshot::Stamp::Stamp()
+    : dbLastModified{0}
+    , walLastModified{0}
+    , walSize{0}
+    , nrOfLanguageRows{0}
+    , maxLanguageRowId{0}
+{
+}
+
+DataSourceSnapshot::Stamp::Stamp(qint64 dbLastModified, qint64 walLastModified, qint64 walSize, qint64 nrOfLanguageRows, qint64 maxLanguageRowId)
+    : dbLastModified{dbLastModified}
+    , walLastModified{walLastModified}
+    , walSize{walSize}
+    , nrOfLanguageRows{nrOfLanguageRows}
+    , maxLanguageRowId{maxLanguageRowId}
+{
+}
+
+bool DataSourceSnapshot::Stamp::operator==(const Stamp& other) const
+{
+    return dbLastModified == other.dbLastModified &&
+           walLastModified == other.walLastModified &&
+           walSize == other.walSize &&
+           nrOfLanguageRows == other.nrOfLanguageRows &&
+           maxLanguageRowId == other.maxLanguageRowId;
+}
+
+bool DataSourceSnapshot::Stamp::operator!=(const Stamp& other) const
+{
+    return !(*this == other);
+}
+
+DataSourceSnapshot::DataSourceSnapshot(const QString& filePath)
+    : m_File{filePath}
+    , m_pMappedData{nullptr}
+    , m_MappedSize{0}
+    , m_ReadPosition{0}
+    , m_NrOfEntries{0}
+    , m_NrOfSections{0}
+    , m_NrOfReadSections{0}
+    , m_NrOfAppendedEntries{0}
+    , m_NrOfAppendedSections{0}
+{
+}
+
+DataSourceSnapshot::~DataSourceSnapshot()
+{
+    _close();
+}
+
+bool DataSourceSnapshot::openForReading(const Stamp& stamp)
+{
+    _close();
+
+    bool success{false};
+
+    if (m_File.exists() && m_File.open(QIODevice::ReadOnly) && m_File.size() >= static_cast<qint64>(sizeof(Header)))
+    {
+        m_MappedSize = m_File.size();
+        m_pMappedData = m_File.map(0, m_MappedSize);
+
+        if (m_pMappedData)
+        {
+            Header header;
+            std::memcpy(&header, m_pMappedData, sizeof(Header));
+
+            const Stamp c_SnapshotStamp{header.dbLastModified, header.walLastModified, header.walSize, header.nrOfLanguageRows, header.maxLanguageRowId};
+
+            success = header.magic == sc_Magic && header.formatVersion == sc_FormatVersion && c_SnapshotStamp == stamp;
+
+            if (success)
+            {
+                m_NrOfEntries = static_cast<int>(header.nrOfEntries);
+                m_NrOfSections = static_cast<int>(header.nrOfSections);
+                m_ReadPosition = sizeof(Header);
+
+                // a truncated file is detected here, damaged content only when reading the affected section
+                success = _areSectionsValid();
+            }
+        }
+    }
+
+    if (!success)
+    {
+        _close();
+    }
+
+    return success;
+}
+
+int DataSourceSnapshot::readEntries(QVector<DataSource::DataEntry>& entries)
+{
+    int nrOfReadEntries{0};
+
+    if (m_pMappedData && m_NrOfReadSections < m_NrOfSections)
+    {
+        SectionHeader sectionHeader;
+        std::memcpy(&sectionHeader, m_pMappedData + m_ReadPosition, sizeof(SectionHeader));
+        m_ReadPosition += sizeof(SectionHeader);
+
+        const uchar* pPayload{m_pMappedData + m_ReadPosition};
+
+        if (sectionHeader.payloadChecksum == _computeChecksum(pPayload, sectionHeader.payloadSize))
+        {
+            // the words are decoded directly into the (default constructed) entries appended to the output vector, no intermediate strings required
+            const int c_FirstEntryIndex{entries.size()};
+            entries.resize(c_FirstEntryIndex + static_cast<int>(sectionHeader.nrOfEntries));
+
+            for (int entryIndex{c_FirstEntryIndex}; entryIndex < entries.size(); ++entryIndex)
+            {
+                Q_ASSERT(m_ReadPosition + c_EntryFieldsSize <= m_MappedSize);
+
+                quint16 entryFields[3];
+                std::memcpy(entryFields, m_pMappedData + m_ReadPosition, c_EntryFieldsSize);
+                m_ReadPosition += c_EntryFieldsSize;
+
+                Q_ASSERT(m_ReadPosition + (entryFields[1] + entryFields[2]) * static_cast<qint64>(sizeof(QChar)) <= m_MappedSize);
+
+                // the mapped data is 2-byte aligned (headers and entry fields have even sizes) so the characters can be read in-place
+                const QChar* pFirstWord{reinterpret_cast<const QChar*>(m_pMappedData + m_ReadPosition)};
+                DataSource::DataEntry& entry{entries[entryIndex]};
+
+                entry.firstWord.setUnicode(pFirstWord, entryFields[1]);
+                entry.secondWord.setUnicode(pFirstWord + entryFields[1], entryFields[2]);
+                entry.areSynonyms = entryFields[0] != 0;
+
+                m_ReadPosition += (entryFields[1] + entryFields[2]) * static_cast<qint64>(sizeof(QChar));
+            }
+
+            Q_ASSERT(m_ReadPosition == pPayload - m_pMappedData + sectionHeader.payloadSize);
+
+            nrOfReadEntries = static_cast<int>(sectionHeader.nrOfEntries);
+            ++m_NrOfReadSections;
+        }
+        else
+        {
+            nrOfReadEntries = -1;
+            _close();
+        }
+    }
+
+    return nrOfReadEntries;
+}
+
+int DataSourceSnapshot::getNrOfEntries() const
+{
+    return m_NrOfEntries;
+}
+
+void DataSourceSnapshot::appendEntries(const QVector<DataSource::DataEntry>& entries)
+{
+    // an empty section would be mistaken for the end of the snapshot when reading
+    if (entries.isEmpty())
+    {
+        return;
+    }
+
+    const int c_SectionHeaderPosition{m_Payload.size()};
+
+    // the section header is filled in once the payload has been written
+    m_Payload.append(static_cast<int>(sizeof(SectionHeader)), '\0');
+
+    for (const auto& entry : entries)
+    {
+        Q_ASSERT(entry.firstWord.size() <= 0xFFFF && entry.secondWord.size() <= 0xFFFF);
+
+        const quint16 c_EntryFields[3]{static_cast<quint16>(entry.areSynonyms), static_cast<quint16>(entry.firstWord.size()), static_cast<quint16>(entry.secondWord.size())};
+
+        m_Payload.append(reinterpret_cast<const char*>(c_EntryFields), c_EntryFieldsSize);
+        m_Payload.append(reinterpret_cast<const char*>(entry.firstWord.constData()), static_cast<int>(entry.firstWord.size() * sizeof(QChar)));
+        m_Payload.append(reinterpret_cast<const char*>(entry.secondWord.constData()), static_cast<int>(entry.secondWord.size() * sizeof(QChar)));
+    }
+
+    const int c_SectionPayloadPosition{c_SectionHeaderPosition + static_cast<int>(sizeof(SectionHeader))};
+    const quint32 c_SectionPayloadSize{static_cast<quint32>(m_Payload.size() - c_SectionPayloadPosition)};
+
+    const SectionHeader c_SectionHeader{static_cast<quint32>(entries.size()),
+                                        c_SectionPayloadSize,
+                                        _computeChecksum(reinterpret_cast<const uchar*>(m_Payload.constData()) + c_SectionPayloadPosition, c_SectionPayloadSize)};
+
+    std::memcpy(m_Payload.data() + c_SectionHeaderPosition, &c_SectionHeader, sizeof(SectionHeader));
+
+    m_NrOfAppendedEntries += entries.size();
+    ++m_NrOfAppendedSections;
+}
+
+bool DataSourceSnapshot::save(const Stamp& stamp)
+{
+    _close();
+
+    const Header c_Header{sc_Magic,
+                          sc_FormatVersion,
+                          stamp.dbLastModified,
+                          stamp.walLastModified,
+                          stamp.walSize,
+                          stamp.nrOfLanguageRows,
+                          stamp.maxLanguageRowId,
+                          static_cast<quint32>(m_NrOfAppendedEntries),
+                          static_cast<quint32>(m_NrOfAppendedSections)};
+
+    // the previous snapshot (if any) only gets replaced once the new one has been entirely written
+    QSaveFile snapshotFile{m_File.fileName()};
+
+    bool success{snapshotFile.open(QIODevice::WriteOnly)};
+
+    success = success && snapshotFile.write(reinterpret_cast<const char*>(&c_Header), sizeof(Header)) == static_cast<qint64>(sizeof(Header));
+    success = success && snapshotFile.write(m_Payload) == m_Payload.size();
+    success = success && snapshotFile.commit();
+
+    m_Payload.clear();
+    m_NrOfAppendedEntries = 0;
+    m_NrOfAppendedSections = 0;
+
+    return success;
+}
+
+QString DataSourceSnapshot::getFilePath() const
+{
+    return m_File.fileName();
+}
+
+QString DataSourceSnapshot::getFilePath(const QString& databasePath, int languageIndex)
+{
+    Q_ASSERT(languageIndex >= 0 && languageIndex < Database::Query::c_LanguageCodes.size());
+
+    return QFileInfo{databasePath}.absoluteDir().filePath(Database::Snapshot::c_FileNameTemplate.arg(Database::Query::c_LanguageCodes.at(languageIndex)));
+}
+
+void DataSourceSnapshot::_close()
+{
+    if (m_pMappedData)
+    {
+        m_File.unmap(m_pMappedData);
+        m_pMappedData = nullptr;
+    }
+
+    if (m_File.isOpen())
+    {
+        m_File.close();
+    }
+
+    m_MappedSize = 0;
+    m_ReadPosition = 0;
+    m_NrOfEntries = 0;
+    m_NrOfSections = 0;
+    m_NrOfReadSections = 0;
+}
+
+// only the section headers are read: the sections should exactly fill the file and contain all entries
+bool DataSourceSnapshot::_areSectionsValid() const
+{
+    qint64 sectionPosition{m_ReadPosition};
+    qint64 nrOfEntries{0};
+    bool areSectionsValid{true};
+
+    for (int sectionIndex{0}; areSectionsValid && sectionIndex < m_NrOfSections; ++sectionIndex)
+    {
+        areSectionsValid = sectionPosition + static_cast<qint64>(sizeof(SectionHeader)) <= m_MappedSize;
+
+        if (areSectionsValid)
+        {
+            SectionHeader sectionHeader;
+            std::memcpy(&sectionHeader, m_pMappedData + sectionPosition, sizeof(SectionHeader));
+
+            sectionPosition += static_cast<qint64>(sizeof(SectionHeader)) + sectionHeader.payloadSize;
+            nrOfEntries += sectionHeader.nrOfEntries;
+
+            // the entry fields and the characters have even sizes so each section starts 2-byte aligned
+            areSectionsValid = sectionPosition <= m_MappedSize && sectionHeader.payloadSize % sizeof(QChar) == 0 &&
+                               static_cast<qint64>(sectionHeader.nrOfEntries) * c_EntryFieldsSize <= sectionHeader.payloadSize;
+        }
+    }
+
+    return areSectionsValid && sectionPosition == m_MappedSize && nrOfEntries == m_NrOfEntries;
+}
+
+// 64-bit FNV-1a: only meant for detecting truncated or damaged files, not for security purposes
+quint64 DataSourceSnapshot::_computeChecksum(const uchar* pData, qint64 size)
+{
+    quint64 checksum{0xCBF29CE484222325ULL};
+
+    for (qint64 byteIndex{0}; byteIndex < size; ++byteIndex)
+    {
+        checksum ^= pData[byteIndex];
+        checksum *= 0x100000001B3ULL;
+    }
+
+    return checksum;
+}
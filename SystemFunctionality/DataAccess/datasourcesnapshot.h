@@ -0,0 +1,88 @@
+/*
+   This class fulfills following tasks:
+   1) Writes the validated entries of a language into a compact binary file (snapshot) stored next to the database
+   2) Memory maps an existing snapshot and reads its entries back, provided that it has been created from the current database content (stamp) and is not corrupted (checksum)
+
+   The entries are stored in sections (one per appended chunk), each section having its own checksum which is only verified when the section gets read.
+
+   The snapshot is written in the native byte order of the host, a snapshot created on a host with different endianness is simply considered invalid.
+*/
+
+#ifndef DATASOURCESNAPSHOT_H
+#define DATASOURCESNAPSHOT_H
+
+#include <QString>
+#include <QVector>
+#include <QByteArray>
+#include <QFile>
+
+#include "datasource.h"
+
+class DataSourceSnapshot
+{
+public:
+    /* identifies the database content used for creating the snapshot, any difference means the snapshot is outdated:
+       - any write (including updates) changes either the database file or, with write-ahead logging, the log file (which only gets merged into the database file later)
+       - the row count and the highest row ID of the language are an additional check in case the file times have a coarse resolution
+    */
+    struct Stamp
+    {
+        Stamp();
+        Stamp(qint64 dbLastModified, qint64 walLastModified, qint64 walSize, qint64 nrOfLanguageRows, qint64 maxLanguageRowId);
+
+        bool operator==(const Stamp& other) const;
+        bool operator!=(const Stamp& other) const;
+
+        qint64 dbLastModified; // ms since epoch
+        qint64 walLastModified; // ms since epoch, 0 if there is no (non-empty) write-ahead log
+        qint64 walSize;
+        qint64 nrOfLanguageRows;
+        qint64 maxLanguageRowId;
+    };
+
+    explicit DataSourceSnapshot(const QString& filePath);
+    ~DataSourceSnapshot();
+
+    /* reading: the entries are read in the same order in which they had been appended when writing
+       - opening only checks the header and the section sizes, the section checksum is verified when reading the section
+       - each call appends the entries of the next section, returns 0 once all have been read or -1 if the section is corrupted (the snapshot then gets closed)
+    */
+    bool openForReading(const Stamp& stamp);
+    int readEntries(QVector<DataSource::DataEntry>& entries);
+    int getNrOfEntries() const;
+
+    // writing: the file is only created (atomically) when saving, each call creates a new section
+    void appendEntries(const QVector<DataSource::DataEntry>& entries);
+    bool save(const Stamp& stamp);
+
+    QString getFilePath() const;
+
+    static QString getFilePath(const QString& databasePath, int languageIndex);
+
+private:
+    DataSourceSnapshot(const DataSourceSnapshot&) = delete;
+    DataSourceSnapshot& operator=(const DataSourceSnapshot&) = delete;
+
+    void _close();
+
+    bool _areSectionsValid() const;
+
+    static quint64 _computeChecksum(const uchar* pData, qint64 size);
+
+    // bump whenever the file layout or the entry validation rules (Game::Constraints) change
+    static constexpr quint32 sc_FormatVersion{2};
+    static constexpr quint32 sc_Magic{0x534E5953}; // "SYNS" when written on a little endian host
+
+    QFile m_File;
+    uchar* m_pMappedData;
+    qint64 m_MappedSize;
+    qint64 m_ReadPosition;
+    int m_NrOfEntries;
+    int m_NrOfSections;
+    int m_NrOfReadSections;
+    QByteArray m_Payload;
+    int m_NrOfAppendedEntries;
+    int m_NrOfAppendedSections;
+};
+
+#endif // DATASOURCESNAPSHOT_H
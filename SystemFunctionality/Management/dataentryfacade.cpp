@@ -32,6 +32,8 @@ DataEntryFacade::DataEntryFacade(QObject *parent)
     Q_ASSERT(connected);
     connected = connect(m_pDataEntryProxy, &DataEntryProxy::writeDataToDbFinished, this, &DataEntryFacade::_onWriteDataToDbFinished);
     Q_ASSERT(connected);
+    connected = connect(m_pDataEntryProxy, &DataEntryProxy::dataSavingErrorOccured, this, &DataEntryFacade::_onDataSavingErrorOccured);
+    Q_ASSERT(connected);
     connected = connect(m_pDataEntryProxy, &DataEntryProxy::fetchDataForDataEntryLanguageFinished, this, &DataEntryFacade::_onFetchDataForDataEntryLanguageFinished);
     Q_ASSERT(connected);
 }
@@ -75,6 +77,7 @@ void DataEntryFacade::requestSaveDataToDb()
         _blockAddToCache();
         _blockSaveToDb();
         _blockCacheReset();
+        m_FailedSaveEntries.clear();
 
         if (!isDataFetchingInProgress())
         {
@@ -129,6 +132,11 @@ DataEntryFacade::StatusCodes DataEntryFacade::getStatusCode() const
     return m_CurrentStatusCode;
 }
 
+const QVector<DataSource::DataEntry>& DataEntryFacade::getFailedSaveEntries() const
+{
+    return m_FailedSaveEntries;
+}
+
 bool DataEntryFacade::isDataEntryAllowed() const
 {
     return m_IsDataEntryAllowed;
@@ -253,6 +261,19 @@ void DataEntryFacade::_onWriteDataToDbFinished()
     Q_EMIT statusChanged();
 }
 
+void DataEntryFacade::_onDataSavingErrorOccured(QVector<DataSource::DataEntry> failedEntries)
+{
+    // nothing has been saved and the entries are still cached, so they can either be saved again or discarded
+    _allowAddToCache();
+    _allowCacheReset();
+    _allowSaveToDb();
+    m_IsSavingInProgress = false;
+    m_FailedSaveEntries = failedEntries;
+
+    m_CurrentStatusCode = DataEntryFacade::StatusCodes::DATA_SAVING_ERROR;
+    Q_EMIT statusChanged();
+}
+
 void DataEntryFacade::_allowAddToCache()
 {
     if (!m_IsAddingToCacheAllowed)
@@ -11,6 +11,9 @@
 #define DATAENTRYFACADE_H
 
 #include <QObject>
+#include <QVector>
+
+#include "../DataAccess/datasource.h"
 
 class DataEntryProxy;
 
@@ -44,6 +47,7 @@ public:
         DATA_FETCHING_FINISHED_SAVE_IN_PROGRESS,
         DATA_SAVE_IN_PROGRESS,
         DATA_SUCCESSFULLY_SAVED,
+        DATA_SAVING_ERROR,
     };
 
     explicit DataEntryFacade(QObject *parent = nullptr);
@@ -62,6 +66,9 @@ public:
     int getCurrentLanguageIndex() const;
     DataEntryFacade::StatusCodes getStatusCode() const;
 
+    // entries that could not be written to database by the last failed save (empty if the save failed as a whole, e.g. database not available)
+    const QVector<DataSource::DataEntry>& getFailedSaveEntries() const;
+
     bool isDataEntryAllowed() const;
     bool isAddingToCacheAllowed() const;
     bool isCacheResetAllowed() const;
@@ -88,6 +95,7 @@ private slots:
     void _onWordsPairAlreadyContainedInCache();
     void _onCacheReset();
     void _onWriteDataToDbFinished();
+    void _onDataSavingErrorOccured(QVector<DataSource::DataEntry> failedEntries);
 
 private:
     void _allowAddToCache();
@@ -114,6 +122,7 @@ private:
     bool m_IsSavingInProgress;
     int m_CurrentLanguageIndex;
     bool m_IsSavingDeferred;
+    QVector<DataSource::DataEntry> m_FailedSaveEntries;
 };
 
 #endif // DATAENTRYFACADE_H
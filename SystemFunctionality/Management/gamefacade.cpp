@@ -7,13 +7,7 @@
 #include "gamefunctionalityproxy.h"
 #include "statisticsitem.h"
 #include "chronometer.h"
-
-const QMap<Game::Levels, int> c_TimeLimits
-{
-    {Game::Levels::LEVEL_EASY, 30},
-    {Game::Levels::LEVEL_MEDIUM, 120},
-    {Game::Levels::LEVEL_HARD, 300}
-};
+#include "tracer.h"
 
 GameFacade::GameFacade(QObject *parent)
     : QObject(parent)
@@ -21,6 +15,7 @@ GameFacade::GameFacade(QObject *parent)
     , m_GameLevel{Game::Levels::LEVEL_MEDIUM}
     , m_CurrentLanguageIndex{-1}
     , m_PreviousLanguageIndex{-1}
+    , m_StreamedLanguageIndex{-1}
     , m_CurrentStatusCode{GameFacade::StatusCodes::NO_LANGUAGE_SET}
     , m_IsConnectedToDataSource{false}
     , m_IsDataAvailable{false}
@@ -29,7 +24,18 @@ GameFacade::GameFacade(QObject *parent)
     , m_IsPersistentIndexModeEnabled{false}
     , m_IsFetchingInProgress{false}
     , m_ShouldRevertLanguageWhenDataUnavailable{false}
-{
+    , m_IsDeterministicModeEnabled{false}
+    , m_IsReplayModeEnabled{false}
+    , m_PrefetchedWordsPairs{sc_PrefetchedWordsPairsCount}
+    , m_PendingWordsPairPrefetches{sc_PrefetchedWordsPairsCount}
+    , m_PrefetchedEntryNumbers{sc_PrefetchedWordsPairsCount}
+    , m_NrOfSkippedWordsPairPrefetches{0}
+    , m_pSubmitToNextPairLatencyHistogram{MetricsRegistry::getRegistry()->getHistogram("synant_submit_to_next_pair_latency_seconds",
+                                                                                      "Time elapsed from submitting a correct input until the next words pair is available.")}
+{
+    std::random_device randomDevice{};
+    m_MixSeedEngine.seed(randomDevice());
+
     m_pDataSourceAccessHelper = m_pGameFunctionalityProxy->getDataSourceAccessHelper();
     m_pWordMixer = m_pGameFunctionalityProxy->getWordMixer();
     m_pWordPairOwner = m_pGameFunctionalityProxy->getWordPairOwner();
@@ -72,6 +78,10 @@ GameFacade::GameFacade(QObject *parent)
     Q_ASSERT(connected);
     connected = connect(m_pChronometer, &Chronometer::refreshTriggered, this, &GameFacade::remainingTimeRefreshed);
     Q_ASSERT(connected);
+    connected = connect(m_pGameFunctionalityProxy, &GameFunctionalityProxy::fetchDataForPrimaryLanguageFirstChunkReady, this, &GameFacade::_onFetchDataForPrimaryLanguageFirstChunkReady);
+    Q_ASSERT(connected);
+    connected = connect(m_pGameFunctionalityProxy, &GameFunctionalityProxy::fetchDataForPrimaryLanguageChunkReady, this, &GameFacade::_onFetchDataForPrimaryLanguageChunkReady);
+    Q_ASSERT(connected);
     connected = connect(m_pGameFunctionalityProxy, &GameFunctionalityProxy::fetchDataForPrimaryLanguageFinished, this, &GameFacade::_onFetchDataForPrimaryLanguageFinished);
     Q_ASSERT(connected);
     connected = connect(m_pGameFunctionalityProxy, &GameFunctionalityProxy::fetchDataForSecondaryLanguageFinished, this, &GameFacade::_onFetchDataForSecondaryLanguageFinished);
@@ -80,12 +90,16 @@ GameFacade::GameFacade(QObject *parent)
     Q_ASSERT(connected);
     connected = connect(m_pGameFunctionalityProxy, &GameFunctionalityProxy::dataSavingErrorOccured, this, &GameFacade::_onDataSavingErrorOccured);
     Q_ASSERT(connected);
+    connected = connect(m_pGameFunctionalityProxy, &GameFunctionalityProxy::wordsPairPrefetched, this, &GameFacade::_onWordsPairPrefetched);
+    Q_ASSERT(connected);
 }
 
 void GameFacade::init()
 {
     Q_ASSERT(m_GameLevel != Game::Levels::LEVEL_NONE);
 
+    _recordCall(SessionLog::Events::INIT);
+
     _pushCurrentGameLevel();
 
     if (m_CurrentStatusCode == GameFacade::StatusCodes::NO_LANGUAGE_SET)
@@ -100,6 +114,8 @@ void GameFacade::init()
 
 void GameFacade::startGame()
 {
+    _recordCall(SessionLog::Events::START_GAME);
+
     if (!m_IsGameStarted)
     {
         Q_ASSERT(m_IsDataAvailable);
@@ -120,6 +136,8 @@ void GameFacade::startGame()
 
 void GameFacade::resumeGame()
 {
+    _recordCall(SessionLog::Events::RESUME_GAME);
+
     Q_ASSERT(m_IsGamePaused);
     m_IsGamePaused = false;
 
@@ -135,6 +153,8 @@ void GameFacade::resumeGame()
 
 void GameFacade::pauseGame()
 {
+    _recordCall(SessionLog::Events::PAUSE_GAME);
+
     Q_ASSERT(m_IsGameStarted);
     m_IsGamePaused = true;
 
@@ -149,6 +169,8 @@ void GameFacade::pauseGame()
 
 void GameFacade::quitGame()
 {
+    _recordCall(SessionLog::Events::QUIT_GAME);
+
     Q_ASSERT(m_IsGameStarted);
     m_CurrentStatusCode = GameFacade::StatusCodes::GAME_STOPPED;
     Q_EMIT statusChanged();
@@ -158,6 +180,8 @@ void GameFacade::setGameLevel(Game::Levels level)
 {
     Q_ASSERT(level != Game::Levels::LEVEL_NONE);
 
+    _recordCall(SessionLog::Events::SET_GAME_LEVEL, static_cast<quint32>(level));
+
     if (m_GameLevel != level)
     {
         // always stop the chronometer prior to changing level (time limit is changed)
@@ -169,7 +193,9 @@ void GameFacade::setGameLevel(Game::Levels level)
         m_GameLevel = level;
         _pushCurrentGameLevel();
 
-        m_pGameFunctionalityProxy->provideDataEntryToConsumer(m_pDataSourceAccessHelper->generateEntryNumber());
+        // pairs mixed for previous level are no longer usable
+        _discardPrefetchedWordsPairs();
+        _provideNextWordsPair();
 
         m_CurrentStatusCode = GameFacade::StatusCodes::LEVEL_CHANGED;
         Q_EMIT statusChanged();
@@ -184,6 +210,8 @@ void GameFacade::setGameLevel(Game::Levels level)
 
 void GameFacade::setLanguage(int languageIndex, bool revertLanguageWhenDataUnavailable)
 {
+    _recordCall(SessionLog::Events::SET_LANGUAGE, static_cast<quint32>(languageIndex), revertLanguageWhenDataUnavailable);
+
     if (m_CurrentLanguageIndex != languageIndex)
     {
         // pausing only allowed in the main pane
@@ -194,34 +222,52 @@ void GameFacade::setLanguage(int languageIndex, bool revertLanguageWhenDataUnava
 
         m_PreviousLanguageIndex = m_CurrentLanguageIndex;
         m_CurrentLanguageIndex = languageIndex;
+        m_StreamedLanguageIndex = -1; // the remaining chunks of a previously requested language are no longer forwarded by manager
+        _discardPrefetchedWordsPairs();
         m_ShouldRevertLanguageWhenDataUnavailable = revertLanguageWhenDataUnavailable;
-        m_IsFetchingInProgress = true;
 
         Q_EMIT languageChanged();
-        Q_EMIT fetchingInProgressChanged();
-        m_CurrentStatusCode = GameFacade::StatusCodes::FETCHING_DATA;
-        Q_EMIT statusChanged();
 
-        m_IsDataAvailable = false;
+        // a resident language is used right away, only a real load goes through the fetching state
+        if (m_pGameFunctionalityProxy->switchToResidentPrimaryLanguage(languageIndex))
+        {
+            _startUsingFetchedData(m_pGameFunctionalityProxy->getNrOfDataSourceEntries());
+        }
+        else
+        {
+            m_IsFetchingInProgress = true;
 
-        Q_EMIT dataAvailableChanged();
+            Q_EMIT fetchingInProgressChanged();
+            m_CurrentStatusCode = GameFacade::StatusCodes::FETCHING_DATA;
+            Q_EMIT statusChanged();
+
+            m_IsDataAvailable = false;
 
-        m_pGameFunctionalityProxy->fetchDataForPrimaryLanguage(languageIndex, !revertLanguageWhenDataUnavailable);
+            Q_EMIT dataAvailableChanged();
+
+            m_pGameFunctionalityProxy->fetchDataForPrimaryLanguage(languageIndex, !revertLanguageWhenDataUnavailable);
+        }
     }
 }
 
 void GameFacade::enableTimeLimit()
 {
+    _recordCall(SessionLog::Events::ENABLE_TIME_LIMIT);
+
     m_pChronometer->enable();
 }
 
 void GameFacade::disableTimeLimit()
 {
+    _recordCall(SessionLog::Events::DISABLE_TIME_LIMIT);
+
     m_pChronometer->disable();
 }
 
 void GameFacade::enablePersistentMode()
 {
+    _recordCall(SessionLog::Events::ENABLE_PERSISTENT_MODE);
+
     if (!m_IsPersistentIndexModeEnabled)
     {
         if (!m_pInputBuilder->isInputComplete())
@@ -245,6 +291,8 @@ void GameFacade::enablePersistentMode()
 
 void GameFacade::disablePersistentMode()
 {
+    _recordCall(SessionLog::Events::DISABLE_PERSISTENT_MODE);
+
     if (m_IsPersistentIndexModeEnabled)
     {
         m_IsPersistentIndexModeEnabled = false;
@@ -261,6 +309,8 @@ void GameFacade::disablePersistentMode()
 
 void GameFacade::goToNextPersistentModeContainer()
 {
+    _recordCall(SessionLog::Events::GO_TO_NEXT_PERSISTENT_MODE_CONTAINER);
+
     if (m_IsPersistentIndexModeEnabled)
     {
         if (m_pWordPairOwner->getPersistentPieceSelectionIndex() != -1)
@@ -310,6 +360,8 @@ void GameFacade::goToNextPersistentModeContainer()
 
 void GameFacade::increasePersistentIndex()
 {
+    _recordCall(SessionLog::Events::INCREASE_PERSISTENT_INDEX);
+
     if (m_IsPersistentIndexModeEnabled)
     {
         if (m_pWordPairOwner->getPersistentPieceSelectionIndex() != -1)
@@ -330,6 +382,8 @@ void GameFacade::increasePersistentIndex()
 
 void GameFacade::decreasePersistentIndex()
 {
+    _recordCall(SessionLog::Events::DECREASE_PERSISTENT_INDEX);
+
     if (m_IsPersistentIndexModeEnabled)
     {
         if (m_pWordPairOwner->getPersistentPieceSelectionIndex() != -1)
@@ -350,6 +404,8 @@ void GameFacade::decreasePersistentIndex()
 
 void GameFacade::executeFirstPersistentModeAction()
 {
+    _recordCall(SessionLog::Events::EXECUTE_FIRST_PERSISTENT_MODE_ACTION);
+
     if (m_IsPersistentIndexModeEnabled)
     {
         // there should always be an active persistent index while in persistent mode
@@ -369,6 +425,8 @@ void GameFacade::executeFirstPersistentModeAction()
 
 void GameFacade::executeSecondPersistentModeAction()
 {
+    _recordCall(SessionLog::Events::EXECUTE_SECOND_PERSISTENT_MODE_ACTION);
+
     if (m_IsPersistentIndexModeEnabled)
     {
         // there should always be an active persistent index while in persistent mode
@@ -388,6 +446,8 @@ void GameFacade::executeSecondPersistentModeAction()
 
 void GameFacade::addPieceToInputWord(Game::InputWordNumber inputWordNumber, int wordPieceIndex)
 {
+    _recordCall(SessionLog::Events::ADD_PIECE_TO_INPUT_WORD, static_cast<quint32>(inputWordNumber), static_cast<quint32>(wordPieceIndex));
+
     if (!m_IsPersistentIndexModeEnabled)
     {
         if (!m_pWordPairOwner->getIsWordPieceAddedToInput(wordPieceIndex))
@@ -404,6 +464,8 @@ void GameFacade::addPieceToInputWord(Game::InputWordNumber inputWordNumber, int
 
 void GameFacade::removePiecesFromInputWord(Game::InputWordNumber inputWordNumber, int inputRangeStart)
 {
+    _recordCall(SessionLog::Events::REMOVE_PIECES_FROM_INPUT_WORD, static_cast<quint32>(inputWordNumber), static_cast<quint32>(inputRangeStart));
+
     if (!m_IsPersistentIndexModeEnabled)
     {
         if (m_pInputBuilder->removePiecesFromInputWord(inputWordNumber, inputRangeStart))
@@ -421,6 +483,8 @@ void GameFacade::removePiecesFromInputWord(Game::InputWordNumber inputWordNumber
 
 void GameFacade::clearInputWord(Game::InputWordNumber inputWordNumber)
 {
+    _recordCall(SessionLog::Events::CLEAR_INPUT_WORD, static_cast<quint32>(inputWordNumber));
+
     if (m_pInputBuilder->removePiecesFromInputWord(inputWordNumber, 0))
     {
         m_CurrentStatusCode = GameFacade::StatusCodes::PIECES_REMOVED;
@@ -430,6 +494,8 @@ void GameFacade::clearInputWord(Game::InputWordNumber inputWordNumber)
 
 void GameFacade::clearInput()
 {
+    _recordCall(SessionLog::Events::CLEAR_INPUT);
+
     if (m_pInputBuilder->clearInput())
     {
         m_CurrentStatusCode = GameFacade::StatusCodes::USER_INPUT_CLEARED;
@@ -439,7 +505,11 @@ void GameFacade::clearInput()
 
 void GameFacade::handleSubmitRequest()
 {
-    QVector<QString> mixedWordPiecesContent{m_pWordPairOwner->getMixedWordsPiecesContent()};
+    TRACE_SCOPE("GameFacade::handleSubmitRequest");
+
+    m_SubmitToNextPairTimer.start();
+
+    const QVector<QString>& mixedWordPiecesContent{m_pWordPairOwner->getMixedWordsPiecesContent()};
 
     QString firstInputWord;
     QString secondInputWord;
@@ -457,13 +527,21 @@ void GameFacade::handleSubmitRequest()
     bool success{(firstInputWord == m_pWordPairOwner->getFirstReferenceWord() && secondInputWord == m_pWordPairOwner->getSecondReferenceWord()) ||
                  (firstInputWord == m_pWordPairOwner->getSecondReferenceWord() && secondInputWord == m_pWordPairOwner->getFirstReferenceWord())};
 
+    // the outcome is recorded too so the replayer can detect a divergence from the recorded session (e.g. different database content)
+    _recordCall(SessionLog::Events::HANDLE_SUBMIT_REQUEST, success);
+
+    if (!success)
+    {
+        m_SubmitToNextPairTimer.invalidate();
+    }
+
     m_CurrentStatusCode = success ? GameFacade::StatusCodes::CORRECT_USER_INPUT : GameFacade::StatusCodes::INCORRECT_USER_INPUT;
     Q_EMIT statusChanged();
 
     if (success)
     {
         m_pStatisticsItem->updateStatistics(StatisticsItem::StatisticsUpdateOperations::FULL_UPDATE);
-        m_pGameFunctionalityProxy->provideDataEntryToConsumer(m_pDataSourceAccessHelper->generateEntryNumber());
+        _provideNextWordsPair();
 
         if (m_pChronometer->isEnabled())
         {
@@ -474,10 +552,12 @@ void GameFacade::handleSubmitRequest()
 
 void GameFacade::provideCorrectWordsPairToUser()
 {
+    _recordCall(SessionLog::Events::PROVIDE_CORRECT_WORDS_PAIR_TO_USER);
+
     m_pStatisticsItem->updateStatistics(StatisticsItem::StatisticsUpdateOperations::PARTIAL_UPDATE);
     m_CurrentStatusCode = GameFacade::StatusCodes::SOLUTION_REQUESTED_BY_USER;
     Q_EMIT statusChanged();
-    m_pGameFunctionalityProxy->provideDataEntryToConsumer(m_pDataSourceAccessHelper->generateEntryNumber());
+    _provideNextWordsPair();
 
     if (m_pChronometer->isEnabled())
     {
@@ -487,15 +567,68 @@ void GameFacade::provideCorrectWordsPairToUser()
 
 void GameFacade::resetGameStatistics()
 {
+    _recordCall(SessionLog::Events::RESET_GAME_STATISTICS);
+
     m_pStatisticsItem->updateStatistics(StatisticsItem::StatisticsUpdateOperations::RESET);
 }
 
 void GameFacade::handleDataSavingOperationInProgress()
 {
+    _recordCall(SessionLog::Events::HANDLE_DATA_SAVING_OPERATION_IN_PROGRESS);
+
     m_CurrentStatusCode = m_IsDataAvailable ? GameFacade::StatusCodes::ADDITIONAL_DATA_SAVE_IN_PROGRESS : GameFacade::StatusCodes::NEW_DATA_SAVE_IN_PROGRESS;
     Q_EMIT statusChanged();
 }
 
+bool GameFacade::startRecording(const QString& logFilePath)
+{
+    bool success{m_CurrentLanguageIndex == -1 && !m_IsReplayModeEnabled && m_SessionLog.openForWriting(logFilePath)};
+
+    if (success)
+    {
+        std::random_device randomDevice{};
+        const quint32 c_Seed{static_cast<quint32>(randomDevice())};
+
+        _setRandomSeed(c_Seed);
+        _recordCall(SessionLog::Events::SESSION_STARTED, c_Seed);
+    }
+
+    return success;
+}
+
+void GameFacade::stopRecording()
+{
+    m_SessionLog.close();
+    m_IsDeterministicModeEnabled = false;
+}
+
+bool GameFacade::enterReplayMode(quint32 seed)
+{
+    const bool c_Success{m_CurrentLanguageIndex == -1 && !m_SessionLog.isOpenForWriting()};
+
+    if (c_Success)
+    {
+        _setRandomSeed(seed);
+        m_IsReplayModeEnabled = true;
+    }
+
+    return c_Success;
+}
+
+void GameFacade::exitReplayMode()
+{
+    m_IsReplayModeEnabled = false;
+    m_IsDeterministicModeEnabled = false;
+}
+
+void GameFacade::replayTimeLimitReached()
+{
+    if (m_IsReplayModeEnabled)
+    {
+        _handleTimeLimitReached();
+    }
+}
+
 bool GameFacade::isDataFetchingInProgress() const
 {
     return m_IsFetchingInProgress;
@@ -531,6 +664,16 @@ bool GameFacade::canResetGameStatistics() const
     return m_pStatisticsItem->canResetStatistics();
 }
 
+bool GameFacade::isRecording() const
+{
+    return m_SessionLog.isOpenForWriting();
+}
+
+bool GameFacade::isReplayModeEnabled() const
+{
+    return m_IsReplayModeEnabled;
+}
+
 int GameFacade::getCurrentLanguageIndex() const
 {
     return m_CurrentLanguageIndex;
@@ -541,17 +684,17 @@ GameFacade::StatusCodes GameFacade::getStatusCode() const
     return m_CurrentStatusCode;
 }
 
-QVector<QString> GameFacade::getMixedWordsPiecesContent() const
+const QVector<QString>& GameFacade::getMixedWordsPiecesContent() const
 {
     return m_pWordPairOwner->getMixedWordsPiecesContent();
 }
 
-QVector<Game::PieceTypes> GameFacade::getMixedWordsPiecesTypes() const
+const QVector<Game::PieceTypes>& GameFacade::getMixedWordsPiecesTypes() const
 {
     return m_pWordPairOwner->getMixedWordsPiecesTypes();
 }
 
-QVector<bool> GameFacade::getAreMixedWordsPiecesSelected() const
+const QVector<bool>& GameFacade::getAreMixedWordsPiecesSelected() const
 {
     return m_pWordPairOwner->getAreMixedWordsPiecesAddedToInput();
 }
@@ -616,29 +759,66 @@ QString GameFacade::getTotalWordPairs() const
     return m_pStatisticsItem->getTotalWordPairs();
 }
 
-void GameFacade::_onFetchDataForPrimaryLanguageFinished(bool success, bool validEntriesFetched)
+void GameFacade::_onFetchDataForPrimaryLanguageFirstChunkReady(int languageIndex, int nrOfEntries)
 {
-    if (success)
+    // in deterministic mode the entries are only used once all chunks have been received (see _onFetchDataForPrimaryLanguageFinished())
+    if (!m_IsDeterministicModeEnabled)
+    {
+        m_StreamedLanguageIndex = languageIndex;
+    }
+
+    // chunks of a language that is no longer the current one (language changed while loading) are ignored
+    if (languageIndex == m_StreamedLanguageIndex && languageIndex == m_CurrentLanguageIndex)
     {
+        // no need to wait for the remaining chunks, the game can already start with the entries from the first one
         m_IsFetchingInProgress = false;
         Q_EMIT fetchingInProgressChanged();
 
-        if (validEntriesFetched)
-        {
-            m_pDataSourceAccessHelper->setEntriesTable(m_pGameFunctionalityProxy->getNrOfDataSourceEntries());
-            _connectToDataSource();
-            m_pGameFunctionalityProxy->provideDataEntryToConsumer(m_pDataSourceAccessHelper->generateEntryNumber());
-            m_IsDataAvailable = true;
+        _startUsingFetchedData(nrOfEntries);
+    }
+}
+
+void GameFacade::_onFetchDataForPrimaryLanguageChunkReady(int languageIndex, int nrOfEntries)
+{
+    if (languageIndex == m_StreamedLanguageIndex && languageIndex == m_CurrentLanguageIndex)
+    {
+        m_pDataSourceAccessHelper->addEntriesToTable(nrOfEntries);
+    }
+}
+
+void GameFacade::_onFetchDataForPrimaryLanguageFinished(bool success, bool validEntriesFetched)
+{
+    if (m_StreamedLanguageIndex != -1)
+    {
+        const bool c_IsCurrentLanguageStreamed{m_StreamedLanguageIndex == m_CurrentLanguageIndex};
+
+        // data already made available when the first chunk was received, nothing left to do unless the remaining chunks could not be loaded
+        m_StreamedLanguageIndex = -1;
 
+        if (!success && c_IsCurrentLanguageStreamed)
+        {
+            // the partially loaded language is incomplete so it should no longer be used
+            _discardPrefetchedWordsPairs();
+            m_IsDataAvailable = false;
             Q_EMIT dataAvailableChanged();
-            m_CurrentStatusCode = GameFacade::StatusCodes::DATA_FETCHING_COMPLETE;
-            Q_EMIT statusChanged();
 
-            // restarting only allowed in the main pane
-            if (m_pChronometer->isEnabled() && m_IsGameStarted)
+            if (m_pChronometer->isEnabled())
             {
-                m_pChronometer->restart();
+                m_pChronometer->disable();
             }
+
+            m_CurrentStatusCode = GameFacade::StatusCodes::DATA_FETCHING_ERROR;
+            Q_EMIT statusChanged();
+        }
+    }
+    else if (success)
+    {
+        m_IsFetchingInProgress = false;
+        Q_EMIT fetchingInProgressChanged();
+
+        if (validEntriesFetched)
+        {
+            _startUsingFetchedData(m_pGameFunctionalityProxy->getNrOfDataSourceEntries());
         }
         else
         {
@@ -690,17 +870,32 @@ void GameFacade::_onEntryProvidedToConsumer(QPair<QString, QString> newWordsPair
 
 void GameFacade::_onNewWordsPairMixed()
 {
-    m_pInputBuilder->resetInput();
+    _setNewWordsPair(m_pWordMixer->getMixedWordsPair());
+}
 
-    m_pWordPairOwner->setNewWordsPair(m_pWordMixer->getMixedWordsPiecesContent(),
-                                      m_pWordMixer->getFirstWord(),
-                                      m_pWordMixer->getSecondWord(),
-                                      m_pWordMixer->areSynonyms(),
-                                      m_pWordMixer->getFirstWordFirstPieceIndex(),
-                                      m_pWordMixer->getFirstWordLastPieceIndex(),
-                                      m_pWordMixer->getSecondWordFirstPieceIndex(),
-                                      m_pWordMixer->getSecondWordLastPieceIndex());
+void GameFacade::_onWordsPairPrefetched(bool success, WordMixer::MixedWordsPair mixedWordsPair)
+{
+    // the requests are processed in order so the results of the ones already mixed by facade are the first to be received
+    if (m_NrOfSkippedWordsPairPrefetches > 0)
+    {
+        --m_NrOfSkippedWordsPairPrefetches;
+    }
+    else
+    {
+        Q_ASSERT(!m_PendingWordsPairPrefetches.isEmpty());
+        const WordsPairPrefetchRequest c_WordsPairPrefetchRequest{m_PendingWordsPairPrefetches.takeFirst()};
 
+        // a failed prefetch is not retried here, the buffer gets refilled when advancing to next pair (its entry can be chosen again)
+        if (success)
+        {
+            Q_UNUSED(m_PrefetchedWordsPairs.push(mixedWordsPair));
+            Q_UNUSED(m_PrefetchedEntryNumbers.push(c_WordsPairPrefetchRequest.entryNumber));
+        }
+        else
+        {
+            Q_UNUSED(m_pDataSourceAccessHelper->releaseEntryNumber(c_WordsPairPrefetchRequest.entryNumber));
+        }
+    }
 }
 
 void GameFacade::_onPiecesAddedToInputStateChanged()
@@ -755,11 +950,12 @@ void GameFacade::_onPiecesRemovedFromInput(QVector<int> indexes)
 
 void GameFacade::_onChronometerTimeoutTriggered()
 {
-    m_pStatisticsItem->updateStatistics(StatisticsItem::StatisticsUpdateOperations::PARTIAL_UPDATE);
-    m_pGameFunctionalityProxy->provideDataEntryToConsumer(m_pDataSourceAccessHelper->generateEntryNumber());
-    m_CurrentStatusCode = GameFacade::StatusCodes::TIME_LIMIT_REACHED;
-    Q_EMIT statusChanged();
-    m_pChronometer->restart();
+    // when replaying only the recorded timeouts are taken into account (the replay runs at full speed)
+    if (!m_IsReplayModeEnabled)
+    {
+        _recordCall(SessionLog::Events::TIME_LIMIT_REACHED);
+        _handleTimeLimitReached();
+    }
 }
 
 void GameFacade::_onChronometerEnabledChanged()
@@ -813,7 +1009,7 @@ void GameFacade::_onPrimaryLanguageDataSavingFinished(int nrOfPrimaryLanguageSav
         m_pDataSourceAccessHelper->addEntriesToTable(nrOfPrimaryLanguageSavedEntries);
         m_IsDataAvailable = true;
         _connectToDataSource();
-        m_pGameFunctionalityProxy->provideDataEntryToConsumer(m_pDataSourceAccessHelper->generateEntryNumber());
+        _provideNextWordsPair();
 
         Q_EMIT dataAvailableChanged();
         m_CurrentStatusCode = GameFacade::StatusCodes::DATA_GOT_AVAILABLE;
@@ -842,11 +1038,116 @@ void GameFacade::_connectToDataSource()
     }
 }
 
+void GameFacade::_startUsingFetchedData(int nrOfEntries)
+{
+    m_pDataSourceAccessHelper->setEntriesTable(nrOfEntries);
+    _connectToDataSource();
+    _discardPrefetchedWordsPairs();
+    _provideNextWordsPair();
+    m_IsDataAvailable = true;
+
+    Q_EMIT dataAvailableChanged();
+    m_CurrentStatusCode = GameFacade::StatusCodes::DATA_FETCHING_COMPLETE;
+    Q_EMIT statusChanged();
+
+    // restarting only allowed in the main pane
+    if (m_pChronometer->isEnabled() && m_IsGameStarted)
+    {
+        m_pChronometer->restart();
+    }
+}
+
+/* Uses the next prefetched pair if available, otherwise the pair is mixed synchronously (e.g. right after changing language or level):
+   - if a prefetch is still pending its entry is mixed (with the same seed) instead of generating a new entry number, so the sequence of pairs doesn't depend on the prefetcher speed
+   - only when no prefetch is pending a new entry number is generated
+*/
+void GameFacade::_provideNextWordsPair()
+{
+    if (!m_PrefetchedWordsPairs.isEmpty())
+    {
+        Q_UNUSED(m_PrefetchedEntryNumbers.takeFirst());
+        _setNewWordsPair(m_PrefetchedWordsPairs.takeFirst());
+    }
+    else if (!m_PendingWordsPairPrefetches.isEmpty())
+    {
+        const WordsPairPrefetchRequest c_WordsPairPrefetchRequest{m_PendingWordsPairPrefetches.takeFirst()};
+
+        ++m_NrOfSkippedWordsPairPrefetches;
+        _mixWordsPair(c_WordsPairPrefetchRequest.entryNumber, c_WordsPairPrefetchRequest.mixSeed);
+    }
+    else
+    {
+        _mixWordsPair(m_pDataSourceAccessHelper->generateEntryNumber(), static_cast<quint32>(m_MixSeedEngine()));
+    }
+
+    _prefetchWordsPairs();
+}
+
+void GameFacade::_mixWordsPair(int entryNumber, quint32 mixSeed)
+{
+    m_pWordMixer->setSeed(mixSeed);
+    m_pGameFunctionalityProxy->provideDataEntryToConsumer(entryNumber);
+}
+
+void GameFacade::_setNewWordsPair(const WordMixer::MixedWordsPair& mixedWordsPair)
+{
+    TRACE_SCOPE("GameFacade::_setNewWordsPair");
+
+    // the next pair might be set synchronously (prefetched or mixed right away) or after the entry has been provided by data source
+    if (m_SubmitToNextPairTimer.isValid())
+    {
+        m_pSubmitToNextPairLatencyHistogram->record(m_SubmitToNextPairTimer.nsecsElapsed());
+        m_SubmitToNextPairTimer.invalidate();
+    }
+
+    m_pInputBuilder->resetInput();
+
+    m_pWordPairOwner->setNewWordsPair(mixedWordsPair.piecesContent,
+                                      mixedWordsPair.firstWord,
+                                      mixedWordsPair.secondWord,
+                                      mixedWordsPair.areSynonyms,
+                                      mixedWordsPair.firstWordFirstPieceIndex,
+                                      mixedWordsPair.firstWordLastPieceIndex,
+                                      mixedWordsPair.secondWordFirstPieceIndex,
+                                      mixedWordsPair.secondWordLastPieceIndex);
+}
+
+void GameFacade::_prefetchWordsPairs()
+{
+    // entry numbers are marked as used when requesting the prefetch so the same rules apply as for the synchronously provided pairs (released again if the prefetch fails or gets discarded)
+    while (m_pDataSourceAccessHelper->getTotalNrOfEntries() > 0 && m_PrefetchedWordsPairs.size() + m_PendingWordsPairPrefetches.size() < m_PrefetchedWordsPairs.capacity())
+    {
+        const WordsPairPrefetchRequest c_WordsPairPrefetchRequest{m_pDataSourceAccessHelper->generateEntryNumber(), static_cast<quint32>(m_MixSeedEngine())};
+
+        Q_UNUSED(m_PendingWordsPairPrefetches.push(c_WordsPairPrefetchRequest));
+        m_pGameFunctionalityProxy->prefetchWordsPair(c_WordsPairPrefetchRequest.entryNumber, m_CurrentLanguageIndex, m_GameLevel, c_WordsPairPrefetchRequest.mixSeed);
+    }
+}
+
+// the entries of the discarded pairs have not been shown to the user so they are made available again (ignored if the entries table has been reset in the meantime)
+void GameFacade::_discardPrefetchedWordsPairs()
+{
+    m_pGameFunctionalityProxy->discardPrefetchedWordsPairs();
+
+    while (!m_PrefetchedEntryNumbers.isEmpty())
+    {
+        Q_UNUSED(m_pDataSourceAccessHelper->releaseEntryNumber(m_PrefetchedEntryNumbers.takeFirst()));
+    }
+
+    while (!m_PendingWordsPairPrefetches.isEmpty())
+    {
+        Q_UNUSED(m_pDataSourceAccessHelper->releaseEntryNumber(m_PendingWordsPairPrefetches.takeFirst().entryNumber));
+    }
+
+    m_PrefetchedWordsPairs.clear();
+    m_NrOfSkippedWordsPairPrefetches = 0;
+}
+
 void GameFacade::_pushCurrentGameLevel()
 {
     m_pWordMixer->setGameLevel(m_GameLevel);
     m_pStatisticsItem->setGameLevel(m_GameLevel);
-    m_pChronometer->setTotalCountdownTime(c_TimeLimits[m_GameLevel]);
+    m_pChronometer->setTotalCountdownTime(Game::c_TimeLimits[m_GameLevel]);
 }
 
 void GameFacade::_addPieceToInputWord(Game::InputWordNumber inputWordNumber, int wordPieceIndex)
@@ -882,3 +1183,41 @@ void GameFacade::_removePiecesFromInputWordInPersistentMode()
         }
     }
 }
+
+void GameFacade::_handleTimeLimitReached()
+{
+    m_pStatisticsItem->updateStatistics(StatisticsItem::StatisticsUpdateOperations::PARTIAL_UPDATE);
+    _provideNextWordsPair();
+    m_CurrentStatusCode = GameFacade::StatusCodes::TIME_LIMIT_REACHED;
+    Q_EMIT statusChanged();
+    m_pChronometer->restart();
+}
+
+// the entry numbers and the mix seeds (hence the mixed pairs) are generated from this seed
+void GameFacade::_setRandomSeed(quint32 seed)
+{
+    m_pDataSourceAccessHelper->setSeed(seed);
+    m_MixSeedEngine.seed(seed);
+    m_IsDeterministicModeEnabled = true;
+}
+
+void GameFacade::_recordCall(SessionLog::Events event, quint32 firstArgument, quint32 secondArgument)
+{
+    if (m_SessionLog.isOpenForWriting() && !m_SessionLog.append(event, firstArgument, secondArgument))
+    {
+        qWarning("Session recording stopped, the log could not be written");
+        stopRecording();
+    }
+}
+
+GameFacade::WordsPairPrefetchRequest::WordsPairPrefetchRequest()
+    : entryNumber{-1}
+    , mixSeed{0}
+{
+}
+
+GameFacade::WordsPairPrefetchRequest::WordsPairPrefetchRequest(int entryNumber, quint32 mixSeed)
+    : entryNumber{entryNumber}
+    , mixSeed{mixSeed}
+{
+}
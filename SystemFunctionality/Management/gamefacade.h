@@ -5,7 +5,9 @@
    3) The facade checks the user input created by InputBuilder against the reference words contained in WordPairOwner.
    4) The facade intermediates the communication between data access classes and consumer (WordMixer) by using the DataSourceProxy.
    5) The facade provides decoupling by hiding the backend functionality (WordMixer, StatisticsItem, WordPairOwner, InputBuilder and data access classes) entirely from presenter.
-   6) Last but not least the facade is responsible for updating the status of the game (except data entry).
+   6) Keeps a few words pairs mixed in advance (off the GUI thread) for the current language and level so advancing to the next pair doesn't require mixing.
+   7) Records the calls it receives (and the seed of its random generators) into a session log, so the session can be replayed on identical workload (see SessionReplayer).
+   8) Last but not least the facade is responsible for updating the status of the game (except data entry).
 */
 
 #ifndef GAMEFACADE_H
@@ -13,12 +15,18 @@
 
 #include <QObject>
 #include <QTimer>
+#include <QElapsedTimer>
 
 #include "../Utilities/gameutils.h"
+#include "../Utilities/ringbuffer.h"
+#include "../Utilities/sessionlog.h"
+#include "../Utilities/metricsregistry.h"
+#include "../CoreFunctionality/wordmixer.h"
+
+#include <random>
 
 class GameFunctionalityProxy;
 class DataSourceAccessHelper;
-class WordMixer;
 class WordPairOwner;
 class InputBuilder;
 class StatisticsItem;
@@ -99,6 +107,17 @@ public:
     void resetGameStatistics();
     void handleDataSavingOperationInProgress();
 
+    /* Recording and replaying require a deterministic sequence of words pairs:
+       - they can only be started before the first language is set (fresh facade)
+       - the entries of a language are only used once it has been entirely loaded (no first chunk streaming), otherwise the entry numbers would depend on the loading speed
+       - a failure to start recording is reported by the caller, which knows where the session should have been recorded
+    */
+    bool startRecording(const QString& logFilePath);
+    void stopRecording();
+    bool enterReplayMode(quint32 seed);
+    void exitReplayMode();
+    void replayTimeLimitReached();
+
     bool isDataFetchingInProgress() const;
     bool isDataAvailable() const;
     bool isPersistentModeEnabled() const;
@@ -106,13 +125,15 @@ public:
     bool areWordsFromCurrentPairSynonyms() const;
     bool isTimeLimitEnabled() const;
     bool canResetGameStatistics() const;
+    bool isRecording() const;
+    bool isReplayModeEnabled() const;
 
     int getCurrentLanguageIndex() const;
     GameFacade::StatusCodes getStatusCode() const;
 
-    QVector<QString> getMixedWordsPiecesContent() const;
-    QVector<Game::PieceTypes> getMixedWordsPiecesTypes() const;
-    QVector<bool> getAreMixedWordsPiecesSelected() const;
+    const QVector<QString>& getMixedWordsPiecesContent() const;
+    const QVector<Game::PieceTypes>& getMixedWordsPiecesTypes() const;
+    const QVector<bool>& getAreMixedWordsPiecesSelected() const;
     const QVector<int> getFirstWordInputIndexes() const;
     const QVector<int> getSecondWordInputIndexes() const;
     QString getFirstReferenceWord() const;
@@ -146,10 +167,13 @@ signals:
     Q_SIGNAL void statusChanged();
 
 private slots:
+    void _onFetchDataForPrimaryLanguageFirstChunkReady(int languageIndex, int nrOfEntries);
+    void _onFetchDataForPrimaryLanguageChunkReady(int languageIndex, int nrOfEntries);
     void _onFetchDataForPrimaryLanguageFinished(bool success, bool validEntriesFetched);
     void _onFetchDataForSecondaryLanguageFinished(bool success);
     void _onEntryProvidedToConsumer(QPair<QString, QString> newWordsPair, bool areWordsFromCurrentPairSynonyms);
     void _onNewWordsPairMixed();
+    void _onWordsPairPrefetched(bool success, WordMixer::MixedWordsPair mixedWordsPair);
     void _onPiecesAddedToInputStateChanged();
     void _onPieceAddedToInput(int index);
     void _onPiecesRemovedFromInput(QVector<int> indexes);
@@ -161,10 +185,31 @@ private slots:
 
 private:
     void _connectToDataSource();
+    void _startUsingFetchedData(int nrOfEntries);
+    void _provideNextWordsPair();
+    void _mixWordsPair(int entryNumber, quint32 mixSeed);
+    void _setNewWordsPair(const WordMixer::MixedWordsPair& mixedWordsPair);
+    void _prefetchWordsPairs();
+    void _discardPrefetchedWordsPairs();
+    void _handleTimeLimitReached();
+    void _setRandomSeed(quint32 seed);
+    void _recordCall(SessionLog::Events event, quint32 firstArgument = 0, quint32 secondArgument = 0);
     void _pushCurrentGameLevel();
     void _addPieceToInputWord(Game::InputWordNumber inputWordNumber, int wordPieceIndex);
     void _removePiecesFromInputWordInPersistentMode();
 
+    // each pair is mixed with its own seed, so it is the same whether the prefetched pair or the one mixed by facade (prefetch still pending) is used
+    struct WordsPairPrefetchRequest
+    {
+        WordsPairPrefetchRequest();
+        WordsPairPrefetchRequest(int entryNumber, quint32 mixSeed);
+
+        int entryNumber;
+        quint32 mixSeed;
+    };
+
+    static constexpr int sc_PrefetchedWordsPairsCount{4};
+
     GameFunctionalityProxy* m_pGameFunctionalityProxy;
     DataSourceAccessHelper* m_pDataSourceAccessHelper;
     WordMixer* m_pWordMixer;
@@ -176,6 +221,7 @@ private:
     Game::Levels m_GameLevel;
     int m_CurrentLanguageIndex;
     int m_PreviousLanguageIndex; // used for restoring the previous language in main pane in case no word can be fetched from currently setup one
+    int m_StreamedLanguageIndex; // language for which data chunks are still being received from loader (-1 if none)
     GameFacade::StatusCodes m_CurrentStatusCode;
 
     bool m_IsConnectedToDataSource;
@@ -185,6 +231,25 @@ private:
     bool m_IsPersistentIndexModeEnabled;
     bool m_IsFetchingInProgress;
     bool m_ShouldRevertLanguageWhenDataUnavailable;
+    bool m_IsDeterministicModeEnabled; // recording or replaying
+    bool m_IsReplayModeEnabled;
+
+    // words pairs already mixed for current language and level, the pending ones have been requested but not received yet
+    RingBuffer<WordMixer::MixedWordsPair> m_PrefetchedWordsPairs;
+    RingBuffer<WordsPairPrefetchRequest> m_PendingWordsPairPrefetches;
+
+    // entry numbers of the prefetched pairs (same order), released if the pairs get discarded
+    RingBuffer<int> m_PrefetchedEntryNumbers;
+
+    // pending requests mixed by facade as the pair was required before being received (their results are dropped when received)
+    int m_NrOfSkippedWordsPairPrefetches;
+
+    std::default_random_engine m_MixSeedEngine;
+    SessionLog m_SessionLog;
+
+    // started when the user submits the input, stopped once the next pair is set (only valid in-between, i.e. if the input was correct)
+    QElapsedTimer m_SubmitToNextPairTimer;
+    MetricsRegistry::Histogram* m_pSubmitToNextPairLatencyHistogram;
 };
 
 #endif // GAMEFACADE_H
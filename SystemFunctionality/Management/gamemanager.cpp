@@ -8,6 +8,7 @@
 #include "gamefacade.h"
 #include "dataentryfacade.h"
 #include "wordmixer.h"
+#include "wordpairprefetcher.h"
 #include "wordpairowner.h"
 #include "inputbuilder.h"
 #include "datasource.h"
@@ -38,12 +39,23 @@ GameManager::GameManager(QObject *parent)
     , m_pDataEntryStatistics{nullptr}
     , m_pDataSourceAccessHelper{new DataSourceAccessHelper{this}}
     , m_pWordMixer{new WordMixer{this}}
+    , m_pWordPairPrefetcher{nullptr}
     , m_pWordPairOwner{new WordPairOwner{this}}
     , m_pInputBuilder{new InputBuilder{this}}
     , m_pStatisticsItem{new StatisticsItem{this}}
     , m_pChronometer{new Chronometer{this}}
     , m_pDataSourceLoaderThread{nullptr}
     , m_pDataEntryCacheThread{nullptr}
+    , m_pWordPairPrefetcherThread{nullptr}
+    , m_IsWriteAheadLoggingEnabled{false}
+    , m_PrimaryLanguageRequestSequencer{}
+    , m_SecondaryLanguageRequestSequencer{}
+    , m_CacheRequestSequencer{}
+    , m_WordsPairPrefetchRequestSequencer{}
+    , m_LastDiscardedWordsPairPrefetchRequestId{0}
+    , m_IsLanguagePreloadingEnabled{true}
+    , m_PreloadedLanguageIndex{-1}
+    , m_pResidentLanguageHitsCounter{MetricsRegistry::getRegistry()->getCounter("synant_language_cache_hits_total", "Language requests served by the data source without loading.")}
 {
     _registerMetaTypes();
 }
@@ -58,6 +70,13 @@ GameManager *GameManager::getManager()
     return s_pGameManager;
 }
 
+void GameManager::enableWriteAheadLogging()
+{
+    Q_ASSERT(!m_pDataSource);
+
+    m_IsWriteAheadLoggingEnabled = true;
+}
+
 void GameManager::setEnvironment(const QString &dataDirPath)
 {
     Q_ASSERT(QDir{dataDirPath}.exists());
@@ -65,28 +84,46 @@ void GameManager::setEnvironment(const QString &dataDirPath)
     if (!m_pDataSource)
     {
         QString databasePath{dataDirPath + "/" + Database::Query::c_DatabaseName};
+        DatabaseConnection::Settings connectionSettings;
+
+        if (m_IsWriteAheadLoggingEnabled)
+        {
+            connectionSettings.journalMode = Database::Connection::c_WalJournalMode;
+        }
 
         _setDatabase(databasePath);
 
         m_pDataSource = new DataSource{this};
-        m_pDataSourceLoader = new DataSourceLoader{m_pDataSource, databasePath};
+        m_pDataSourceLoader = new DataSourceLoader{m_pDataSource, databasePath, connectionSettings};
         m_pDataSourceLoaderThread = new QThread{this};
         m_pDataEntryValidator = new DataEntryValidator{m_pDataSource, this};
-        m_pDataEntryCache = new DataEntryCache{m_pDataSource, databasePath};
+        m_pDataEntryCache = new DataEntryCache{m_pDataSource, databasePath, connectionSettings};
         m_pDataEntryCacheThread = new QThread{this};
         m_pDataEntryStatistics = new DataEntryStatistics{this};
+        m_pWordPairPrefetcher = new WordPairPrefetcher{m_pDataSource};
+        m_pWordPairPrefetcherThread = new QThread{this};
 
         // always ensure these items are created after all data source related items are initialized
         m_pDataSourceLoader->moveToThread(m_pDataSourceLoaderThread);
         m_pDataEntryCache->moveToThread(m_pDataEntryCacheThread);
+        m_pWordPairPrefetcher->moveToThread(m_pWordPairPrefetcherThread);
+
+        // the names identify the workers in the dumped traces (see Tracer)
+        m_pDataSourceLoaderThread->setObjectName("DataSourceLoader");
+        m_pDataEntryCacheThread->setObjectName("DataEntryCache");
+        m_pWordPairPrefetcherThread->setObjectName("WordPairPrefetcher");
 
         _makeDataConnections();
 
         m_pDataSourceLoaderThread->start();
         m_pDataEntryCacheThread->start();
+        m_pWordPairPrefetcherThread->start();
 
-        if (m_pDataSourceLoaderThread->isRunning() && m_pDataEntryCacheThread->isRunning())
+        if (m_pDataSourceLoaderThread->isRunning() && m_pDataEntryCacheThread->isRunning() && m_pWordPairPrefetcherThread->isRunning())
         {
+            // each worker opens its own long-lived connection (closed when its thread finishes and the worker gets deleted)
+            Q_EMIT openDatabaseConnectionsRequested();
+
             /* the facades are created by manager and will build the connections to the other manager provided components
                                                         (WordMixer, WordPairOwner, InputBuilder, StatisticsItem, etc) on their own */
             m_pGameFacade = new GameFacade{this};
@@ -101,12 +138,57 @@ void GameManager::setEnvironment(const QString &dataDirPath)
 
 void GameManager::fetchDataForPrimaryLanguage(int languageIndex, bool allowEmptyResult)
 {
-    Q_EMIT readDataForPrimaryLanguage(languageIndex, allowEmptyResult);
+    // a real request has priority over any preload (the ongoing one gets aborted, the pending ones are dropped)
+    _cancelLanguagePreloading();
+    _markLanguageAsRecentlyUsed(languageIndex);
+
+    Q_EMIT readDataForPrimaryLanguage(m_PrimaryLanguageRequestSequencer.issueRequest(), languageIndex, allowEmptyResult);
+}
+
+/* Makes a resident language primary right away (no loader round trip), returns false if it should be fetched instead:
+   - the loader should not work on a real language request as it might change the primary or secondary language concurrently
+   - the language shouldn't be the one currently preloaded, its entries might still be incomplete
+*/
+bool GameManager::switchToResidentPrimaryLanguage(int languageIndex)
+{
+    const bool c_IsLoaderIdle{!m_PrimaryLanguageRequestSequencer.isRequestPending() && !m_SecondaryLanguageRequestSequencer.isRequestPending()};
+    bool isSwitched{false};
+
+    if (c_IsLoaderIdle && languageIndex != m_PreloadedLanguageIndex && m_pDataSource->getNrOfEntries(languageIndex) != 0)
+    {
+        // still fails if an ongoing preload evicted the language in the meantime
+        isSwitched = m_pDataSource->updateDataEntries(QVector<DataSource::DataEntry>{}, languageIndex, DataSource::UpdateOperation::SET_AS_PRIMARY);
+    }
+
+    if (isSwitched)
+    {
+        m_pResidentLanguageHitsCounter->increment();
+        _markLanguageAsRecentlyUsed(languageIndex);
+
+        Q_EMIT dataEntryAllowed(true);
+
+        _startLanguagePreloading();
+    }
+
+    return isSwitched;
 }
 
 void GameManager::fetchDataForSecondaryLanguage(int languageIndex)
 {
-    Q_EMIT readDataForSecondaryLanguage(languageIndex);
+    _cancelLanguagePreloading();
+
+    Q_EMIT readDataForSecondaryLanguage(m_SecondaryLanguageRequestSequencer.issueRequest(), languageIndex);
+}
+
+void GameManager::setLanguagePreloadPolicy(bool isPreloadingEnabled, const QVector<int>& preferredLanguageIndexes)
+{
+    m_IsLanguagePreloadingEnabled = isPreloadingEnabled;
+    m_PreferredPreloadLanguageIndexes = preferredLanguageIndexes;
+
+    if (!m_IsLanguagePreloadingEnabled)
+    {
+        _cancelLanguagePreloading();
+    }
 }
 
 void GameManager::requestWriteToCache(QPair<QString, QString> newWordsPair, bool areSynonyms, int languageIndex)
@@ -116,12 +198,12 @@ void GameManager::requestWriteToCache(QPair<QString, QString> newWordsPair, bool
 
 void GameManager::requestCacheReset()
 {
-    Q_EMIT resetCacheRequested();
+    Q_EMIT resetCacheRequested(m_CacheRequestSequencer.issueRequest());
 }
 
 void GameManager::saveDataToDb()
 {
-    Q_EMIT writeDataToDb();
+    Q_EMIT writeDataToDb(m_CacheRequestSequencer.issueRequest());
 }
 
 void GameManager::provideDataEntryToConsumer(int entryNumber)
@@ -129,11 +211,42 @@ void GameManager::provideDataEntryToConsumer(int entryNumber)
     m_pDataSource->provideDataEntryToConsumer(entryNumber);
 }
 
+void GameManager::prefetchWordsPair(int entryNumber, int languageIndex, Game::Levels level, quint32 mixSeed)
+{
+    Q_EMIT wordsPairPrefetchRequested(m_WordsPairPrefetchRequestSequencer.issueRequest(), entryNumber, languageIndex, level, mixSeed);
+}
+
+void GameManager::discardPrefetchedWordsPairs()
+{
+    m_LastDiscardedWordsPairPrefetchRequestId = m_WordsPairPrefetchRequestSequencer.getLastIssuedRequestId();
+}
+
 void GameManager::releaseResources()
 {
     _deallocResources();
 }
 
+MetricsRegistry::Snapshot GameManager::getMetricsSnapshot() const
+{
+    MetricsRegistry* const c_pMetricsRegistry{MetricsRegistry::getRegistry()};
+
+    // data source is only available once the environment has been set
+    if (m_pDataSource)
+    {
+        for (int languageIndex{0}; languageIndex < Database::Query::c_LanguageCodes.size(); ++languageIndex)
+        {
+            const QString c_Labels{QString{"language=\"%1\""}.arg(Database::Query::c_LanguageCodes[languageIndex])};
+
+            c_pMetricsRegistry->getGauge("synant_language_entries", "Number of entries of each language kept resident in data source (0 if not resident).", c_Labels)
+                ->set(m_pDataSource->getNrOfEntries(languageIndex));
+        }
+
+        c_pMetricsRegistry->getGauge("synant_data_source_memory_bytes", "Estimated memory used by the resident languages of data source.")->set(m_pDataSource->getMemoryUsage());
+    }
+
+    return c_pMetricsRegistry->getSnapshot();
+}
+
 uint16_t GameManager::getInvalidPairEntryReasonCode() const
 {
     return m_pDataEntryValidator->getInvalidPairReasonCode();
@@ -205,32 +318,89 @@ GameManager::~GameManager()
     m_pDataSourceLoaderThread->wait();
     m_pDataEntryCacheThread->quit();
     m_pDataEntryCacheThread->wait();
+    m_pWordPairPrefetcherThread->quit();
+    m_pWordPairPrefetcherThread->wait();
+}
+
+void GameManager::_onLoadDataFromDbForPrimaryLanguageFirstChunkReady(int requestId, int languageIndex, int nrOfEntries)
+{
+    // chunks loaded for an obsolete request should not reach the facade
+    if (m_PrimaryLanguageRequestSequencer.isLatestRequest(requestId))
+    {
+        Q_EMIT fetchDataForPrimaryLanguageFirstChunkReady(languageIndex, nrOfEntries);
+    }
+}
+
+void GameManager::_onLoadDataFromDbForPrimaryLanguageChunkReady(int requestId, int languageIndex, int nrOfEntries)
+{
+    if (m_PrimaryLanguageRequestSequencer.isLatestRequest(requestId))
+    {
+        Q_EMIT fetchDataForPrimaryLanguageChunkReady(languageIndex, nrOfEntries);
+    }
 }
 
-void GameManager::_onLoadDataFromDbForPrimaryLanguageFinished(bool success, bool validEntriesLoaded)
+void GameManager::_onLoadDataFromDbForPrimaryLanguageFinished(int requestId, bool success, bool validEntriesLoaded)
 {
-    Q_EMIT fetchDataForPrimaryLanguageFinished(success, validEntriesLoaded);
-    Q_EMIT dataEntryAllowed(success);
+    if (m_PrimaryLanguageRequestSequencer.acknowledgeRequest(requestId))
+    {
+        Q_EMIT fetchDataForPrimaryLanguageFinished(success, validEntriesLoaded);
+        Q_EMIT dataEntryAllowed(success);
+
+        if (success)
+        {
+            _startLanguagePreloading();
+        }
+    }
 }
 
-void GameManager::_onRequestedPrimaryLanguageAlreadyContainedInDataSource(bool entriesAvailable)
+void GameManager::_onRequestedPrimaryLanguageAlreadyContainedInDataSource(int requestId, bool entriesAvailable)
 {
-    Q_EMIT fetchDataForPrimaryLanguageFinished(true, entriesAvailable);
-    Q_EMIT dataEntryAllowed(true);
+    if (m_PrimaryLanguageRequestSequencer.acknowledgeRequest(requestId))
+    {
+        Q_EMIT fetchDataForPrimaryLanguageFinished(true, entriesAvailable);
+        Q_EMIT dataEntryAllowed(true);
+
+        _startLanguagePreloading();
+    }
 }
 
-void GameManager::_onLoadDataFromDbForSecondaryLanguageFinished(bool success)
+void GameManager::_onLoadDataFromDbForSecondaryLanguageFinished(int requestId, bool success)
 {
-    // keep exactly this order
-    Q_EMIT fetchDataForSecondaryLanguageFinished(success);
-    Q_EMIT fetchDataForDataEntryLanguageFinished(success);
+    if (m_SecondaryLanguageRequestSequencer.acknowledgeRequest(requestId))
+    {
+        // keep exactly this order
+        Q_EMIT fetchDataForSecondaryLanguageFinished(success);
+        Q_EMIT fetchDataForDataEntryLanguageFinished(success);
+
+        // the preloads dropped when the secondary language has been requested are resumed
+        _startLanguagePreloading();
+    }
 }
 
-void GameManager::_onRequestedSecondaryLanguageAlreadySetAsPrimary()
+void GameManager::_onRequestedSecondaryLanguageAlreadySetAsPrimary(int requestId)
 {
-    // keep exactly this order
-    Q_EMIT fetchDataForSecondaryLanguageFinished(true);
-    Q_EMIT fetchDataForDataEntryLanguageFinished(true);
+    if (m_SecondaryLanguageRequestSequencer.acknowledgeRequest(requestId))
+    {
+        // keep exactly this order
+        Q_EMIT fetchDataForSecondaryLanguageFinished(true);
+        Q_EMIT fetchDataForDataEntryLanguageFinished(true);
+
+        _startLanguagePreloading();
+    }
+}
+
+void GameManager::_onPreloadLanguageFinished(int languageIndex, bool success)
+{
+    Q_ASSERT(languageIndex == m_PreloadedLanguageIndex);
+
+    m_PreloadedLanguageIndex = -1;
+
+    if (!success)
+    {
+        qInfo("Language %s has not been preloaded (canceled or unavailable)", qUtf8Printable(Database::Query::c_LanguageCodes.at(languageIndex)));
+    }
+
+    _requestNextLanguagePreload();
 }
 
 void GameManager::_onNewWordsPairAddedToCache()
@@ -250,24 +420,33 @@ void GameManager::_onAddInvalidWordsPairRequested()
     Q_EMIT addInvalidWordsPairRequested();
 }
 
-void GameManager::_onCacheReset()
+void GameManager::_onCacheReset(int requestId)
 {
+    Q_UNUSED(m_CacheRequestSequencer.acknowledgeRequest(requestId));
+
     // keep exactly this execution order (statistics signal should always be executed first)
     Q_EMIT currentEntriesStatisticsResetRequested();
     Q_EMIT cacheReset();
 }
 
-void GameManager::_onWriteDataToDbFinished(int nrOfPrimaryLanguageSavedEntries, int totalNrOfSavedEntries)
+void GameManager::_onWriteDataToDbFinished(int requestId, int nrOfPrimaryLanguageSavedEntries, int totalNrOfSavedEntries)
 {
+    Q_UNUSED(m_CacheRequestSequencer.acknowledgeRequest(requestId));
+
     // keep exactly this execution order (statistics signal should always be executed first)
     Q_EMIT dataSavedStatisticsUpdateRequested(nrOfPrimaryLanguageSavedEntries, totalNrOfSavedEntries);
     Q_EMIT primaryLanguageDataSavingFinished(nrOfPrimaryLanguageSavedEntries);
     Q_EMIT writeDataToDbFinished();
 }
 
-void GameManager::_onWriteDataToDbErrorOccured()
+void GameManager::_onWriteDataToDbErrorOccured(int requestId, QVector<DataSource::DataEntry> failedEntries)
 {
-    Q_EMIT dataSavingErrorOccured();
+    Q_UNUSED(m_CacheRequestSequencer.acknowledgeRequest(requestId));
+
+    qWarning("Cannot save %d words pairs to database", static_cast<int>(failedEntries.size()));
+
+    // the failed entries are still in cache, the user can either save them again or discard them
+    Q_EMIT dataSavingErrorOccured(failedEntries);
 }
 
 void GameManager::_onEntryProvidedToConsumer(QPair<QString, QString> newWordsPair, bool areSynonyms)
@@ -275,6 +454,17 @@ void GameManager::_onEntryProvidedToConsumer(QPair<QString, QString> newWordsPai
     Q_EMIT entryProvidedToConsumer(newWordsPair, areSynonyms);
 }
 
+void GameManager::_onWordsPairPrefetched(int requestId, bool success, WordMixer::MixedWordsPair mixedWordsPair)
+{
+    Q_UNUSED(m_WordsPairPrefetchRequestSequencer.acknowledgeRequest(requestId));
+
+    // pairs requested before the game level or language changed should not reach the facade
+    if (requestId > m_LastDiscardedWordsPairPrefetchRequestId)
+    {
+        Q_EMIT wordsPairPrefetched(success, mixedWordsPair);
+    }
+}
+
 void GameManager::_deallocResources()
 {
     if (s_pGameManager)
@@ -334,6 +524,21 @@ void GameManager::_setDatabase(const QString& databasePath)
                     throw GameException{Database::Error::c_TableIsInvalid};
                 }
             }
+
+            // migration: the indexes are created (only once) for existing databases too
+            QSqlQuery createIndexQuery;
+
+            if (!createIndexQuery.exec(Database::Query::c_CreateLanguageIndexQuery))
+            {
+                throw GameException{Database::Error::c_CannotCreateIndex};
+            }
+
+            // not fatal: databases created by previous versions might already contain duplicate pairs (the validator still prevents new duplicates from being added)
+            if (!createIndexQuery.exec(Database::Query::c_CreateUniquePairIndexQuery))
+            {
+                qWarning("Cannot create the unique word pair index, the database might contain duplicate pairs");
+            }
+
             db.close();
         }
         else
@@ -358,14 +563,22 @@ void GameManager::_makeDataConnections()
     Q_ASSERT(m_pDataEntryStatistics);
     Q_ASSERT(m_pDataEntryValidator);
     Q_ASSERT(m_pDataSource);
+    Q_ASSERT(m_pWordPairPrefetcher);
+    Q_ASSERT(m_pWordPairPrefetcherThread);
 
     // loader
     auto connected{connect(m_pDataSourceLoaderThread, &QThread::finished, m_pDataSourceLoader, &DataSourceLoader::deleteLater)};
     Q_ASSERT(connected);
+    connected = connect(this, &GameManager::openDatabaseConnectionsRequested, m_pDataSourceLoader, &DataSourceLoader::onOpenDatabaseConnectionRequested, Qt::QueuedConnection);
+    Q_ASSERT(connected);
     connected = connect(this, &GameManager::readDataForPrimaryLanguage, m_pDataSourceLoader, &DataSourceLoader::onLoadDataFromDbForPrimaryLanguageRequested, Qt::QueuedConnection);
     Q_ASSERT(connected);
     connected = connect(this, &GameManager::readDataForSecondaryLanguage, m_pDataSourceLoader, &DataSourceLoader::onLoadDataFromDbForSecondaryLanguageRequested, Qt::QueuedConnection);
     Q_ASSERT(connected);
+    connected = connect(m_pDataSourceLoader, &DataSourceLoader::loadDataFromDbForPrimaryLanguageFirstChunkReady, this, &GameManager::_onLoadDataFromDbForPrimaryLanguageFirstChunkReady, Qt::QueuedConnection);
+    Q_ASSERT(connected);
+    connected = connect(m_pDataSourceLoader, &DataSourceLoader::loadDataFromDbForPrimaryLanguageChunkReady, this, &GameManager::_onLoadDataFromDbForPrimaryLanguageChunkReady, Qt::QueuedConnection);
+    Q_ASSERT(connected);
     connected = connect(m_pDataSourceLoader, &DataSourceLoader::loadDataFromDbForPrimaryLanguageFinished, this, &GameManager::_onLoadDataFromDbForPrimaryLanguageFinished, Qt::QueuedConnection);
     Q_ASSERT(connected);
     connected = connect(m_pDataSourceLoader, &DataSourceLoader::requestedPrimaryLanguageAlreadyContainedInDataSource, this, &GameManager::_onRequestedPrimaryLanguageAlreadyContainedInDataSource, Qt::QueuedConnection);
@@ -374,10 +587,16 @@ void GameManager::_makeDataConnections()
     Q_ASSERT(connected);
     connected = connect(m_pDataSourceLoader, &DataSourceLoader::requestedSecondaryLanguageAlreadySetAsPrimary, this, &GameManager::_onRequestedSecondaryLanguageAlreadySetAsPrimary, Qt::QueuedConnection);
     Q_ASSERT(connected);
+    connected = connect(this, &GameManager::preloadLanguageRequested, m_pDataSourceLoader, &DataSourceLoader::onPreloadLanguageRequested, Qt::QueuedConnection);
+    Q_ASSERT(connected);
+    connected = connect(m_pDataSourceLoader, &DataSourceLoader::preloadLanguageFinished, this, &GameManager::_onPreloadLanguageFinished, Qt::QueuedConnection);
+    Q_ASSERT(connected);
 
     // cache
     connected = connect(m_pDataEntryCacheThread, &QThread::finished, m_pDataEntryCache, &DataEntryCache::deleteLater);
     Q_ASSERT(connected);
+    connected = connect(this, &GameManager::openDatabaseConnectionsRequested, m_pDataEntryCache, &DataEntryCache::onOpenDatabaseConnectionRequested, Qt::QueuedConnection);
+    Q_ASSERT(connected);
     connected = connect(this, &GameManager::writeDataToDb, m_pDataEntryCache, &DataEntryCache::onWriteDataToDbRequested, Qt::QueuedConnection);
     Q_ASSERT(connected);
     connected = connect(this, &GameManager::resetCacheRequested, m_pDataEntryCache, &DataEntryCache::onResetCacheRequested, Qt::QueuedConnection);
@@ -403,6 +622,14 @@ void GameManager::_makeDataConnections()
     connected = connect(m_pDataSource, &DataSource::entryProvidedToConsumer, this, &GameManager::_onEntryProvidedToConsumer, Qt::DirectConnection);
     Q_ASSERT(connected);
 
+    // words pair prefetcher
+    connected = connect(m_pWordPairPrefetcherThread, &QThread::finished, m_pWordPairPrefetcher, &WordPairPrefetcher::deleteLater);
+    Q_ASSERT(connected);
+    connected = connect(this, &GameManager::wordsPairPrefetchRequested, m_pWordPairPrefetcher, &WordPairPrefetcher::onWordsPairPrefetchRequested, Qt::QueuedConnection);
+    Q_ASSERT(connected);
+    connected = connect(m_pWordPairPrefetcher, &WordPairPrefetcher::wordsPairPrefetched, this, &GameManager::_onWordsPairPrefetched, Qt::QueuedConnection);
+    Q_ASSERT(connected);
+
     // data entry statistics
     connected = connect(this, &GameManager::recordAddedPairRequested, m_pDataEntryStatistics, &DataEntryStatistics::onRecordAddedPairRequested, Qt::DirectConnection);
     Q_ASSERT(connected);
@@ -415,4 +642,79 @@ void GameManager::_makeDataConnections()
 void GameManager::_registerMetaTypes()
 {
     Q_UNUSED(qRegisterMetaType<DataSource::DataEntry>());
+    Q_UNUSED(qRegisterMetaType<QVector<DataSource::DataEntry>>());
+    Q_UNUSED(qRegisterMetaType<WordMixer::MixedWordsPair>());
+    Q_UNUSED(qRegisterMetaType<Game::Levels>());
+}
+
+void GameManager::_cancelLanguagePreloading()
+{
+    m_PendingPreloadLanguageIndexes.clear();
+
+    // the finished notification of the aborted preload still arrives (and gets ignored as nothing is pending anymore)
+    if (m_PreloadedLanguageIndex != -1)
+    {
+        m_pDataSourceLoader->cancelPreload();
+    }
+}
+
+void GameManager::_startLanguagePreloading()
+{
+    m_PendingPreloadLanguageIndexes.clear();
+
+    if (m_IsLanguagePreloadingEnabled)
+    {
+        const int c_PrimaryLanguageIndex{m_pDataSource->getPrimarySourceLanguageIndex()};
+
+        QVector<int> candidateLanguageIndexes{m_PreferredPreloadLanguageIndexes};
+        candidateLanguageIndexes.append(m_RecentlyUsedLanguageIndexes);
+
+        for (auto languageIndex : candidateLanguageIndexes)
+        {
+            if (m_PendingPreloadLanguageIndexes.size() == sc_MaxNrOfPreloadedLanguages)
+            {
+                break;
+            }
+
+            const bool c_IsValidCandidate{languageIndex >= 0 &&
+                                          languageIndex < Database::Query::c_LanguageCodes.size() &&
+                                          languageIndex != c_PrimaryLanguageIndex &&
+                                          !m_PendingPreloadLanguageIndexes.contains(languageIndex) &&
+                                          !m_pDataSource->isLanguageResident(languageIndex)};
+
+            if (c_IsValidCandidate)
+            {
+                m_PendingPreloadLanguageIndexes.append(languageIndex);
+            }
+        }
+
+        // the next preload is requested when the ongoing one (if any) is finished
+        if (m_PreloadedLanguageIndex == -1)
+        {
+            _requestNextLanguagePreload();
+        }
+    }
+}
+
+void GameManager::_requestNextLanguagePreload()
+{
+    // loader is considered idle only when no real language request is waiting for an acknowledgement
+    const bool c_IsLoaderIdle{!m_PrimaryLanguageRequestSequencer.isRequestPending() && !m_SecondaryLanguageRequestSequencer.isRequestPending()};
+
+    if (c_IsLoaderIdle && !m_PendingPreloadLanguageIndexes.isEmpty())
+    {
+        m_PreloadedLanguageIndex = m_PendingPreloadLanguageIndexes.takeFirst();
+        Q_EMIT preloadLanguageRequested(m_PreloadedLanguageIndex);
+    }
+}
+
+void GameManager::_markLanguageAsRecentlyUsed(int languageIndex)
+{
+    m_RecentlyUsedLanguageIndexes.removeAll(languageIndex);
+    m_RecentlyUsedLanguageIndexes.prepend(languageIndex);
+
+    if (m_RecentlyUsedLanguageIndexes.size() > sc_MaxNrOfRecentlyUsedLanguages)
+    {
+        m_RecentlyUsedLanguageIndexes.removeLast();
+    }
 }
@@ -9,6 +9,7 @@
        - DataEntryValidator
        - DataEntryCache
        - WordMixer
+       - WordPairPrefetcher
        - WordPairOwner
        - InputBuilder
        - StatisticsItem
@@ -16,6 +17,9 @@
     2) Sets up database and manages the data connections (data source, loader, validator and cache); controls the data related functionality (loading, entry, validation, save to DB)
     3) Makes the non-facade game components connections (InputBuilder, WordPairOwner, WordMixer)
     4) Is responsible for creating/managing threads
+    5) Forwards the words pairs mixed in advance by WordPairPrefetcher to facade (the ones requested before the last discard are dropped)
+    6) Preloads the languages most likely to be requested next (configured ones first, then the recently used ones) while the loader is idle, so switching to them requires no database access
+    7) Provides the snapshots of the runtime metrics, the data source gauges (entries per language, memory usage) being refreshed right before taking them
 
    Other notes:
    - implemented as singleton so it is easily accessible from more parts of the code
@@ -33,6 +37,10 @@
 #include "../ManagementInterfaces/dataentryinterface.h"
 #include "../ManagementInterfaces/gameinterface.h"
 #include "../ManagementInterfaces/datainterface.h"
+#include "../DataAccess/datasource.h"
+#include "../CoreFunctionality/wordmixer.h"
+#include "../Utilities/requestsequencer.h"
+#include "../Utilities/metricsregistry.h"
 
 class GameFacade;
 class DataEntryFacade;
@@ -43,6 +51,7 @@ class DataEntryCache;
 class DataEntryStatistics;
 class DataSourceAccessHelper;
 class WordMixer;
+class WordPairPrefetcher;
 class WordPairOwner;
 class InputBuilder;
 class StatisticsItem;
@@ -61,15 +70,24 @@ class GameManager : public QObject,
 public:
     static GameManager* getManager();
 
+    // should be called before setting the environment, otherwise the journal mode of the database is kept
+    void enableWriteAheadLogging();
     void setEnvironment(const QString& dataDirPath);
     void fetchDataForPrimaryLanguage(int languageIndex, bool allowEmptyResult);
+    bool switchToResidentPrimaryLanguage(int languageIndex);
     void fetchDataForSecondaryLanguage(int languageIndex);
+    void setLanguagePreloadPolicy(bool isPreloadingEnabled, const QVector<int>& preferredLanguageIndexes);
     void requestWriteToCache(QPair<QString, QString> newWordsPair, bool areSynonyms, int languageIndex);
     void requestCacheReset();
     void saveDataToDb();
     void provideDataEntryToConsumer(int entryNumber);
+    void prefetchWordsPair(int entryNumber, int languageIndex, Game::Levels level, quint32 mixSeed);
+    void discardPrefetchedWordsPairs();
     void releaseResources();
 
+    // can be called at any time (e.g. periodically for exporting the metrics)
+    MetricsRegistry::Snapshot getMetricsSnapshot() const;
+
     uint16_t getInvalidPairEntryReasonCode() const;
     int getNrOfDataSourceEntries() const;
     int getLastSavedTotalNrOfEntries() const;
@@ -87,11 +105,14 @@ public:
 
 signals:
     // game functionality proxy
+    Q_SIGNAL void fetchDataForPrimaryLanguageFirstChunkReady(int languageIndex, int nrOfEntries);
+    Q_SIGNAL void fetchDataForPrimaryLanguageChunkReady(int languageIndex, int nrOfEntries);
     Q_SIGNAL void fetchDataForPrimaryLanguageFinished(bool success, bool validEntriesLoaded);
     Q_SIGNAL void fetchDataForSecondaryLanguageFinished(bool success);
     Q_SIGNAL void primaryLanguageDataSavingFinished(int nrOfPrimaryLanguageSavedEntries);
-    Q_SIGNAL void dataSavingErrorOccured();
+    Q_SIGNAL void dataSavingErrorOccured(QVector<DataSource::DataEntry> failedEntries);
     Q_SIGNAL void entryProvidedToConsumer(QPair<QString, QString> newWordsPair, bool areSynonyms);
+    Q_SIGNAL void wordsPairPrefetched(bool success, WordMixer::MixedWordsPair mixedWordsPair);
 
     // data entry proxy
     Q_SIGNAL void dataEntryAllowed(bool allowed);
@@ -109,23 +130,32 @@ signals:
 
     // data source, loader, cache
     Q_SIGNAL void dataSourceSetupCompleted();
-    Q_SIGNAL void readDataForPrimaryLanguage(int languageIndex, bool allowEmptyResult);
-    Q_SIGNAL void readDataForSecondaryLanguage(int languageIndex);
-    Q_SIGNAL void writeDataToDb();
-    Q_SIGNAL void resetCacheRequested();
+    Q_SIGNAL void openDatabaseConnectionsRequested();
+    Q_SIGNAL void readDataForPrimaryLanguage(int requestId, int languageIndex, bool allowEmptyResult);
+    Q_SIGNAL void readDataForSecondaryLanguage(int requestId, int languageIndex);
+    Q_SIGNAL void preloadLanguageRequested(int languageIndex);
+    Q_SIGNAL void writeDataToDb(int requestId);
+    Q_SIGNAL void resetCacheRequested(int requestId);
+
+    // words pair prefetcher
+    Q_SIGNAL void wordsPairPrefetchRequested(int requestId, int entryNumber, int languageIndex, Game::Levels level, quint32 mixSeed);
 
 private slots:
-    void _onLoadDataFromDbForPrimaryLanguageFinished(bool success, bool validEntriesLoaded);
-    void _onRequestedPrimaryLanguageAlreadyContainedInDataSource(bool validEntriesLoaded);
-    void _onLoadDataFromDbForSecondaryLanguageFinished(bool success);
-    void _onRequestedSecondaryLanguageAlreadySetAsPrimary();
+    void _onLoadDataFromDbForPrimaryLanguageFirstChunkReady(int requestId, int languageIndex, int nrOfEntries);
+    void _onLoadDataFromDbForPrimaryLanguageChunkReady(int requestId, int languageIndex, int nrOfEntries);
+    void _onLoadDataFromDbForPrimaryLanguageFinished(int requestId, bool success, bool validEntriesLoaded);
+    void _onRequestedPrimaryLanguageAlreadyContainedInDataSource(int requestId, bool validEntriesLoaded);
+    void _onLoadDataFromDbForSecondaryLanguageFinished(int requestId, bool success);
+    void _onRequestedSecondaryLanguageAlreadySetAsPrimary(int requestId);
+    void _onPreloadLanguageFinished(int languageIndex, bool success);
     void _onNewWordsPairAddedToCache();
     void _onWordsPairAlreadyContainedInCache();
     void _onAddInvalidWordsPairRequested();
-    void _onCacheReset();
-    void _onWriteDataToDbFinished(int nrOfPrimaryLanguageSavedEntries, int totalNrOfSavedEntries);
-    void _onWriteDataToDbErrorOccured();
+    void _onCacheReset(int requestId);
+    void _onWriteDataToDbFinished(int requestId, int nrOfPrimaryLanguageSavedEntries, int totalNrOfSavedEntries);
+    void _onWriteDataToDbErrorOccured(int requestId, QVector<DataSource::DataEntry> failedEntries);
     void _onEntryProvidedToConsumer(QPair<QString, QString> newWordsPair, bool areSynonyms);
+    void _onWordsPairPrefetched(int requestId, bool success, WordMixer::MixedWordsPair mixedWordsPair);
 
 private:
     explicit GameManager(QObject *parent = nullptr);
@@ -136,8 +166,14 @@ private:
     void _setDatabase(const QString& databasePath);
     void _makeDataConnections();
     void _registerMetaTypes();
+    void _cancelLanguagePreloading();
+    void _startLanguagePreloading();
+    void _requestNextLanguagePreload();
+    void _markLanguageAsRecentlyUsed(int languageIndex);
 
     static constexpr int sc_RequiredNrOfDbTableFields{5};
+    static constexpr int sc_MaxNrOfPreloadedLanguages{2};
+    static constexpr int sc_MaxNrOfRecentlyUsedLanguages{4};
 
     static GameManager* s_pGameManager;
 
@@ -150,6 +186,7 @@ private:
     DataEntryStatistics* m_pDataEntryStatistics;
     DataSourceAccessHelper* m_pDataSourceAccessHelper;
     WordMixer* m_pWordMixer;
+    WordPairPrefetcher* m_pWordPairPrefetcher;
     WordPairOwner* m_pWordPairOwner;
     InputBuilder* m_pInputBuilder;
     StatisticsItem* m_pStatisticsItem;
@@ -157,6 +194,28 @@ private:
 
     QThread* m_pDataSourceLoaderThread;
     QThread* m_pDataEntryCacheThread;
+    QThread* m_pWordPairPrefetcherThread;
+
+    bool m_IsWriteAheadLoggingEnabled;
+
+    // a newer language request makes the older ones obsolete, the cache requests are all relevant and handled in the order they were issued
+    RequestSequencer m_PrimaryLanguageRequestSequencer;
+    RequestSequencer m_SecondaryLanguageRequestSequencer;
+    RequestSequencer m_CacheRequestSequencer;
+
+    // all prefetch requests are acknowledged in order, the ones issued up to (including) the last discarded ID are no longer relevant
+    RequestSequencer m_WordsPairPrefetchRequestSequencer;
+    int m_LastDiscardedWordsPairPrefetchRequestId;
+
+    // at most one preload is queued to loader at a time so a real language request never waits behind more than one (canceled) preload
+    bool m_IsLanguagePreloadingEnabled;
+    QVector<int> m_PreferredPreloadLanguageIndexes;
+    QVector<int> m_RecentlyUsedLanguageIndexes; // most recently used first
+    QVector<int> m_PendingPreloadLanguageIndexes;
+    int m_PreloadedLanguageIndex; // -1 when no preload is ongoing
+
+    // same counter as the loader one, the resident languages switched to synchronously bypass the loader
+    MetricsRegistry::Counter* m_pResidentLanguageHitsCounter;
 };
 
 #endif // GAMEMANAGER_H
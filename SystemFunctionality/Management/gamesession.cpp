@@ -0,0 +1,327 @@
+#include "gamesession.h"
+#include "datasource.h"
+#include "datasourceaccesshelper.h"
+#include "wordmixer.h"
+#include "wordpairowner.h"
+#include "inputbuilder.h"
+#include "statisticsitem.h"
+#include "chronometer.h"
+
+GameSession::GameSession(int sessionId, DataSource* pDataSource, QObject *parent)
+    : QObject(parent)
+    , m_SessionId{sessionId}
+    , m_pDataSource{pDataSource}
+    , m_pDataSourceAccessHelper{new DataSourceAccessHelper{this}}
+    , m_pWordMixer{new WordMixer{this}}
+    , m_pWordPairOwner{new WordPairOwner{this}}
+    , m_pInputBuilder{new InputBuilder{this}}
+    , m_pStatisticsItem{new StatisticsItem{this}}
+    , m_pChronometer{new Chronometer{this}}
+    , m_GameLevel{Game::Levels::LEVEL_MEDIUM}
+    , m_LanguageIndex{-1}
+    , m_IsLanguagePinned{false}
+    , m_IsWordsPairAvailable{false}
+{
+    Q_ASSERT(m_pDataSource);
+
+    // same component interactions as in the facade (persistent mode excluded)
+    auto connected{connect(m_pWordPairOwner, &WordPairOwner::piecesAddedToInputStateChanged, this, &GameSession::_onPiecesAddedToInputStateChanged)};
+    Q_ASSERT(connected);
+    connected = connect(m_pInputBuilder, &InputBuilder::pieceAddedToInput, this, &GameSession::_onPieceAddedToInput);
+    Q_ASSERT(connected);
+    connected = connect(m_pInputBuilder, &InputBuilder::piecesRemovedFromInput, this, &GameSession::_onPiecesRemovedFromInput);
+    Q_ASSERT(connected);
+    connected = connect(m_pChronometer, &Chronometer::timeoutTriggered, this, &GameSession::_onChronometerTimeoutTriggered);
+    Q_ASSERT(connected);
+
+    m_pWordMixer->setGameLevel(m_GameLevel);
+    m_pStatisticsItem->setGameLevel(m_GameLevel);
+    m_pStatisticsItem->doInitialUpdate();
+    m_pChronometer->setTotalCountdownTime(Game::c_TimeLimits[m_GameLevel]);
+}
+
+GameSession::~GameSession()
+{
+    _unpinLanguage();
+}
+
+bool GameSession::setLanguage(int languageIndex)
+{
+    // the new language is pinned first, so it remains resident even if it is the same as the previous one
+    const bool c_IsLanguagePinned{m_pDataSource->pinLanguage(languageIndex)};
+
+    _unpinLanguage();
+
+    // the number of entries is taken once, the entries appended afterwards to the language are not used by the session
+    const int c_NrOfEntries{c_IsLanguagePinned ? m_pDataSource->getNrOfEntries(languageIndex) : 0};
+
+    m_LanguageIndex = languageIndex;
+    m_IsLanguagePinned = c_IsLanguagePinned;
+    m_pDataSourceAccessHelper->clearEntriesTable();
+    m_pDataSourceAccessHelper->setEntriesTable(c_NrOfEntries);
+
+    return _provideNextWordsPair();
+}
+
+void GameSession::setGameLevel(Game::Levels level)
+{
+    Q_ASSERT(level != Game::Levels::LEVEL_NONE);
+
+    if (level != m_GameLevel)
+    {
+        m_GameLevel = level;
+        m_pWordMixer->setGameLevel(m_GameLevel);
+        m_pStatisticsItem->setGameLevel(m_GameLevel);
+        m_pChronometer->setTotalCountdownTime(Game::c_TimeLimits[m_GameLevel]);
+
+        // the current pair should be split according to the new level
+        if (m_IsWordsPairAvailable)
+        {
+            Q_UNUSED(_provideNextWordsPair());
+        }
+    }
+}
+
+void GameSession::enableTimeLimit()
+{
+    m_pChronometer->enable();
+    m_pStatisticsItem->setEnhancedIncrement(true);
+
+    if (m_IsWordsPairAvailable)
+    {
+        m_pChronometer->start();
+    }
+}
+
+void GameSession::disableTimeLimit()
+{
+    m_pChronometer->disable();
+    m_pStatisticsItem->setEnhancedIncrement(false);
+}
+
+bool GameSession::addPieceToInputWord(Game::InputWordNumber inputWordNumber, int wordPieceIndex)
+{
+    bool pieceAdded{false};
+
+    if (m_IsWordsPairAvailable && wordPieceIndex >= 0 && wordPieceIndex < m_pWordPairOwner->getMixedWordsPiecesContent().size() &&
+        !m_pWordPairOwner->getIsWordPieceAddedToInput(wordPieceIndex))
+    {
+        pieceAdded = m_pInputBuilder->addPieceToInputWord(inputWordNumber, wordPieceIndex, m_pWordPairOwner->getWordPieceType(wordPieceIndex));
+    }
+
+    return pieceAdded;
+}
+
+bool GameSession::removePiecesFromInputWord(Game::InputWordNumber inputWordNumber, int inputRangeStart)
+{
+    return m_IsWordsPairAvailable && m_pInputBuilder->removePiecesFromInputWord(inputWordNumber, inputRangeStart);
+}
+
+bool GameSession::clearInput()
+{
+    return m_IsWordsPairAvailable && m_pInputBuilder->clearInput();
+}
+
+bool GameSession::handleSubmitRequest()
+{
+    bool success{false};
+
+    if (m_IsWordsPairAvailable)
+    {
+        const QVector<QString>& mixedWordPiecesContent{m_pWordPairOwner->getMixedWordsPiecesContent()};
+
+        QString firstInputWord;
+        QString secondInputWord;
+
+        for (auto index : m_pInputBuilder->getFirstWordInputIndexes())
+        {
+            firstInputWord.append(mixedWordPiecesContent.at(index));
+        }
+
+        for (auto index : m_pInputBuilder->getSecondWordInputIndexes())
+        {
+            secondInputWord.append(mixedWordPiecesContent.at(index));
+        }
+
+        success = (firstInputWord == m_pWordPairOwner->getFirstReferenceWord() && secondInputWord == m_pWordPairOwner->getSecondReferenceWord()) ||
+                  (firstInputWord == m_pWordPairOwner->getSecondReferenceWord() && secondInputWord == m_pWordPairOwner->getFirstReferenceWord());
+
+        if (success)
+        {
+            m_pStatisticsItem->updateStatistics(StatisticsItem::StatisticsUpdateOperations::FULL_UPDATE);
+            Q_UNUSED(_provideNextWordsPair());
+        }
+    }
+
+    return success;
+}
+
+void GameSession::provideCorrectWordsPairToUser()
+{
+    if (m_IsWordsPairAvailable)
+    {
+        m_pStatisticsItem->updateStatistics(StatisticsItem::StatisticsUpdateOperations::PARTIAL_UPDATE);
+        Q_UNUSED(_provideNextWordsPair());
+    }
+}
+
+void GameSession::resetStatistics()
+{
+    m_pStatisticsItem->updateStatistics(StatisticsItem::StatisticsUpdateOperations::RESET);
+}
+
+int GameSession::getSessionId() const
+{
+    return m_SessionId;
+}
+
+int GameSession::getLanguageIndex() const
+{
+    return m_LanguageIndex;
+}
+
+Game::Levels GameSession::getGameLevel() const
+{
+    return m_GameLevel;
+}
+
+bool GameSession::isWordsPairAvailable() const
+{
+    return m_IsWordsPairAvailable;
+}
+
+bool GameSession::isInputComplete() const
+{
+    return m_pInputBuilder->isInputComplete();
+}
+
+const QVector<QString>& GameSession::getMixedWordsPiecesContent() const
+{
+    return m_pWordPairOwner->getMixedWordsPiecesContent();
+}
+
+const QVector<Game::PieceTypes>& GameSession::getMixedWordsPiecesTypes() const
+{
+    return m_pWordPairOwner->getMixedWordsPiecesTypes();
+}
+
+const QVector<bool>& GameSession::getAreMixedWordsPiecesSelected() const
+{
+    return m_pWordPairOwner->getAreMixedWordsPiecesAddedToInput();
+}
+
+const QVector<int> GameSession::getFirstWordInputIndexes() const
+{
+    return m_pInputBuilder->getFirstWordInputIndexes();
+}
+
+const QVector<int> GameSession::getSecondWordInputIndexes() const
+{
+    return m_pInputBuilder->getSecondWordInputIndexes();
+}
+
+QString GameSession::getFirstReferenceWord() const
+{
+    return m_pWordPairOwner->getFirstReferenceWord();
+}
+
+QString GameSession::getSecondReferenceWord() const
+{
+    return m_pWordPairOwner->getSecondReferenceWord();
+}
+
+bool GameSession::areWordsFromCurrentPairSynonyms() const
+{
+    return m_pWordPairOwner->areSynonyms();
+}
+
+QString GameSession::getObtainedScore() const
+{
+    return m_pStatisticsItem->getObtainedScore();
+}
+
+QString GameSession::getTotalAvailableScore() const
+{
+    return m_pStatisticsItem->getTotalAvailableScore();
+}
+
+QString GameSession::getGuessedWordPairs() const
+{
+    return m_pStatisticsItem->getGuessedWordPairs();
+}
+
+QString GameSession::getTotalWordPairs() const
+{
+    return m_pStatisticsItem->getTotalWordPairs();
+}
+
+void GameSession::_onPiecesAddedToInputStateChanged()
+{
+    m_pInputBuilder->setCloseInputAllowed(m_pWordPairOwner->isOnePieceLeftToAddToInput());
+}
+
+void GameSession::_onPieceAddedToInput(int index)
+{
+    m_pWordPairOwner->markPieceAsAddedToInput(index);
+}
+
+void GameSession::_onPiecesRemovedFromInput(QVector<int> indexes)
+{
+    m_pWordPairOwner->markPiecesAsRemovedFromInput(indexes);
+}
+
+void GameSession::_onChronometerTimeoutTriggered()
+{
+    provideCorrectWordsPairToUser();
+}
+
+void GameSession::_unpinLanguage()
+{
+    if (m_IsLanguagePinned)
+    {
+        m_pDataSource->unpinLanguage(m_LanguageIndex);
+        m_IsLanguagePinned = false;
+    }
+}
+
+// the pair is mixed synchronously: each session already runs outside the GUI thread (no prefetching required)
+bool GameSession::_provideNextWordsPair()
+{
+    DataSource::DataEntry dataEntry;
+
+    m_IsWordsPairAvailable = m_pDataSourceAccessHelper->getTotalNrOfEntries() > 0 &&
+                             m_pDataSource->getDataEntry(m_pDataSourceAccessHelper->generateEntryNumber(), m_LanguageIndex, dataEntry);
+
+    if (m_IsWordsPairAvailable)
+    {
+        m_pWordMixer->mixWords(QPair<QString, QString>{dataEntry.firstWord, dataEntry.secondWord}, dataEntry.areSynonyms);
+
+        const WordMixer::MixedWordsPair c_MixedWordsPair{m_pWordMixer->getMixedWordsPair()};
+
+        m_pInputBuilder->resetInput();
+        m_pWordPairOwner->setNewWordsPair(c_MixedWordsPair.piecesContent,
+                                          c_MixedWordsPair.firstWord,
+                                          c_MixedWordsPair.secondWord,
+                                          c_MixedWordsPair.areSynonyms,
+                                          c_MixedWordsPair.firstWordFirstPieceIndex,
+                                          c_MixedWordsPair.firstWordLastPieceIndex,
+                                          c_MixedWordsPair.secondWordFirstPieceIndex,
+                                          c_MixedWordsPair.secondWordLastPieceIndex);
+
+        // restarting has no effect if the chronometer is not running yet (e.g. first pair or previous pair unavailable) so it is also started
+        if (m_pChronometer->isEnabled())
+        {
+            m_pChronometer->restart();
+            m_pChronometer->start();
+        }
+
+        Q_EMIT newWordsPairAvailable();
+    }
+    else
+    {
+        m_pChronometer->stop();
+        Q_EMIT wordsPairUnavailable();
+    }
+
+    return m_IsWordsPairAvailable;
+}
@@ -0,0 +1,100 @@
+/*
+   This class runs a single game independently from GameManager and the facade, so one process can host many games (e.g. kiosks, automated practice runs):
+   1) Owns its own core components (DataSourceAccessHelper, WordMixer, WordPairOwner, InputBuilder, StatisticsItem, Chronometer)
+   2) Reads the words pairs from a shared DataSource (the languages should be made resident by the owner of the data source), the session language being pinned so it doesn't get evicted while in use
+   3) Checks the user input against the reference words and advances to the next pair (same rules as the facade)
+
+   A session is not thread safe: it should only be accessed from the thread it lives in (see GameSessionPool).
+   The data source should outlive the session, the language pin is released when changing language or destroying the session.
+*/
+
+#ifndef GAMESESSION_H
+#define GAMESESSION_H
+
+#include <QObject>
+#include <QVector>
+
+#include "../Utilities/gameutils.h"
+
+class DataSource;
+class DataSourceAccessHelper;
+class WordMixer;
+class WordPairOwner;
+class InputBuilder;
+class StatisticsItem;
+class Chronometer;
+
+class GameSession : public QObject
+{
+    Q_OBJECT
+public:
+    explicit GameSession(int sessionId, DataSource* pDataSource, QObject *parent = nullptr);
+    ~GameSession();
+
+    // fails if the language is not resident in data source or has no entries
+    bool setLanguage(int languageIndex);
+    void setGameLevel(Game::Levels level);
+
+    void enableTimeLimit();
+    void disableTimeLimit();
+
+    bool addPieceToInputWord(Game::InputWordNumber inputWordNumber, int wordPieceIndex);
+    bool removePiecesFromInputWord(Game::InputWordNumber inputWordNumber, int inputRangeStart);
+    bool clearInput();
+
+    // returns true if the input is correct, in which case the next pair is provided
+    bool handleSubmitRequest();
+    void provideCorrectWordsPairToUser();
+    void resetStatistics();
+
+    int getSessionId() const;
+    int getLanguageIndex() const;
+    Game::Levels getGameLevel() const;
+    bool isWordsPairAvailable() const;
+    bool isInputComplete() const;
+
+    const QVector<QString>& getMixedWordsPiecesContent() const;
+    const QVector<Game::PieceTypes>& getMixedWordsPiecesTypes() const;
+    const QVector<bool>& getAreMixedWordsPiecesSelected() const;
+    const QVector<int> getFirstWordInputIndexes() const;
+    const QVector<int> getSecondWordInputIndexes() const;
+    QString getFirstReferenceWord() const;
+    QString getSecondReferenceWord() const;
+    bool areWordsFromCurrentPairSynonyms() const;
+
+    QString getObtainedScore() const;
+    QString getTotalAvailableScore() const;
+    QString getGuessedWordPairs() const;
+    QString getTotalWordPairs() const;
+
+signals:
+    Q_SIGNAL void newWordsPairAvailable();
+    Q_SIGNAL void wordsPairUnavailable();
+
+private slots:
+    void _onPiecesAddedToInputStateChanged();
+    void _onPieceAddedToInput(int index);
+    void _onPiecesRemovedFromInput(QVector<int> indexes);
+    void _onChronometerTimeoutTriggered();
+
+private:
+    bool _provideNextWordsPair();
+    void _unpinLanguage();
+
+    int m_SessionId;
+    DataSource* m_pDataSource;
+
+    DataSourceAccessHelper* m_pDataSourceAccessHelper;
+    WordMixer* m_pWordMixer;
+    WordPairOwner* m_pWordPairOwner;
+    InputBuilder* m_pInputBuilder;
+    StatisticsItem* m_pStatisticsItem;
+    Chronometer* m_pChronometer;
+
+    Game::Levels m_GameLevel;
+    int m_LanguageIndex;
+    bool m_IsLanguagePinned;
+    bool m_IsWordsPairAvailable;
+};
+
+#endif // GAMESESSION_H
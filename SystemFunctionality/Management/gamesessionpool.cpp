@@ -0,0 +1,105 @@
+#include <QThread>
+
+#include <algorithm>
+
+#include "gamesessionpool.h"
+#include "gamesessionshard.h"
+#include "gamesession.h"
+#include "datasource.h"
+
+GameSessionPool::GameSessionPool(DataSource* pDataSource, int nrOfShards, QObject *parent)
+    : QObject(parent)
+    , m_LastSessionId{0}
+{
+    Q_ASSERT(pDataSource);
+    Q_ASSERT(nrOfShards >= 0);
+
+    const int c_NrOfShards{nrOfShards > 0 ? nrOfShards : std::max(QThread::idealThreadCount(), 1)};
+
+    for (int shardIndex{0}; shardIndex < c_NrOfShards; ++shardIndex)
+    {
+        GameSessionShard* pShard{new GameSessionShard{pDataSource}};
+        QThread* pShardThread{new QThread{this}};
+
+        pShard->moveToThread(pShardThread);
+
+        auto connected{connect(pShardThread, &QThread::finished, pShard, &GameSessionShard::deleteLater)};
+        Q_ASSERT(connected);
+
+        pShardThread->start();
+        Q_ASSERT(pShardThread->isRunning());
+
+        m_Shards.append(pShard);
+        m_ShardThreads.append(pShardThread);
+    }
+}
+
+GameSessionPool::~GameSessionPool()
+{
+    /* quitting is queued behind the remaining tasks so they still get executed (QThread::quit() would drop the ones not yet dispatched),
+       the shards (and their sessions) get deleted once the threads are finished */
+    for (auto pShard : m_Shards)
+    {
+        const bool c_IsInvoked{QMetaObject::invokeMethod(pShard, []() {
+            QThread::currentThread()->quit();
+        }, Qt::QueuedConnection)};
+
+        Q_ASSERT(c_IsInvoked);
+    }
+
+    for (auto pShardThread : m_ShardThreads)
+    {
+        pShardThread->wait();
+    }
+}
+
+int GameSessionPool::createSession()
+{
+    const int c_SessionId{++m_LastSessionId};
+    GameSessionShard* pShard{m_Shards.at(getShardIndex(c_SessionId))};
+
+    // the session is created within the shard thread, so it can be used by the tasks requested right afterwards
+    const bool c_IsInvoked{QMetaObject::invokeMethod(pShard, [pShard, c_SessionId]() {
+        Q_UNUSED(pShard->createSession(c_SessionId));
+    }, Qt::QueuedConnection)};
+
+    Q_ASSERT(c_IsInvoked);
+
+    return c_SessionId;
+}
+
+void GameSessionPool::destroySession(int sessionId)
+{
+    GameSessionShard* pShard{m_Shards.at(getShardIndex(sessionId))};
+
+    const bool c_IsInvoked{QMetaObject::invokeMethod(pShard, [pShard, sessionId]() {
+        Q_UNUSED(pShard->destroySession(sessionId));
+    }, Qt::QueuedConnection)};
+
+    Q_ASSERT(c_IsInvoked);
+}
+
+void GameSessionPool::runInSession(int sessionId, SessionTask task)
+{
+    Q_ASSERT(task);
+
+    GameSessionShard* pShard{m_Shards.at(getShardIndex(sessionId))};
+
+    const bool c_IsInvoked{QMetaObject::invokeMethod(pShard, [pShard, sessionId, task]() {
+        task(pShard->getSession(sessionId));
+    }, Qt::QueuedConnection)};
+
+    Q_ASSERT(c_IsInvoked);
+}
+
+int GameSessionPool::getNrOfShards() const
+{
+    return static_cast<int>(m_Shards.size());
+}
+
+int GameSessionPool::getShardIndex(int sessionId) const
+{
+    Q_ASSERT(sessionId > 0);
+
+    return sessionId % getNrOfShards();
+}
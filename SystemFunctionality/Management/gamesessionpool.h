@@ -0,0 +1,52 @@
+/*
+   This class hosts many independent game sessions within the same process:
+   1) Creates a configurable number of worker threads (shards), by default one per core
+   2) Assigns each new session to a shard (round robin) and creates it within the shard thread
+   3) Executes the tasks requested for a session within its shard thread, so each session is only accessed by one thread and no locking is required
+   4) All sessions share the same data source: the entries are read lock free (see DataSource), only pinning the session languages requires locking
+
+   The pool itself should only be used from the thread that created it. The sessions and shards are destroyed when the pool gets destroyed.
+*/
+
+#ifndef GAMESESSIONPOOL_H
+#define GAMESESSIONPOOL_H
+
+#include <QObject>
+#include <QVector>
+
+#include <functional>
+
+class QThread;
+class DataSource;
+class GameSession;
+class GameSessionShard;
+
+class GameSessionPool : public QObject
+{
+    Q_OBJECT
+public:
+    // the task receives nullptr if the session doesn't exist (e.g. already destroyed)
+    using SessionTask = std::function<void(GameSession*)>;
+
+    explicit GameSessionPool(DataSource* pDataSource, int nrOfShards = 0, QObject *parent = nullptr); // 0: ideal number of threads
+    ~GameSessionPool();
+
+    int createSession();
+    void destroySession(int sessionId);
+
+    // tasks requested for the same session are executed in the order they have been requested
+    void runInSession(int sessionId, SessionTask task);
+
+    int getNrOfShards() const;
+    int getShardIndex(int sessionId) const;
+
+private:
+    GameSessionPool(const GameSessionPool&) = delete;
+    GameSessionPool& operator=(const GameSessionPool&) = delete;
+
+    QVector<GameSessionShard*> m_Shards;
+    QVector<QThread*> m_ShardThreads;
+    int m_LastSessionId;
+};
+
+#endif // GAMESESSIONPOOL_H
@@ -0,0 +1,43 @@
+#include "gamesessionshard.h"
+#include "gamesession.h"
+#include "datasource.h"
+
+GameSessionShard::GameSessionShard(DataSource* pDataSource, QObject *parent)
+    : QObject(parent)
+    , m_pDataSource{pDataSource}
+{
+    Q_ASSERT(m_pDataSource);
+}
+
+GameSession* GameSessionShard::createSession(int sessionId)
+{
+    Q_ASSERT(!m_Sessions.contains(sessionId));
+
+    GameSession* pSession{new GameSession{sessionId, m_pDataSource, this}};
+    m_Sessions.insert(sessionId, pSession);
+
+    return pSession;
+}
+
+bool GameSessionShard::destroySession(int sessionId)
+{
+    GameSession* pSession{m_Sessions.take(sessionId)};
+    const bool c_SessionExists{pSession != nullptr};
+
+    if (c_SessionExists)
+    {
+        delete pSession;
+    }
+
+    return c_SessionExists;
+}
+
+GameSession* GameSessionShard::getSession(int sessionId) const
+{
+    return m_Sessions.value(sessionId, nullptr);
+}
+
+int GameSessionShard::getNrOfSessions() const
+{
+    return static_cast<int>(m_Sessions.size());
+}
@@ -0,0 +1,35 @@
+/*
+   This class owns the game sessions assigned to a worker thread of the GameSessionPool:
+   1) Creates and destroys the sessions (always within the worker thread so all their objects, e.g. timers, belong to it)
+   2) Provides the sessions by ID to the tasks executed within the worker thread
+
+   It should only be accessed from the thread it has been moved to.
+*/
+
+#ifndef GAMESESSIONSHARD_H
+#define GAMESESSIONSHARD_H
+
+#include <QObject>
+#include <QHash>
+
+class DataSource;
+class GameSession;
+
+class GameSessionShard : public QObject
+{
+    Q_OBJECT
+public:
+    explicit GameSessionShard(DataSource* pDataSource, QObject *parent = nullptr);
+
+    GameSession* createSession(int sessionId);
+    bool destroySession(int sessionId);
+
+    GameSession* getSession(int sessionId) const; // nullptr if not existing
+    int getNrOfSessions() const;
+
+private:
+    DataSource* m_pDataSource;
+    QHash<int, GameSession*> m_Sessions; // sessions are parented by shard
+};
+
+#endif // GAMESESSIONSHARD_H
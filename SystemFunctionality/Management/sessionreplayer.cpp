@@ -0,0 +1,268 @@
+#include <QEventLoop>
+#include <QTimer>
+#include <QElapsedTimer>
+
+#include "sessionreplayer.h"
+#include "gamefacade.h"
+
+SessionReplayer::SessionReplayer(GameFacade* pGameFacade, QObject *parent)
+    : QObject(parent)
+    , m_pGameFacade{pGameFacade}
+    , m_NrOfReplayedCalls{0}
+    , m_NrOfDivergentSubmits{0}
+    , m_RecordedDuration{0}
+    , m_ReplayDuration{0}
+{
+    Q_ASSERT(m_pGameFacade);
+}
+
+bool SessionReplayer::replay(const QString& logFilePath)
+{
+    m_NrOfReplayedCalls = 0;
+    m_NrOfDivergentSubmits = 0;
+    m_RecordedDuration = 0;
+    m_ReplayDuration = 0;
+    m_ErrorMessage.clear();
+
+    SessionLog::Entry entry;
+    bool success{m_SessionLog.openForReading(logFilePath)};
+
+    if (!success)
+    {
+        m_ErrorMessage = "cannot read session log " + logFilePath;
+    }
+    else if (!m_SessionLog.readEntry(entry) || entry.event != SessionLog::Events::SESSION_STARTED)
+    {
+        success = false;
+        m_ErrorMessage = "the session log doesn't start with the session seed";
+    }
+    else if (!m_pGameFacade->enterReplayMode(entry.firstArgument))
+    {
+        success = false;
+        m_ErrorMessage = "the game facade cannot enter replay mode (language already set or recording in progress)";
+    }
+    else
+    {
+        QElapsedTimer elapsedTimer;
+        elapsedTimer.start();
+
+        while (success && !m_SessionLog.isAtEnd())
+        {
+            success = m_SessionLog.readEntry(entry);
+
+            if (!success)
+            {
+                m_ErrorMessage = "corrupted session log entry after " + QString::number(m_NrOfReplayedCalls) + " calls";
+            }
+            else
+            {
+                m_RecordedDuration += entry.elapsedTime;
+                success = _replayEntry(entry);
+            }
+        }
+
+        m_ReplayDuration = elapsedTimer.elapsed();
+        m_pGameFacade->exitReplayMode();
+    }
+
+    m_SessionLog.close();
+
+    return success;
+}
+
+int SessionReplayer::getNrOfReplayedCalls() const
+{
+    return m_NrOfReplayedCalls;
+}
+
+int SessionReplayer::getNrOfDivergentSubmits() const
+{
+    return m_NrOfDivergentSubmits;
+}
+
+qint64 SessionReplayer::getRecordedDuration() const
+{
+    return m_RecordedDuration;
+}
+
+qint64 SessionReplayer::getReplayDuration() const
+{
+    return m_ReplayDuration;
+}
+
+QString SessionReplayer::getErrorMessage() const
+{
+    return m_ErrorMessage;
+}
+
+bool SessionReplayer::_replayEntry(const SessionLog::Entry& entry)
+{
+    const bool c_IsInputWordNumberValid{entry.firstArgument <= static_cast<quint32>(Game::InputWordNumber::TWO)};
+    bool success{true};
+
+    switch (entry.event)
+    {
+    case SessionLog::Events::INIT:
+        m_pGameFacade->init();
+        break;
+    case SessionLog::Events::START_GAME:
+        m_pGameFacade->startGame();
+        break;
+    case SessionLog::Events::RESUME_GAME:
+        m_pGameFacade->resumeGame();
+        break;
+    case SessionLog::Events::PAUSE_GAME:
+        m_pGameFacade->pauseGame();
+        break;
+    case SessionLog::Events::QUIT_GAME:
+        m_pGameFacade->quitGame();
+        break;
+    case SessionLog::Events::SET_GAME_LEVEL:
+        success = entry.firstArgument < static_cast<quint32>(Game::Levels::LEVEL_NONE);
+
+        if (success)
+        {
+            m_pGameFacade->setGameLevel(static_cast<Game::Levels>(entry.firstArgument));
+        }
+        break;
+    case SessionLog::Events::SET_LANGUAGE:
+        m_pGameFacade->setLanguage(static_cast<int>(entry.firstArgument), entry.secondArgument != 0);
+        success = _waitForDataFetching();
+        break;
+    case SessionLog::Events::ENABLE_TIME_LIMIT:
+        m_pGameFacade->enableTimeLimit();
+        break;
+    case SessionLog::Events::DISABLE_TIME_LIMIT:
+        m_pGameFacade->disableTimeLimit();
+        break;
+    case SessionLog::Events::TIME_LIMIT_REACHED:
+        m_pGameFacade->replayTimeLimitReached();
+        break;
+    case SessionLog::Events::ENABLE_PERSISTENT_MODE:
+        m_pGameFacade->enablePersistentMode();
+        break;
+    case SessionLog::Events::DISABLE_PERSISTENT_MODE:
+        m_pGameFacade->disablePersistentMode();
+        break;
+    case SessionLog::Events::GO_TO_NEXT_PERSISTENT_MODE_CONTAINER:
+        m_pGameFacade->goToNextPersistentModeContainer();
+        break;
+    case SessionLog::Events::INCREASE_PERSISTENT_INDEX:
+        m_pGameFacade->increasePersistentIndex();
+        break;
+    case SessionLog::Events::DECREASE_PERSISTENT_INDEX:
+        m_pGameFacade->decreasePersistentIndex();
+        break;
+    case SessionLog::Events::EXECUTE_FIRST_PERSISTENT_MODE_ACTION:
+        m_pGameFacade->executeFirstPersistentModeAction();
+        break;
+    case SessionLog::Events::EXECUTE_SECOND_PERSISTENT_MODE_ACTION:
+        m_pGameFacade->executeSecondPersistentModeAction();
+        break;
+    case SessionLog::Events::ADD_PIECE_TO_INPUT_WORD:
+        success = c_IsInputWordNumberValid;
+
+        if (success)
+        {
+            m_pGameFacade->addPieceToInputWord(static_cast<Game::InputWordNumber>(entry.firstArgument), static_cast<int>(entry.secondArgument));
+        }
+        break;
+    case SessionLog::Events::REMOVE_PIECES_FROM_INPUT_WORD:
+        success = c_IsInputWordNumberValid;
+
+        if (success)
+        {
+            m_pGameFacade->removePiecesFromInputWord(static_cast<Game::InputWordNumber>(entry.firstArgument), static_cast<int>(entry.secondArgument));
+        }
+        break;
+    case SessionLog::Events::CLEAR_INPUT_WORD:
+        success = c_IsInputWordNumberValid;
+
+        if (success)
+        {
+            m_pGameFacade->clearInputWord(static_cast<Game::InputWordNumber>(entry.firstArgument));
+        }
+        break;
+    case SessionLog::Events::CLEAR_INPUT:
+        m_pGameFacade->clearInput();
+        break;
+    case SessionLog::Events::HANDLE_SUBMIT_REQUEST:
+    {
+        m_pGameFacade->handleSubmitRequest();
+
+        const bool c_IsInputCorrect{m_pGameFacade->getStatusCode() == GameFacade::StatusCodes::CORRECT_USER_INPUT};
+
+        if (c_IsInputCorrect != (entry.firstArgument != 0))
+        {
+            ++m_NrOfDivergentSubmits;
+        }
+    }
+        break;
+    case SessionLog::Events::PROVIDE_CORRECT_WORDS_PAIR_TO_USER:
+        m_pGameFacade->provideCorrectWordsPairToUser();
+        break;
+    case SessionLog::Events::RESET_GAME_STATISTICS:
+        m_pGameFacade->resetGameStatistics();
+        break;
+    case SessionLog::Events::HANDLE_DATA_SAVING_OPERATION_IN_PROGRESS:
+        m_pGameFacade->handleDataSavingOperationInProgress();
+        break;
+    default:
+        success = false;
+        break;
+    }
+
+    if (success)
+    {
+        ++m_NrOfReplayedCalls;
+    }
+    else if (m_ErrorMessage.isEmpty())
+    {
+        m_ErrorMessage = "cannot replay call number " + QString::number(m_NrOfReplayedCalls + 1);
+    }
+
+    return success;
+}
+
+// the next calls require the language to be entirely loaded, same as during recording
+bool SessionReplayer::_waitForDataFetching()
+{
+    auto isFetchingDone = [this]()
+    {
+        return !m_pGameFacade->isDataFetchingInProgress() || m_pGameFacade->getStatusCode() == GameFacade::StatusCodes::DATA_FETCHING_ERROR;
+    };
+
+    if (!isFetchingDone())
+    {
+        QEventLoop eventLoop;
+        QTimer timeoutTimer;
+
+        auto checkIsFetchingDone = [&eventLoop, &isFetchingDone]()
+        {
+            if (isFetchingDone())
+            {
+                eventLoop.quit();
+            }
+        };
+
+        auto connected{connect(m_pGameFacade, &GameFacade::statusChanged, &eventLoop, checkIsFetchingDone)};
+        Q_ASSERT(connected);
+        connected = connect(m_pGameFacade, &GameFacade::fetchingInProgressChanged, &eventLoop, checkIsFetchingDone);
+        Q_ASSERT(connected);
+        connected = connect(&timeoutTimer, &QTimer::timeout, &eventLoop, &QEventLoop::quit);
+        Q_ASSERT(connected);
+
+        timeoutTimer.setSingleShot(true);
+        timeoutTimer.start(sc_DataFetchingTimeout);
+        eventLoop.exec();
+    }
+
+    const bool c_Success{isFetchingDone() && m_pGameFacade->getStatusCode() != GameFacade::StatusCodes::DATA_FETCHING_ERROR};
+
+    if (!c_Success)
+    {
+        m_ErrorMessage = isFetchingDone() ? "data fetching error while replaying" : "timeout while fetching data";
+    }
+
+    return c_Success;
+}
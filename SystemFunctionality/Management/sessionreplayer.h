@@ -0,0 +1,51 @@
+/*
+   This class replays a session recorded by the game facade (see SessionLog):
+   1) Seeds the random generators of the facade with the recorded seed so the same entries are mixed into the same pieces
+   2) Calls the facade in the recorded order with the recorded arguments, each language change being awaited before continuing
+   3) Checks the outcome of each submit against the recorded one so a divergent replay can be detected
+
+   The calls are replayed as fast as possible (the recorded timing is only reported), so the replay measures the backend on the recorded workload.
+   The facade should be fresh (no language set) and not be used by anyone else during the replay.
+*/
+
+#ifndef SESSIONREPLAYER_H
+#define SESSIONREPLAYER_H
+
+#include <QObject>
+#include <QString>
+
+#include "../Utilities/sessionlog.h"
+
+class GameFacade;
+
+class SessionReplayer : public QObject
+{
+    Q_OBJECT
+public:
+    explicit SessionReplayer(GameFacade* pGameFacade, QObject *parent = nullptr);
+
+    // returns false if the log cannot be read, is corrupted or a language cannot be loaded (see getErrorMessage())
+    bool replay(const QString& logFilePath);
+
+    int getNrOfReplayedCalls() const;
+    int getNrOfDivergentSubmits() const;
+    qint64 getRecordedDuration() const;
+    qint64 getReplayDuration() const;
+    QString getErrorMessage() const;
+
+private:
+    bool _replayEntry(const SessionLog::Entry& entry);
+    bool _waitForDataFetching();
+
+    static constexpr int sc_DataFetchingTimeout{60000}; // ms
+
+    GameFacade* m_pGameFacade;
+    SessionLog m_SessionLog;
+    int m_NrOfReplayedCalls;
+    int m_NrOfDivergentSubmits;
+    qint64 m_RecordedDuration;
+    qint64 m_ReplayDuration;
+    QString m_ErrorMessage;
+};
+
+#endif // SESSIONREPLAYER_H
@@ -3,6 +3,9 @@
 
 #include <QObject>
 #include <QString>
+#include <QVector>
+
+#include "../DataAccess/datasource.h"
 
 class IDataEntry
 {
@@ -27,6 +30,7 @@ signals:
     Q_SIGNAL virtual void wordsPairAlreadyContainedInCache() = 0;
     Q_SIGNAL virtual void cacheReset() = 0;
     Q_SIGNAL virtual void writeDataToDbFinished() = 0;
+    Q_SIGNAL virtual void dataSavingErrorOccured(QVector<DataSource::DataEntry> failedEntries) = 0;
 };
 
 Q_DECLARE_INTERFACE(IDataEntry, "IDataEntry");
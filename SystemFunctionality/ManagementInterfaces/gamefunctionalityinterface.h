@@ -14,7 +14,10 @@ public:
     virtual ~IGameFunctionality() = 0;
 
     virtual void fetchDataForPrimaryLanguage(int languageIndex, bool allowEmptyResult) = 0;
+    virtual bool switchToResidentPrimaryLanguage(int languageIndex) = 0;
     virtual void provideDataEntryToConsumer(int entryNumber) = 0;
+    virtual void prefetchWordsPair(int entryNumber, int languageIndex, Game::Levels level, quint32 mixSeed) = 0;
+    virtual void discardPrefetchedWordsPairs() = 0;
     virtual int getNrOfDataSourceEntries() const = 0;
 
     virtual DataSourceAccessHelper* getDataSourceAccessHelper() const = 0;
@@ -24,11 +27,14 @@ public:
     virtual StatisticsItem* getStatisticsItem() const = 0;
     virtual Chronometer* getChronometer() const = 0;
 
+    Q_SIGNAL virtual void fetchDataForPrimaryLanguageFirstChunkReady(int languageIndex, int nrOfEntries) = 0;
+    Q_SIGNAL virtual void fetchDataForPrimaryLanguageChunkReady(int languageIndex, int nrOfEntries) = 0;
     Q_SIGNAL virtual void fetchDataForPrimaryLanguageFinished(bool success, bool validEntriesFetched) = 0;
     Q_SIGNAL virtual void fetchDataForSecondaryLanguageFinished(bool success) = 0;
     Q_SIGNAL virtual void primaryLanguageDataSavingFinished(int nrOfPrimaryLanguageSavedEntries) = 0;
     Q_SIGNAL virtual void dataSavingErrorOccured() = 0;
     Q_SIGNAL virtual void entryProvidedToConsumer(QPair<QString, QString> newWordsPair, bool areSynonyms) = 0;
+    Q_SIGNAL virtual void wordsPairPrefetched(bool success, WordMixer::MixedWordsPair mixedWordsPair) = 0;
 };
 
 Q_DECLARE_INTERFACE(IGameFunctionality, "IGameFunctionality");
@@ -3,10 +3,14 @@
 
 #include <QString>
 
+#include "../Utilities/metricsregistry.h"
+
 class IGameInit
 {
 public:
+    virtual void enableWriteAheadLogging() = 0;
     virtual void setEnvironment(const QString& dataDirPath) = 0;
+    virtual MetricsRegistry::Snapshot getMetricsSnapshot() const = 0;
     virtual ~IGameInit() = 0;
 };
 
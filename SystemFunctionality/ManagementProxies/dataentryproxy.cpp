@@ -10,6 +10,8 @@ DataEntryProxy::DataEntryProxy(QObject *parent) : QObject(parent)
     Q_ASSERT(connected);
     connected = connect(pGameManager, &GameManager::writeDataToDbFinished, this, &DataEntryProxy::writeDataToDbFinished, Qt::DirectConnection);
     Q_ASSERT(connected);
+    connected = connect(pGameManager, &GameManager::dataSavingErrorOccured, this, &DataEntryProxy::dataSavingErrorOccured, Qt::DirectConnection);
+    Q_ASSERT(connected);
     connected = connect(pGameManager, &GameManager::cacheReset, this, &DataEntryProxy::cacheReset, Qt::DirectConnection);
     Q_ASSERT(connected);
     connected = connect(pGameManager, &GameManager::addInvalidWordsPairRequested, this, &DataEntryProxy::addInvalidWordsPairRequested, Qt::DirectConnection);
@@ -32,6 +32,7 @@ signals:
     Q_SIGNAL void wordsPairAlreadyContainedInCache();
     Q_SIGNAL void cacheReset();
     Q_SIGNAL void writeDataToDbFinished();
+    Q_SIGNAL void dataSavingErrorOccured(QVector<DataSource::DataEntry> failedEntries);
 };
 
 #endif // DATAENTRYPROXY_H
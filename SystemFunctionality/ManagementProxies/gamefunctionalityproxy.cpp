@@ -11,8 +11,14 @@ GameFunctionalityProxy::GameFunctionalityProxy(QObject *parent)
     Q_ASSERT(connected);
     connected = connect(pGameManager, &GameManager::entryProvidedToConsumer, this, &GameFunctionalityProxy::entryProvidedToConsumer, Qt::DirectConnection);
     Q_ASSERT(connected);
+    connected = connect(pGameManager, &GameManager::wordsPairPrefetched, this, &GameFunctionalityProxy::wordsPairPrefetched, Qt::DirectConnection);
+    Q_ASSERT(connected);
     connected = connect(pGameManager, &GameManager::dataSavingErrorOccured, this, &GameFunctionalityProxy::dataSavingErrorOccured, Qt::DirectConnection);
     Q_ASSERT(connected);
+    connected = connect(pGameManager, &GameManager::fetchDataForPrimaryLanguageFirstChunkReady, this, &GameFunctionalityProxy::fetchDataForPrimaryLanguageFirstChunkReady, Qt::DirectConnection);
+    Q_ASSERT(connected);
+    connected = connect(pGameManager, &GameManager::fetchDataForPrimaryLanguageChunkReady, this, &GameFunctionalityProxy::fetchDataForPrimaryLanguageChunkReady, Qt::DirectConnection);
+    Q_ASSERT(connected);
     connected = connect(pGameManager, &GameManager::fetchDataForPrimaryLanguageFinished, this, &GameFunctionalityProxy::fetchDataForPrimaryLanguageFinished, Qt::DirectConnection);
     Q_ASSERT(connected);
     connected = connect(pGameManager, &GameManager::fetchDataForSecondaryLanguageFinished, this, &GameFunctionalityProxy::fetchDataForSecondaryLanguageFinished, Qt::DirectConnection);
@@ -24,11 +30,26 @@ void GameFunctionalityProxy::fetchDataForPrimaryLanguage(int languageIndex, bool
     GameManager::getManager()->fetchDataForPrimaryLanguage(languageIndex, allowEmptyResult);
 }
 
+bool GameFunctionalityProxy::switchToResidentPrimaryLanguage(int languageIndex)
+{
+    return GameManager::getManager()->switchToResidentPrimaryLanguage(languageIndex);
+}
+
 void GameFunctionalityProxy::provideDataEntryToConsumer(int entryNumber)
 {
     GameManager::getManager()->provideDataEntryToConsumer(entryNumber);
 }
 
+void GameFunctionalityProxy::prefetchWordsPair(int entryNumber, int languageIndex, Game::Levels level, quint32 mixSeed)
+{
+    GameManager::getManager()->prefetchWordsPair(entryNumber, languageIndex, level, mixSeed);
+}
+
+void GameFunctionalityProxy::discardPrefetchedWordsPairs()
+{
+    GameManager::getManager()->discardPrefetchedWordsPairs();
+}
+
 int GameFunctionalityProxy::getNrOfDataSourceEntries() const
 {
     return GameManager::getManager()->getNrOfDataSourceEntries();
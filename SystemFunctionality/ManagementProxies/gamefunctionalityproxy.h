@@ -24,7 +24,10 @@ public:
     explicit GameFunctionalityProxy(QObject *parent = nullptr);
 
     void fetchDataForPrimaryLanguage(int languageIndex, bool allowEmptyResult);
+    bool switchToResidentPrimaryLanguage(int languageIndex);
     void provideDataEntryToConsumer(int entryNumber);
+    void prefetchWordsPair(int entryNumber, int languageIndex, Game::Levels level, quint32 mixSeed);
+    void discardPrefetchedWordsPairs();
     int getNrOfDataSourceEntries() const;
 
     DataSourceAccessHelper* getDataSourceAccessHelper() const;
@@ -35,11 +38,14 @@ public:
     Chronometer* getChronometer() const;
 
 signals:
+    Q_SIGNAL void fetchDataForPrimaryLanguageFirstChunkReady(int languageIndex, int nrOfEntries);
+    Q_SIGNAL void fetchDataForPrimaryLanguageChunkReady(int languageIndex, int nrOfEntries);
     Q_SIGNAL void fetchDataForPrimaryLanguageFinished(bool success, bool validEntriesFetched);
     Q_SIGNAL void fetchDataForSecondaryLanguageFinished(bool success);
     Q_SIGNAL void primaryLanguageDataSavingFinished(int nrOfPrimaryLanguageSavedEntries);
     Q_SIGNAL void dataSavingErrorOccured();
     Q_SIGNAL void entryProvidedToConsumer(QPair<QString, QString> newWordsPair, bool areSynonyms);
+    Q_SIGNAL void wordsPairPrefetched(bool success, WordMixer::MixedWordsPair mixedWordsPair);
 };
 
 #endif // GAMEFUNCTIONALITYPROXY_H
@@ -6,11 +6,21 @@ GameInitProxy::GameInitProxy(QObject *parent)
 {
 }
 
+void GameInitProxy::enableWriteAheadLogging()
+{
+    GameManager::getManager()->enableWriteAheadLogging();
+}
+
 void GameInitProxy::setEnvironment(const QString &dataDirPath)
 {
     GameManager::getManager()->setEnvironment(dataDirPath);
 }
 
+MetricsRegistry::Snapshot GameInitProxy::getMetricsSnapshot() const
+{
+    return GameManager::getManager()->getMetricsSnapshot();
+}
+
 GameInitProxy::~GameInitProxy()
 {
 
@@ -13,7 +13,9 @@ class GameInitProxy : public QObject, public IGameInit
 {
 public:
     explicit GameInitProxy(QObject *parent = nullptr);
+    void enableWriteAheadLogging();
     void setEnvironment(const QString& dataDirPath);
+    MetricsRegistry::Snapshot getMetricsSnapshot() const;
     ~GameInitProxy();
 };
 
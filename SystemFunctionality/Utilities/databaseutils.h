@@ -26,7 +26,32 @@ namespace Database
             "firstWord TEXT, secondWord TEXT, areSynonyms INTEGER, language TEXT)"
         };
 
-        const QString c_RetrieveEntriesFromLanguageQuery    {    "SELECT * FROM GameDataTable WHERE language = '%1'"                                        };
+        const QString c_CreateLanguageIndexQuery            {    "CREATE INDEX IF NOT EXISTS LanguageIndex ON GameDataTable(language)"                      };
+
+        // the words are stored in the index in alphabetical order so a pair cannot be added twice by swapping its words
+        const QString c_CreateUniquePairIndexQuery          {
+            "CREATE UNIQUE INDEX IF NOT EXISTS UniquePairIndex ON GameDataTable"
+            "(language, min(firstWord, secondWord), max(firstWord, secondWord))"
+        };
+
+        /* arguments: language code, min pair size, max pair size
+           (entries with a wrong pair size or with ASCII uppercase letters are discarded by the database, the remaining ones still need to be validated by the loader;
+            too short words and identical words are left to the loader as their rejection reason depends on the character check, which cannot be reliably done by the database) */
+        const QString c_RetrieveEntriesFromLanguageQuery    {
+            "SELECT firstWord, secondWord, areSynonyms FROM GameDataTable WHERE language = '%1' "
+            "AND length(firstWord) + length(secondWord) BETWEEN %2 AND %3 "
+            "AND firstWord = lower(firstWord) AND secondWord = lower(secondWord)"
+        };
+
+        // arguments: same as above; counts the entries discarded by the retrieve query per rejection reason (pair too short, pair too long, invalid characters), checked in the loader validation order
+        const QString c_CountDiscardedEntriesFromLanguageQuery {
+            "SELECT sum(CASE WHEN length(firstWord) + length(secondWord) < %2 THEN 1 ELSE 0 END), "
+            "sum(CASE WHEN length(firstWord) + length(secondWord) > %3 THEN 1 ELSE 0 END), "
+            "sum(CASE WHEN length(firstWord) + length(secondWord) BETWEEN %2 AND %3 AND (firstWord <> lower(firstWord) OR secondWord <> lower(secondWord)) THEN 1 ELSE 0 END) "
+            "FROM GameDataTable WHERE language = '%1'"
+        };
+
+        const QString c_RetrieveLanguageStampQuery          {    "SELECT count(*), max(rowId) FROM GameDataTable WHERE language = '%1'"                     };
         const QString c_InsertEntryIntoDbQuery              {
             "INSERT INTO GameDataTable(firstWord, secondWord, areSynonyms, language) "
             "VALUES(:firstWord, :secondWord, :areSynonyms, 'ANY')"
@@ -36,6 +61,10 @@ namespace Database
             "VALUES(:firstWord, :secondWord, :areSynonyms, :language)"
         };
 
+        const QString c_SetJournalModePragma                {    "PRAGMA journal_mode = %1"                                                                 };
+        const QString c_SetMmapSizePragma                   {    "PRAGMA mmap_size = %1"                                                                    };
+        const QString c_SetCacheSizePragma                  {    "PRAGMA cache_size = %1"                                                                   };
+
         const QVector<QString> c_LanguageCodes              {
             "EN",  // English
             "DE",  // German
@@ -47,12 +76,30 @@ namespace Database
             "TR",  // Turkish
         };
     }
+    namespace Connection
+    {
+        const QString c_LoaderConnectionName                {    "DataSourceLoaderConnection"                                                               };
+        const QString c_CacheConnectionName                 {    "DataEntryCacheConnection"                                                                 };
+        // empty journal mode: the one of the database is kept (write-ahead logging is opt-in as it changes the files the database consists of)
+        const QString c_DefaultJournalMode                  {    ""                                                                                         };
+        const QString c_WalJournalMode                      {    "WAL"                                                                                      };
+
+        static constexpr qint64 c_DefaultMmapSize{64 * 1024 * 1024};
+        static constexpr int c_DefaultCacheSize{-16000};
+    }
+    namespace Snapshot
+    {
+        const QString c_FileNameTemplate                    {    "data_%1.snapshot"                                                                         };
+        // appended to the database path by SQLite for the write-ahead log, which is part of the snapshot stamp
+        const QString c_WalFileSuffix                       {    "-wal"                                                                                     };
+    }
     namespace Error
     {
         const QString c_DatabaseDriverNotAvailable          {    "The SQLite driver is not available!"                                                      };
         const QString c_CannotOpenDatabase                  {    "The database cannot be opened!"                                                           };
         const QString c_CannotCreateTable                   {    "Cannot create database table!"                                                            };
         const QString c_TableIsInvalid                      {    "The database table is invalid!"                                                           };
+        const QString c_CannotCreateIndex                   {    "Cannot create database index!"                                                            };
     }
 }
 
@@ -7,6 +7,7 @@
 
 #include <QMap>
 #include <QVector>
+#include <QMetaType>
 
 
 /* only add the enum classes here that are shared by multiple classes */
@@ -50,6 +51,14 @@ namespace Game
         {Game::Levels::LEVEL_HARD,   12}
     };
 
+    // seconds available for guessing a words pair when the time limit is enabled
+    const QMap<Game::Levels, int> c_TimeLimits
+    {
+        {Game::Levels::LEVEL_EASY,   30},
+        {Game::Levels::LEVEL_MEDIUM, 120},
+        {Game::Levels::LEVEL_HARD,   300}
+    };
+
     namespace Constraints
     {
         static constexpr int c_MinWordSize{5};
@@ -58,4 +67,7 @@ namespace Game
     }
 }
 
+// required for passing the level to objects running in other threads (queued connections)
+Q_DECLARE_METATYPE(Game::Levels)
+
 #endif // GAMEUTILS_H
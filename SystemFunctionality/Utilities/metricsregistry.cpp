@@ -0,0 +1,373 @@
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QTextStream>
+
+#include <cmath>
+
+#include "metricsregistry.h"
+
+namespace
+{
+    const QVector<double> c_ExportedQuantiles{0.5, 0.9, 0.99, 0.999, 1.0};
+
+    constexpr double c_NanosecondsPerSecond{1000000000.0};
+
+    QString formatValue(double value)
+    {
+        return QString::number(value, 'g', 15);
+    }
+
+    // the sample labels followed by the additional label (if any)
+    QString formatLabels(const QString& labels, const QString& additionalLabel = QString{})
+    {
+        QString formattedLabels;
+
+        if (!labels.isEmpty() || !additionalLabel.isEmpty())
+        {
+            formattedLabels = "{" + labels + (!labels.isEmpty() && !additionalLabel.isEmpty() ? "," : "") + additionalLabel + "}";
+        }
+
+        return formattedLabels;
+    }
+
+    void writeFamilyHeader(QTextStream& output, const QString& name, const QString& help, const QString& type)
+    {
+        output << "# HELP " << name << " " << help << "\n";
+        output << "# TYPE " << name << " " << type << "\n";
+    }
+
+    // the samples of the same family (name) are written together, in registration order, preceded by a single header
+    void writeSamples(QTextStream& output, const QVector<MetricsRegistry::Sample>& samples, const QString& type)
+    {
+        QVector<bool> areSamplesWritten(samples.size(), false);
+
+        for (int sampleIndex{0}; sampleIndex < samples.size(); ++sampleIndex)
+        {
+            if (!areSamplesWritten.at(sampleIndex))
+            {
+                const QString& c_Name{samples.at(sampleIndex).name};
+                writeFamilyHeader(output, c_Name, samples.at(sampleIndex).help, type);
+
+                for (int familySampleIndex{sampleIndex}; familySampleIndex < samples.size(); ++familySampleIndex)
+                {
+                    const MetricsRegistry::Sample& c_Sample{samples.at(familySampleIndex)};
+
+                    if (c_Sample.name == c_Name)
+                    {
+                        output << c_Name << formatLabels(c_Sample.labels) << " " << formatValue(c_Sample.value) << "\n";
+                        areSamplesWritten[familySampleIndex] = true;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void MetricsRegistry::Counter::increment(quint64 value)
+{
+    m_Value.fetch_add(value, std::memory_order_relaxed);
+}
+
+quint64 MetricsRegistry::Counter::getValue() const
+{
+    return m_Value.load(std::memory_order_relaxed);
+}
+
+MetricsRegistry::Counter::Counter(const QString& name, const QString& help, const QString& labels)
+    : m_Name{name}
+    , m_Help{help}
+    , m_Labels{labels}
+    , m_Value{0}
+{
+}
+
+void MetricsRegistry::Gauge::set(qint64 value)
+{
+    m_Value.store(value, std::memory_order_relaxed);
+}
+
+qint64 MetricsRegistry::Gauge::getValue() const
+{
+    return m_Value.load(std::memory_order_relaxed);
+}
+
+MetricsRegistry::Gauge::Gauge(const QString& name, const QString& help, const QString& labels)
+    : m_Name{name}
+    , m_Help{help}
+    , m_Labels{labels}
+    , m_Value{0}
+{
+}
+
+void MetricsRegistry::Histogram::record(qint64 value)
+{
+    const quint64 c_Value{value < 0 ? 0 : static_cast<quint64>(value) > sc_MaxValue ? sc_MaxValue : static_cast<quint64>(value)};
+
+    m_BucketCounts[getBucketIndex(c_Value)].fetch_add(1, std::memory_order_relaxed);
+    m_Count.fetch_add(1, std::memory_order_relaxed);
+    m_Sum.fetch_add(c_Value, std::memory_order_relaxed);
+
+    quint64 maxValue{m_MaxValue.load(std::memory_order_relaxed)};
+
+    while (c_Value > maxValue && !m_MaxValue.compare_exchange_weak(maxValue, c_Value, std::memory_order_relaxed))
+    {
+    }
+}
+
+quint64 MetricsRegistry::Histogram::getCount() const
+{
+    return m_Count.load(std::memory_order_relaxed);
+}
+
+qint64 MetricsRegistry::Histogram::getValueAtQuantile(double quantile) const
+{
+    Q_ASSERT(quantile >= 0.0 && quantile <= 1.0);
+
+    // the total is calculated from the buckets (not taken from m_Count) so it is consistent with the bucket counts read here
+    QVector<quint64> bucketCounts(sc_NrOfBuckets);
+    quint64 totalCount{0};
+
+    for (int bucketIndex{0}; bucketIndex < sc_NrOfBuckets; ++bucketIndex)
+    {
+        bucketCounts[bucketIndex] = m_BucketCounts[bucketIndex].load(std::memory_order_relaxed);
+        totalCount += bucketCounts.at(bucketIndex);
+    }
+
+    qint64 valueAtQuantile{0};
+
+    if (totalCount > 0)
+    {
+        const quint64 c_RequiredCount{qMax(quint64{1}, static_cast<quint64>(std::ceil(quantile * static_cast<double>(totalCount))))};
+        quint64 cumulatedCount{0};
+        int bucketIndex{0};
+
+        for (; bucketIndex < sc_NrOfBuckets - 1; ++bucketIndex)
+        {
+            cumulatedCount += bucketCounts.at(bucketIndex);
+
+            if (cumulatedCount >= c_RequiredCount)
+            {
+                break;
+            }
+        }
+
+        // the recorded maximum is exact, the bucket limit is not
+        valueAtQuantile = static_cast<qint64>(qMin(getBucketUpperLimit(bucketIndex), m_MaxValue.load(std::memory_order_relaxed)));
+    }
+
+    return valueAtQuantile;
+}
+
+qint64 MetricsRegistry::Histogram::getMaxValue() const
+{
+    return static_cast<qint64>(m_MaxValue.load(std::memory_order_relaxed));
+}
+
+int MetricsRegistry::Histogram::getBucketIndex(quint64 value)
+{
+    Q_ASSERT(value <= sc_MaxValue);
+
+    int bucketIndex{static_cast<int>(value)};
+
+    if (value >= static_cast<quint64>(sc_SubBucketCount))
+    {
+        int mostSignificantBit{sc_SubBucketBits};
+
+        while ((value >> (mostSignificantBit + 1)) != 0)
+        {
+            ++mostSignificantBit;
+        }
+
+        // the value is shifted so it keeps sc_SubBucketBits significant bits, the highest one being always set
+        const int c_Shift{mostSignificantBit - sc_SubBucketBits + 1};
+        const int c_SubBucketIndex{static_cast<int>(value >> c_Shift) - sc_SubBucketCount / 2};
+
+        bucketIndex = sc_SubBucketCount + (c_Shift - 1) * sc_SubBucketCount / 2 + c_SubBucketIndex;
+    }
+
+    return bucketIndex;
+}
+
+quint64 MetricsRegistry::Histogram::getBucketUpperLimit(int bucketIndex)
+{
+    Q_ASSERT(bucketIndex >= 0 && bucketIndex < sc_NrOfBuckets);
+
+    quint64 upperLimit{static_cast<quint64>(bucketIndex)};
+
+    if (bucketIndex >= sc_SubBucketCount)
+    {
+        const int c_Shift{(bucketIndex - sc_SubBucketCount) / (sc_SubBucketCount / 2) + 1};
+        const quint64 c_SubBucket{static_cast<quint64>((bucketIndex - sc_SubBucketCount) % (sc_SubBucketCount / 2) + sc_SubBucketCount / 2)};
+
+        upperLimit = ((c_SubBucket + 1) << c_Shift) - 1;
+    }
+
+    return upperLimit;
+}
+
+MetricsRegistry::Histogram::Histogram(const QString& name, const QString& help, const QString& labels)
+    : m_Name{name}
+    , m_Help{help}
+    , m_Labels{labels}
+    , m_Count{0}
+    , m_Sum{0}
+    , m_MaxValue{0}
+{
+    for (auto& bucketCount : m_BucketCounts)
+    {
+        bucketCount.store(0, std::memory_order_relaxed);
+    }
+}
+
+QString MetricsRegistry::Snapshot::toPrometheusText() const
+{
+    QString prometheusText;
+    QTextStream output{&prometheusText};
+
+    writeSamples(output, counters, "counter");
+    writeSamples(output, gauges, "gauge");
+
+    for (const auto& histogram : histograms)
+    {
+        writeFamilyHeader(output, histogram.name, histogram.help, "summary");
+
+        for (const auto& quantileValue : histogram.quantileValues)
+        {
+            output << histogram.name << formatLabels(histogram.labels, "quantile=\"" + formatValue(quantileValue.first) + "\"") << " " << formatValue(quantileValue.second) << "\n";
+        }
+
+        output << histogram.name << "_sum" << formatLabels(histogram.labels) << " " << formatValue(histogram.sum) << "\n";
+        output << histogram.name << "_count" << formatLabels(histogram.labels) << " " << histogram.count << "\n";
+    }
+
+    output.flush();
+
+    return prometheusText;
+}
+
+bool MetricsRegistry::Snapshot::writePrometheusText(const QString& filePath) const
+{
+    QSaveFile metricsFile{filePath};
+
+    return metricsFile.open(QIODevice::WriteOnly | QIODevice::Text) && metricsFile.write(toPrometheusText().toUtf8()) != -1 && metricsFile.commit();
+}
+
+MetricsRegistry* MetricsRegistry::getRegistry()
+{
+    // never destroyed: the metrics might still be updated by other threads while the static objects get destroyed at exit
+    static MetricsRegistry* const s_pRegistry{new MetricsRegistry{}};
+
+    return s_pRegistry;
+}
+
+MetricsRegistry::Counter* MetricsRegistry::getCounter(const QString& name, const QString& help, const QString& labels)
+{
+    QMutexLocker mutexLocker{&m_RegistrationMutex};
+
+    Counter* pCounter{nullptr};
+
+    for (const auto& pRegisteredCounter : m_Counters)
+    {
+        if (pRegisteredCounter->m_Name == name && pRegisteredCounter->m_Labels == labels)
+        {
+            pCounter = pRegisteredCounter.get();
+            break;
+        }
+    }
+
+    if (!pCounter)
+    {
+        m_Counters.emplace_back(new Counter{name, help, labels});
+        pCounter = m_Counters.back().get();
+    }
+
+    return pCounter;
+}
+
+MetricsRegistry::Gauge* MetricsRegistry::getGauge(const QString& name, const QString& help, const QString& labels)
+{
+    QMutexLocker mutexLocker{&m_RegistrationMutex};
+
+    Gauge* pGauge{nullptr};
+
+    for (const auto& pRegisteredGauge : m_Gauges)
+    {
+        if (pRegisteredGauge->m_Name == name && pRegisteredGauge->m_Labels == labels)
+        {
+            pGauge = pRegisteredGauge.get();
+            break;
+        }
+    }
+
+    if (!pGauge)
+    {
+        m_Gauges.emplace_back(new Gauge{name, help, labels});
+        pGauge = m_Gauges.back().get();
+    }
+
+    return pGauge;
+}
+
+MetricsRegistry::Histogram* MetricsRegistry::getHistogram(const QString& name, const QString& help, const QString& labels)
+{
+    QMutexLocker mutexLocker{&m_RegistrationMutex};
+
+    Histogram* pHistogram{nullptr};
+
+    for (const auto& pRegisteredHistogram : m_Histograms)
+    {
+        if (pRegisteredHistogram->m_Name == name && pRegisteredHistogram->m_Labels == labels)
+        {
+            pHistogram = pRegisteredHistogram.get();
+            break;
+        }
+    }
+
+    if (!pHistogram)
+    {
+        m_Histograms.emplace_back(new Histogram{name, help, labels});
+        pHistogram = m_Histograms.back().get();
+    }
+
+    return pHistogram;
+}
+
+MetricsRegistry::Snapshot MetricsRegistry::getSnapshot() const
+{
+    QMutexLocker mutexLocker{&m_RegistrationMutex};
+
+    Snapshot snapshot;
+
+    for (const auto& pCounter : m_Counters)
+    {
+        snapshot.counters.append(Sample{pCounter->m_Name, pCounter->m_Help, pCounter->m_Labels, static_cast<double>(pCounter->getValue())});
+    }
+
+    for (const auto& pGauge : m_Gauges)
+    {
+        snapshot.gauges.append(Sample{pGauge->m_Name, pGauge->m_Help, pGauge->m_Labels, static_cast<double>(pGauge->getValue())});
+    }
+
+    for (const auto& pHistogram : m_Histograms)
+    {
+        HistogramSample histogramSample{pHistogram->m_Name, pHistogram->m_Help, pHistogram->m_Labels, pHistogram->getCount(),
+                                        static_cast<double>(pHistogram->m_Sum.load(std::memory_order_relaxed)) / c_NanosecondsPerSecond, QVector<QPair<double, double>>{}};
+
+        for (const double c_Quantile : c_ExportedQuantiles)
+        {
+            histogramSample.quantileValues.append(qMakePair(c_Quantile, static_cast<double>(pHistogram->getValueAtQuantile(c_Quantile)) / c_NanosecondsPerSecond));
+        }
+
+        snapshot.histograms.append(histogramSample);
+    }
+
+    return snapshot;
+}
+
+MetricsRegistry::MetricsRegistry()
+{
+}
+
+MetricsRegistry::~MetricsRegistry()
+{
+}
@@ -0,0 +1,156 @@
+/*
+   This class keeps the runtime metrics of the backend so its behavior can be watched in production:
+   1) Counters (only increase) and gauges (current value), both updated from any thread without locking
+   2) Latency histograms with logarithmic buckets (HDR style): fixed memory, bounded relative error (about 3%) over the whole range, lock-free recording
+   3) Provides snapshots of all registered metrics which can be written in Prometheus text format (e.g. for the node exporter textfile collector)
+
+   The metrics are registered once (by name and labels) and the instrumented objects keep the returned pointers, so updating a metric requires no lookup.
+   The registered metrics are never released (the pointers remain valid for the entire lifetime of the process).
+*/
+
+#ifndef METRICSREGISTRY_H
+#define METRICSREGISTRY_H
+
+#include <QString>
+#include <QVector>
+#include <QPair>
+#include <QMutex>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+class MetricsRegistry
+{
+public:
+    class Counter
+    {
+    public:
+        void increment(quint64 value = 1);
+        quint64 getValue() const;
+
+    private:
+        friend class MetricsRegistry;
+
+        Counter(const QString& name, const QString& help, const QString& labels);
+        Counter(const Counter&) = delete;
+        Counter& operator=(const Counter&) = delete;
+
+        const QString m_Name;
+        const QString m_Help;
+        const QString m_Labels;
+        std::atomic<quint64> m_Value;
+    };
+
+    class Gauge
+    {
+    public:
+        void set(qint64 value);
+        qint64 getValue() const;
+
+    private:
+        friend class MetricsRegistry;
+
+        Gauge(const QString& name, const QString& help, const QString& labels);
+        Gauge(const Gauge&) = delete;
+        Gauge& operator=(const Gauge&) = delete;
+
+        const QString m_Name;
+        const QString m_Help;
+        const QString m_Labels;
+        std::atomic<qint64> m_Value;
+    };
+
+    // values in nanoseconds (see QElapsedTimer::nsecsElapsed()), the ones exceeding the maximum trackable value are recorded as maximum
+    class Histogram
+    {
+    public:
+        void record(qint64 value);
+
+        quint64 getCount() const;
+        qint64 getValueAtQuantile(double quantile) const; // upper limit of the bucket containing the quantile
+        qint64 getMaxValue() const;
+
+        static int getBucketIndex(quint64 value);
+        static quint64 getBucketUpperLimit(int bucketIndex);
+
+        // the first sc_SubBucketCount values get their own buckets, then each power of two range is split into sc_SubBucketCount / 2 buckets
+        static constexpr int sc_SubBucketBits{6};
+        static constexpr int sc_SubBucketCount{1 << sc_SubBucketBits};
+        static constexpr int sc_MaxValueBits{40}; // about 18 minutes
+        static constexpr quint64 sc_MaxValue{(quint64{1} << sc_MaxValueBits) - 1};
+        static constexpr int sc_NrOfBuckets{sc_SubBucketCount + (sc_MaxValueBits - sc_SubBucketBits) * sc_SubBucketCount / 2};
+
+    private:
+        friend class MetricsRegistry;
+
+        Histogram(const QString& name, const QString& help, const QString& labels);
+        Histogram(const Histogram&) = delete;
+        Histogram& operator=(const Histogram&) = delete;
+
+        const QString m_Name;
+        const QString m_Help;
+        const QString m_Labels;
+        std::atomic<quint64> m_BucketCounts[sc_NrOfBuckets];
+        std::atomic<quint64> m_Count;
+        std::atomic<quint64> m_Sum;
+        std::atomic<quint64> m_MaxValue;
+    };
+
+    // counters and gauges
+    struct Sample
+    {
+        QString name;
+        QString help;
+        QString labels;
+        double value;
+    };
+
+    // the histograms are exported as Prometheus summaries (values converted to seconds)
+    struct HistogramSample
+    {
+        QString name;
+        QString help;
+        QString labels;
+        quint64 count;
+        double sum;
+        QVector<QPair<double, double>> quantileValues; // quantile, value
+    };
+
+    struct Snapshot
+    {
+        QString toPrometheusText() const;
+
+        // the file is replaced atomically so readers never get a partially written snapshot
+        bool writePrometheusText(const QString& filePath) const;
+
+        QVector<Sample> counters;
+        QVector<Sample> gauges;
+        QVector<HistogramSample> histograms;
+    };
+
+    static MetricsRegistry* getRegistry();
+
+    /* The same metric is returned if already registered with the same name and labels (the help is only taken into account at first registration).
+       Labels format (Prometheus): name="value" pairs separated by comma, e.g. reason="invalid_characters" */
+    Counter* getCounter(const QString& name, const QString& help, const QString& labels = QString{});
+    Gauge* getGauge(const QString& name, const QString& help, const QString& labels = QString{});
+    Histogram* getHistogram(const QString& name, const QString& help, const QString& labels = QString{});
+
+    // the metrics can be updated meanwhile, each value is read atomically but the snapshot as a whole is not
+    Snapshot getSnapshot() const;
+
+private:
+    MetricsRegistry();
+    ~MetricsRegistry();
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    // only locked when registering and when taking snapshots
+    mutable QMutex m_RegistrationMutex;
+    std::vector<std::unique_ptr<Counter>> m_Counters;
+    std::vector<std::unique_ptr<Gauge>> m_Gauges;
+    std::vector<std::unique_ptr<Histogram>> m_Histograms;
+};
+
+#endif // METRICSREGISTRY_H
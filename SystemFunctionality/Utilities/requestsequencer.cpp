@@ -0,0 +1,44 @@
+#include <QtGlobal>
+
+#include "requestsequencer.h"
+
+RequestSequencer::RequestSequencer()
+    : m_LastIssuedRequestId{0}
+    , m_LastAcknowledgedRequestId{0}
+{
+}
+
+int RequestSequencer::issueRequest()
+{
+    return ++m_LastIssuedRequestId;
+}
+
+bool RequestSequencer::acknowledgeRequest(int requestId)
+{
+    // a worker handles its requests in the order they have been issued so the acknowledgements should never come in a different order
+    Q_ASSERT(requestId > m_LastAcknowledgedRequestId && requestId <= m_LastIssuedRequestId);
+
+    m_LastAcknowledgedRequestId = requestId;
+
+    return isLatestRequest(requestId);
+}
+
+bool RequestSequencer::isLatestRequest(int requestId) const
+{
+    return requestId == m_LastIssuedRequestId;
+}
+
+bool RequestSequencer::isRequestPending() const
+{
+    return m_LastAcknowledgedRequestId != m_LastIssuedRequestId;
+}
+
+int RequestSequencer::getLastIssuedRequestId() const
+{
+    return m_LastIssuedRequestId;
+}
+
+int RequestSequencer::getLastAcknowledgedRequestId() const
+{
+    return m_LastAcknowledgedRequestId;
+}
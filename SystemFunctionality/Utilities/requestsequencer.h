@@ -0,0 +1,29 @@
+/*
+   This class fulfills following tasks:
+   1) Issues increasing sequence numbers for the requests sent by GameManager to the worker objects (loader, cache)
+   2) Checks the acknowledgements received from workers: they should arrive in the order the requests were issued
+   3) Tells whether an acknowledgement belongs to the most recently issued request (the ones of older requests are obsolete)
+*/
+
+#ifndef REQUESTSEQUENCER_H
+#define REQUESTSEQUENCER_H
+
+class RequestSequencer
+{
+public:
+    RequestSequencer();
+
+    int issueRequest();
+    bool acknowledgeRequest(int requestId);
+
+    bool isLatestRequest(int requestId) const;
+    bool isRequestPending() const;
+    int getLastIssuedRequestId() const;
+    int getLastAcknowledgedRequestId() const;
+
+private:
+    int m_LastIssuedRequestId;
+    int m_LastAcknowledgedRequestId;
+};
+
+#endif // REQUESTSEQUENCER_H
@@ -0,0 +1,86 @@
+/*
+   This class template implements a fixed capacity FIFO buffer:
+   1) The storage is allocated once (at construction) and reused, the elements being overwritten when pushed again
+   2) Taking the oldest element out of the buffer only moves it and advances the read position (no other elements are shifted)
+*/
+
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <QVector>
+
+#include <utility>
+
+template<typename T>
+class RingBuffer
+{
+public:
+    explicit RingBuffer(int capacity)
+        : m_Elements(capacity)
+        , m_FirstElementIndex{0}
+        , m_NrOfElements{0}
+    {
+        Q_ASSERT(capacity > 0);
+    }
+
+    // returns false (element not added) if buffer is full
+    bool push(const T& element)
+    {
+        bool canPush{m_NrOfElements < m_Elements.size()};
+
+        if (canPush)
+        {
+            m_Elements[(m_FirstElementIndex + m_NrOfElements) % m_Elements.size()] = element;
+            ++m_NrOfElements;
+        }
+
+        return canPush;
+    }
+
+    // should only be called if buffer is not empty
+    T takeFirst()
+    {
+        Q_ASSERT(m_NrOfElements > 0);
+
+        T firstElement{std::move(m_Elements[m_FirstElementIndex])};
+        m_Elements[m_FirstElementIndex] = T{};
+        m_FirstElementIndex = (m_FirstElementIndex + 1) % m_Elements.size();
+        --m_NrOfElements;
+
+        return firstElement;
+    }
+
+    void clear()
+    {
+        m_Elements.fill(T{});
+        m_FirstElementIndex = 0;
+        m_NrOfElements = 0;
+    }
+
+    bool isEmpty() const
+    {
+        return m_NrOfElements == 0;
+    }
+
+    bool isFull() const
+    {
+        return m_NrOfElements == m_Elements.size();
+    }
+
+    int size() const
+    {
+        return m_NrOfElements;
+    }
+
+    int capacity() const
+    {
+        return m_Elements.size();
+    }
+
+private:
+    QVector<T> m_Elements;
+    int m_FirstElementIndex;
+    int m_NrOfElements;
+};
+
+#endif // RINGBUFFER_H
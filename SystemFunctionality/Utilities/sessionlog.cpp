@@ -0,0 +1,236 @@
+#include <limits>
+
+#include "sessionlog.h"
+
+namespace
+{
+    const QByteArray c_Magic{"SYNL"};
+
+    // header: magic followed by format version
+    const int c_HeaderSize{static_cast<int>(c_Magic.size()) + 1};
+
+    // a 32 bit number takes at most 5 bytes when written as variable length integer
+    static constexpr int c_MaxEncodedNumberSize{5};
+
+    // event code, elapsed time and maximum two arguments
+    static constexpr int c_MaxEncodedEntrySize{1 + 3 * c_MaxEncodedNumberSize};
+
+    // least significant 7 bits first, the highest bit of each byte is set if more bytes follow; returns the number of written bytes
+    int encodeNumber(quint32 number, char* pDestination)
+    {
+        int encodedNumberSize{0};
+
+        do
+        {
+            pDestination[encodedNumberSize] = static_cast<char>((number & 0x7F) | (number > 0x7F ? 0x80 : 0x00));
+            number >>= 7;
+            ++encodedNumberSize;
+        }
+        while (number != 0);
+
+        return encodedNumberSize;
+    }
+}
+
+SessionLog::Entry::Entry()
+    : event{SessionLog::Events::EventsCount}
+    , elapsedTime{0}
+    , firstArgument{0}
+    , secondArgument{0}
+{
+}
+
+SessionLog::SessionLog()
+    : m_LastEntryTime{0}
+    , m_ReadPosition{0}
+{
+}
+
+SessionLog::~SessionLog()
+{
+    close();
+}
+
+bool SessionLog::openForWriting(const QString& filePath)
+{
+    close();
+
+    m_File.setFileName(filePath);
+
+    bool success{m_File.open(QIODevice::WriteOnly | QIODevice::Truncate)};
+
+    success = success && m_File.write(c_Magic) == c_Magic.size() && m_File.putChar(static_cast<char>(sc_FormatVersion));
+
+    if (success)
+    {
+        m_ElapsedTimer.start();
+        m_LastEntryTime = 0;
+    }
+    else
+    {
+        close();
+    }
+
+    return success;
+}
+
+bool SessionLog::append(SessionLog::Events event, quint32 firstArgument, quint32 secondArgument)
+{
+    Q_ASSERT(event != SessionLog::Events::EventsCount);
+
+    bool success{isOpenForWriting()};
+
+    if (success)
+    {
+        const qint64 c_CurrentTime{m_ElapsedTimer.elapsed()};
+        const int c_NrOfArguments{getNrOfArguments(event)};
+
+        char encodedEntry[c_MaxEncodedEntrySize];
+        int encodedEntrySize{1};
+
+        encodedEntry[0] = static_cast<char>(event);
+        encodedEntrySize += encodeNumber(static_cast<quint32>(qMin<qint64>(c_CurrentTime - m_LastEntryTime, std::numeric_limits<quint32>::max())), encodedEntry + encodedEntrySize);
+
+        if (c_NrOfArguments > 0)
+        {
+            encodedEntrySize += encodeNumber(firstArgument, encodedEntry + encodedEntrySize);
+        }
+
+        if (c_NrOfArguments > 1)
+        {
+            encodedEntrySize += encodeNumber(secondArgument, encodedEntry + encodedEntrySize);
+        }
+
+        // the file is buffered, the entries are written to disk in larger blocks
+        success = m_File.write(encodedEntry, encodedEntrySize) == encodedEntrySize;
+        m_LastEntryTime = c_CurrentTime;
+    }
+
+    return success;
+}
+
+bool SessionLog::openForReading(const QString& filePath)
+{
+    close();
+
+    m_File.setFileName(filePath);
+
+    bool success{m_File.open(QIODevice::ReadOnly)};
+
+    if (success)
+    {
+        m_Buffer = m_File.readAll();
+        m_File.close();
+
+        success = m_Buffer.size() >= c_HeaderSize && m_Buffer.startsWith(c_Magic) && static_cast<quint8>(m_Buffer.at(c_Magic.size())) == sc_FormatVersion;
+        m_ReadPosition = c_HeaderSize;
+    }
+
+    if (!success)
+    {
+        close();
+    }
+
+    return success;
+}
+
+bool SessionLog::readEntry(SessionLog::Entry& entry)
+{
+    bool success{!isAtEnd()};
+
+    if (success)
+    {
+        const quint8 c_EventCode{static_cast<quint8>(m_Buffer.at(m_ReadPosition++))};
+
+        success = c_EventCode < static_cast<quint8>(SessionLog::Events::EventsCount);
+
+        if (success)
+        {
+            entry = SessionLog::Entry{};
+            entry.event = static_cast<SessionLog::Events>(c_EventCode);
+
+            const int c_NrOfArguments{getNrOfArguments(entry.event)};
+
+            success = _readNumber(entry.elapsedTime) &&
+                      (c_NrOfArguments < 1 || _readNumber(entry.firstArgument)) &&
+                      (c_NrOfArguments < 2 || _readNumber(entry.secondArgument));
+        }
+
+        // no further entries are read from a corrupted log
+        if (!success)
+        {
+            m_ReadPosition = static_cast<int>(m_Buffer.size());
+        }
+    }
+
+    return success;
+}
+
+bool SessionLog::isAtEnd() const
+{
+    return m_ReadPosition >= m_Buffer.size();
+}
+
+void SessionLog::close()
+{
+    if (m_File.isOpen())
+    {
+        m_File.close();
+    }
+
+    m_Buffer.clear();
+    m_ReadPosition = 0;
+}
+
+bool SessionLog::isOpenForWriting() const
+{
+    return m_File.isOpen() && m_File.isWritable();
+}
+
+QString SessionLog::getFilePath() const
+{
+    return m_File.fileName();
+}
+
+int SessionLog::getNrOfArguments(SessionLog::Events event)
+{
+    int nrOfArguments{0};
+
+    switch (event)
+    {
+    case SessionLog::Events::SESSION_STARTED:
+    case SessionLog::Events::SET_GAME_LEVEL:
+    case SessionLog::Events::CLEAR_INPUT_WORD:
+    case SessionLog::Events::HANDLE_SUBMIT_REQUEST:
+        nrOfArguments = 1;
+        break;
+    case SessionLog::Events::SET_LANGUAGE:
+    case SessionLog::Events::ADD_PIECE_TO_INPUT_WORD:
+    case SessionLog::Events::REMOVE_PIECES_FROM_INPUT_WORD:
+        nrOfArguments = 2;
+        break;
+    default:
+        break;
+    }
+
+    return nrOfArguments;
+}
+
+bool SessionLog::_readNumber(quint32& number)
+{
+    bool isComplete{false};
+    int nrOfReadBytes{0};
+
+    number = 0;
+
+    while (!isComplete && nrOfReadBytes < c_MaxEncodedNumberSize && m_ReadPosition < m_Buffer.size())
+    {
+        const quint8 c_Byte{static_cast<quint8>(m_Buffer.at(m_ReadPosition++))};
+
+        number |= static_cast<quint32>(c_Byte & 0x7F) << (7 * nrOfReadBytes);
+        isComplete = (c_Byte & 0x80) == 0;
+        ++nrOfReadBytes;
+    }
+
+    return isComplete;
+}
@@ -0,0 +1,97 @@
+/*
+   This class fulfills following tasks:
+   1) Writes the calls received by the game facade (with their arguments and the seed of the random generators) into a compact binary log while a session is recorded
+   2) Reads the calls back in the order in which they had been written so the session can be replayed (see SessionReplayer)
+
+   Each call is stored as event code (1 byte) followed by the time elapsed since the previous call (ms) and the call arguments, all numbers being written as variable length integers
+   (7 bits per byte, so most calls take 2 to 4 bytes). The byte order of the host is therefore irrelevant.
+*/
+
+#ifndef SESSIONLOG_H
+#define SESSIONLOG_H
+
+#include <QString>
+#include <QByteArray>
+#include <QFile>
+#include <QElapsedTimer>
+
+class SessionLog
+{
+public:
+    enum class Events : quint8
+    {
+        SESSION_STARTED,                            // argument: seed of the random generators
+        INIT,
+        START_GAME,
+        RESUME_GAME,
+        PAUSE_GAME,
+        QUIT_GAME,
+        SET_GAME_LEVEL,                             // argument: level
+        SET_LANGUAGE,                               // arguments: language index, revert language when data unavailable (0/1)
+        ENABLE_TIME_LIMIT,
+        DISABLE_TIME_LIMIT,
+        TIME_LIMIT_REACHED,                         // not a call: triggered by the chronometer of the facade
+        ENABLE_PERSISTENT_MODE,
+        DISABLE_PERSISTENT_MODE,
+        GO_TO_NEXT_PERSISTENT_MODE_CONTAINER,
+        INCREASE_PERSISTENT_INDEX,
+        DECREASE_PERSISTENT_INDEX,
+        EXECUTE_FIRST_PERSISTENT_MODE_ACTION,
+        EXECUTE_SECOND_PERSISTENT_MODE_ACTION,
+        ADD_PIECE_TO_INPUT_WORD,                    // arguments: input word number (0/1), word piece index
+        REMOVE_PIECES_FROM_INPUT_WORD,              // arguments: input word number (0/1), input range start
+        CLEAR_INPUT_WORD,                           // argument: input word number (0/1)
+        CLEAR_INPUT,
+        HANDLE_SUBMIT_REQUEST,                      // argument: correct user input (0/1), used for checking the replay
+        PROVIDE_CORRECT_WORDS_PAIR_TO_USER,
+        RESET_GAME_STATISTICS,
+        HANDLE_DATA_SAVING_OPERATION_IN_PROGRESS,
+        EventsCount
+    };
+
+    struct Entry
+    {
+        Entry();
+
+        SessionLog::Events event;
+        quint32 elapsedTime; // ms since previous entry
+        quint32 firstArgument;
+        quint32 secondArgument;
+    };
+
+    SessionLog();
+    ~SessionLog();
+
+    // writing: an existing log file is overwritten
+    bool openForWriting(const QString& filePath);
+    bool append(SessionLog::Events event, quint32 firstArgument = 0, quint32 secondArgument = 0);
+
+    // reading: the entire log is read when opening, false is returned by readEntry() at the end of the log or if the log is corrupted
+    bool openForReading(const QString& filePath);
+    bool readEntry(SessionLog::Entry& entry);
+    bool isAtEnd() const;
+
+    void close();
+
+    bool isOpenForWriting() const;
+    QString getFilePath() const;
+
+    static int getNrOfArguments(SessionLog::Events event);
+
+private:
+    SessionLog(const SessionLog&) = delete;
+    SessionLog& operator=(const SessionLog&) = delete;
+
+    bool _readNumber(quint32& number);
+
+    // bump whenever the encoding or the event codes change
+    static constexpr quint8 sc_FormatVersion{1};
+
+    QFile m_File;
+    QElapsedTimer m_ElapsedTimer;
+    qint64 m_LastEntryTime;
+    QByteArray m_Buffer; // entire content of the log being read
+    int m_ReadPosition;
+};
+
+#endif // SESSIONLOG_H
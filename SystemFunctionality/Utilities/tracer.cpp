@@ -0,0 +1,196 @@
+#include <QCoreApplication>
+#include <QThread>
+#include <QMutexLocker>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonDocument>
+#include <QSaveFile>
+
+#include <atomic>
+
+#include "tracer.h"
+
+/* Single writer (the owning thread), any number of readers (dumping threads):
+   - the writer announces each event (started counter) before overwriting its slot and publishes it (written counter) afterwards
+   - a reader collects the published events and then drops the ones whose slots might have been overwritten meanwhile (checked by using the started counter)
+   The slot fields are atomics so concurrent reading is never undefined behavior (relaxed accesses are plain moves on common platforms).
+*/
+class Tracer::ThreadBuffer
+{
+public:
+    ThreadBuffer(int threadId, const QString& threadName, int capacity)
+        : m_ThreadId{threadId}
+        , m_ThreadName{threadName}
+        , m_Capacity{capacity}
+        , m_Events{new Event[static_cast<size_t>(capacity)]}
+        , m_NrOfStartedEvents{0}
+        , m_NrOfWrittenEvents{0}
+    {
+    }
+
+    void addEvent(const char* pName, qint64 startTime, qint64 endTime)
+    {
+        const quint64 c_EventNumber{m_NrOfWrittenEvents.load(std::memory_order_relaxed)};
+        Event& event{m_Events[static_cast<size_t>(c_EventNumber % static_cast<quint64>(m_Capacity))]};
+
+        m_NrOfStartedEvents.store(c_EventNumber + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        event.pName.store(pName, std::memory_order_relaxed);
+        event.startTime.store(startTime, std::memory_order_relaxed);
+        event.endTime.store(endTime, std::memory_order_relaxed);
+
+        m_NrOfWrittenEvents.store(c_EventNumber + 1, std::memory_order_release);
+    }
+
+    void appendEvents(QJsonArray& traceEvents, qint64 processId) const
+    {
+        const quint64 c_Capacity{static_cast<quint64>(m_Capacity)};
+        const quint64 c_NrOfWrittenEvents{m_NrOfWrittenEvents.load(std::memory_order_acquire)};
+        const quint64 c_FirstEventNumber{c_NrOfWrittenEvents > c_Capacity ? c_NrOfWrittenEvents - c_Capacity : 0};
+
+        struct EventCopy
+        {
+            const char* pName;
+            qint64 startTime;
+            qint64 endTime;
+        };
+
+        std::vector<EventCopy> eventCopies;
+        eventCopies.reserve(static_cast<size_t>(c_NrOfWrittenEvents - c_FirstEventNumber));
+
+        for (quint64 eventNumber{c_FirstEventNumber}; eventNumber < c_NrOfWrittenEvents; ++eventNumber)
+        {
+            const Event& c_Event{m_Events[static_cast<size_t>(eventNumber % c_Capacity)]};
+            eventCopies.push_back(EventCopy{c_Event.pName.load(std::memory_order_relaxed), c_Event.startTime.load(std::memory_order_relaxed), c_Event.endTime.load(std::memory_order_relaxed)});
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        const quint64 c_NrOfStartedEvents{m_NrOfStartedEvents.load(std::memory_order_relaxed)};
+        const quint64 c_FirstIntactEventNumber{c_NrOfStartedEvents > c_Capacity ? c_NrOfStartedEvents - c_Capacity : 0};
+
+        QJsonObject threadNameEvent;
+        threadNameEvent.insert("name", "thread_name");
+        threadNameEvent.insert("ph", "M");
+        threadNameEvent.insert("pid", processId);
+        threadNameEvent.insert("tid", m_ThreadId);
+        threadNameEvent.insert("args", QJsonObject{{"name", m_ThreadName}});
+        traceEvents.append(threadNameEvent);
+
+        for (quint64 eventNumber{qMax(c_FirstEventNumber, c_FirstIntactEventNumber)}; eventNumber < c_NrOfWrittenEvents; ++eventNumber)
+        {
+            const EventCopy& c_EventCopy{eventCopies[static_cast<size_t>(eventNumber - c_FirstEventNumber)]};
+
+            // complete events, times in microseconds
+            QJsonObject traceEvent;
+            traceEvent.insert("name", QString::fromLatin1(c_EventCopy.pName));
+            traceEvent.insert("ph", "X");
+            traceEvent.insert("ts", c_EventCopy.startTime / 1000.0);
+            traceEvent.insert("dur", (c_EventCopy.endTime - c_EventCopy.startTime) / 1000.0);
+            traceEvent.insert("pid", processId);
+            traceEvent.insert("tid", m_ThreadId);
+            traceEvents.append(traceEvent);
+        }
+    }
+
+private:
+    struct Event
+    {
+        std::atomic<const char*> pName;
+        std::atomic<qint64> startTime;
+        std::atomic<qint64> endTime;
+    };
+
+    const int m_ThreadId;
+    const QString m_ThreadName;
+    const int m_Capacity;
+    std::unique_ptr<Event[]> m_Events;
+    std::atomic<quint64> m_NrOfStartedEvents;
+    std::atomic<quint64> m_NrOfWrittenEvents;
+};
+
+Tracer* Tracer::getTracer()
+{
+    // never destroyed: threads might still trace while the static objects get destroyed at exit
+    static Tracer* const s_pTracer{new Tracer{}};
+
+    return s_pTracer;
+}
+
+bool Tracer::isTracingEnabled()
+{
+#ifdef SYNANT_TRACING_ENABLED
+    return true;
+#else
+    return false;
+#endif
+}
+
+qint64 Tracer::getCurrentTime() const
+{
+    return m_ElapsedTimer.nsecsElapsed();
+}
+
+void Tracer::addEvent(const char* pName, qint64 startTime, qint64 endTime)
+{
+    _getThreadBuffer()->addEvent(pName, startTime, endTime);
+}
+
+bool Tracer::writeChromeTrace(const QString& filePath)
+{
+    QJsonArray traceEvents;
+    const qint64 c_ProcessId{QCoreApplication::applicationPid()};
+
+    {
+        QMutexLocker mutexLocker{&m_ThreadBuffersMutex};
+
+        for (const auto& pThreadBuffer : m_ThreadBuffers)
+        {
+            pThreadBuffer->appendEvents(traceEvents, c_ProcessId);
+        }
+    }
+
+    QJsonObject trace;
+    trace.insert("traceEvents", traceEvents);
+    trace.insert("displayTimeUnit", "ms");
+
+    QSaveFile traceFile{filePath};
+
+    return traceFile.open(QIODevice::WriteOnly) && traceFile.write(QJsonDocument{trace}.toJson(QJsonDocument::Compact)) != -1 && traceFile.commit();
+}
+
+Tracer::Tracer()
+{
+    m_ElapsedTimer.start();
+}
+
+Tracer::~Tracer()
+{
+}
+
+Tracer::ThreadBuffer* Tracer::_getThreadBuffer()
+{
+    // the buffers are owned by the tracer and never released so the events of finished threads can still be dumped
+    static thread_local ThreadBuffer* t_pThreadBuffer{nullptr};
+
+    if (!t_pThreadBuffer)
+    {
+        QMutexLocker mutexLocker{&m_ThreadBuffersMutex};
+
+        const int c_ThreadId{static_cast<int>(m_ThreadBuffers.size()) + 1};
+        const QThread* const c_pCurrentThread{QThread::currentThread()};
+        QString threadName{c_pCurrentThread ? c_pCurrentThread->objectName() : QString{}};
+
+        if (threadName.isEmpty())
+        {
+            const bool c_IsMainThread{QCoreApplication::instance() && QCoreApplication::instance()->thread() == c_pCurrentThread};
+            threadName = c_IsMainThread ? QString{"Main"} : "Thread " + QString::number(c_ThreadId);
+        }
+
+        m_ThreadBuffers.emplace_back(new ThreadBuffer{c_ThreadId, threadName, sc_ThreadBufferCapacity});
+        t_pThreadBuffer = m_ThreadBuffers.back().get();
+    }
+
+    return t_pThreadBuffer;
+}
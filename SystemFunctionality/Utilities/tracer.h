@@ -0,0 +1,87 @@
+/*
+   This class records timed events (scopes) from any thread of the process so it can be seen where time goes across GUI, loader, cache and prefetcher threads:
+   1) Each thread writes its events into its own fixed capacity ring buffer (no locking, the oldest events get overwritten when the buffer is full)
+   2) On demand the events of all threads are dumped as Chrome trace-event JSON (to be opened with chrome://tracing or ui.perfetto.dev)
+
+   The events are recorded by using the TRACE_SCOPE macro which is only compiled in when building with -DENABLE_TRACING=ON (SYNANT_TRACING_ENABLED defined).
+   Otherwise the macro expands to nothing so the traced code has no overhead at all. The event names should be string literals (they are stored as pointers).
+*/
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <QString>
+#include <QMutex>
+#include <QElapsedTimer>
+
+#include <memory>
+#include <vector>
+
+#ifdef SYNANT_TRACING_ENABLED
+#define TRACE_CONCATENATE_IMPL(first, second) first##second
+#define TRACE_CONCATENATE(first, second) TRACE_CONCATENATE_IMPL(first, second)
+#define TRACE_SCOPE(name) const ScopedTrace TRACE_CONCATENATE(scopedTrace, __LINE__){name}
+#else
+#define TRACE_SCOPE(name)
+#endif
+
+class Tracer
+{
+public:
+    static Tracer* getTracer();
+
+    // false if the tracing macros have been compiled out (no events get recorded)
+    static bool isTracingEnabled();
+
+    // ns since the tracer has been created
+    qint64 getCurrentTime() const;
+
+    // should only be called by ScopedTrace (the event is added to the buffer of the calling thread)
+    void addEvent(const char* pName, qint64 startTime, qint64 endTime);
+
+    // can be called from any thread while the others keep on tracing (the events being overwritten during the dump are skipped)
+    bool writeChromeTrace(const QString& filePath);
+
+private:
+    class ThreadBuffer;
+
+    Tracer();
+    ~Tracer();
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    ThreadBuffer* _getThreadBuffer();
+
+    static constexpr int sc_ThreadBufferCapacity{16384};
+
+    QElapsedTimer m_ElapsedTimer;
+
+    // only locked when a thread records its first event and when dumping
+    QMutex m_ThreadBuffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_ThreadBuffers;
+};
+
+class ScopedTrace
+{
+public:
+    explicit ScopedTrace(const char* pName)
+        : m_pName{pName}
+        , m_StartTime{Tracer::getTracer()->getCurrentTime()}
+    {
+    }
+
+    ~ScopedTrace()
+    {
+        Tracer* const c_pTracer{Tracer::getTracer()};
+        c_pTracer->addEvent(m_pName, m_StartTime, c_pTracer->getCurrentTime());
+    }
+
+private:
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+    const char* m_pName;
+    qint64 m_StartTime;
+};
+
+#endif // TRACER_H
@@ -3,6 +3,10 @@
 #include <memory>
 
 #include "wordmixer.h"
+#include "wordpairprefetcher.h"
+#include "wordpairowner.h"
+#include "datasource.h"
+#include "gamesession.h"
 
 class CoreFunctionalityTests : public QObject
 {
@@ -16,10 +20,16 @@ private slots:
     void testWordsAreCorrectlyMixed();
     void testSetPieceSize();
     void testFirstLastPieceIndexesAreCorrect();
+    void testWordsPairPrefetched();
+    void testWordPairOwnerPiecesStatus();
+    void testGameSessionsSharingDataSource();
+    void benchmarkMixWords_data();
+    void benchmarkMixWords();
 
 private:
     void _checkCorrectMixing(QVector<QString> mixedWords, QVector<QString> splitWords, const QString& level);
     void _checkLevelAndPieceSize(const WordMixer& wordMixer, Game::Levels level, int pieceSize);
+    void _addWordToInput(GameSession& gameSession, Game::InputWordNumber inputWordNumber, const QString& word);
 };
 
 CoreFunctionalityTests::CoreFunctionalityTests()
@@ -117,6 +127,200 @@ void CoreFunctionalityTests::testFirstLastPieceIndexesAreCorrect()
     QVERIFY2(pWordMixer->getMixedWordsPiecesContent()[pWordMixer->getSecondWordLastPieceIndex()] == "d",secondWordLastPieceIndexNotCorrect);
 }
 
+void CoreFunctionalityTests::testWordsPairPrefetched()
+{
+    // required by signal spy for recording the mixed pair
+    Q_UNUSED(qRegisterMetaType<WordMixer::MixedWordsPair>());
+
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+    std::unique_ptr<WordPairPrefetcher> pWordPairPrefetcher{new WordPairPrefetcher{pDataSource.get()}};
+    QSignalSpy wordsPairPrefetchedSpy{pWordPairPrefetcher.get(), &WordPairPrefetcher::wordsPairPrefetched};
+
+    pDataSource->updateDataEntries({{"firstword", "secondword", true}}, 0, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+
+    pWordPairPrefetcher->onWordsPairPrefetchRequested(1, 0, 0, Game::Levels::LEVEL_EASY, 1);
+    pWordPairPrefetcher->onWordsPairPrefetchRequested(2, 0, 1, Game::Levels::LEVEL_EASY, 2);
+    pWordPairPrefetcher->onWordsPairPrefetchRequested(3, 1, 0, Game::Levels::LEVEL_EASY, 3);
+    pWordPairPrefetcher->onWordsPairPrefetchRequested(4, 0, 0, Game::Levels::LEVEL_HARD, 4);
+
+    QVERIFY2(wordsPairPrefetchedSpy.count() == 4, "Each prefetch request should be acknowledged exactly once");
+
+    const WordMixer::MixedWordsPair mixedWordsPair{qvariant_cast<WordMixer::MixedWordsPair>(wordsPairPrefetchedSpy.at(0).at(2))};
+
+    QVERIFY2(wordsPairPrefetchedSpy.at(0).at(0).toInt() == 1 && wordsPairPrefetchedSpy.at(0).at(1).toBool(), "Words pair not prefetched for valid entry");
+    QVERIFY2(mixedWordsPair.firstWord == "firstword" && mixedWordsPair.secondWord == "secondword" && mixedWordsPair.areSynonyms, "Words pair incorrectly prefetched");
+    _checkCorrectMixing(mixedWordsPair.piecesContent, QVector<QString>{"fir", "stw", "ord", "sec", "ond", "wor", "d"}, "easy");
+    QVERIFY2(mixedWordsPair.piecesContent[mixedWordsPair.firstWordFirstPieceIndex] == "fir" && mixedWordsPair.piecesContent[mixedWordsPair.secondWordLastPieceIndex] == "d", "Incorrect first/last piece indexes in prefetched pair");
+
+    QVERIFY2(!wordsPairPrefetchedSpy.at(1).at(1).toBool(), "Words pair prefetched for a language which is not the primary one");
+    QVERIFY2(!wordsPairPrefetchedSpy.at(2).at(1).toBool(), "Words pair prefetched for an out of range entry number");
+
+    // a pair mixed with the same seed outside the prefetcher (e.g. by facade when the prefetched pair is not available yet) should be identical
+    std::unique_ptr<WordMixer> pWordMixer{new WordMixer{}};
+    pWordMixer->setGameLevel(Game::Levels::LEVEL_HARD);
+    pWordMixer->setSeed(4);
+    pWordMixer->mixWords(QPair<QString, QString>{"firstword", "secondword"}, true);
+
+    QVERIFY2(qvariant_cast<WordMixer::MixedWordsPair>(wordsPairPrefetchedSpy.at(3).at(2)).piecesContent == pWordMixer->getMixedWordsPiecesContent(),
+             "Words pairs mixed with the same seed are different");
+}
+
+void CoreFunctionalityTests::testWordPairOwnerPiecesStatus()
+{
+    std::unique_ptr<WordPairOwner> pWordPairOwner{new WordPairOwner{}};
+
+    // first word: "abcde" (pieces 2, 0, 4), second word: "fghij" (pieces 1, 3, 5)
+    pWordPairOwner->setNewWordsPair(QVector<QString>{"cd", "fg", "ab", "hi", "e", "j"}, "abcde", "fghij", true, 2, 4, 1, 5);
+
+    const QVector<Game::PieceTypes> c_ExpectedPiecesTypes{Game::PieceTypes::MIDDLE_PIECE, Game::PieceTypes::BEGIN_PIECE, Game::PieceTypes::BEGIN_PIECE,
+                                                          Game::PieceTypes::MIDDLE_PIECE, Game::PieceTypes::END_PIECE, Game::PieceTypes::END_PIECE};
+
+    QVERIFY2(pWordPairOwner->getMixedWordsPiecesContent() == (QVector<QString>{"cd", "fg", "ab", "hi", "e", "j"}), "Incorrect pieces content");
+    QVERIFY2(pWordPairOwner->getMixedWordsPiecesTypes() == c_ExpectedPiecesTypes, "Incorrect pieces types");
+    QVERIFY2(pWordPairOwner->getAreMixedWordsPiecesAddedToInput() == QVector<bool>(6, false), "No piece should be added to input for a new pair");
+
+    for (int pieceIndex{0}; pieceIndex < 5; ++pieceIndex)
+    {
+        pWordPairOwner->markPieceAsAddedToInput(pieceIndex);
+    }
+
+    QVERIFY2(pWordPairOwner->getIsWordPieceAddedToInput(4) && !pWordPairOwner->getIsWordPieceAddedToInput(5), "Incorrect added to input status");
+    QVERIFY2(pWordPairOwner->isOnePieceLeftToAddToInput(), "Exactly one piece should be left to add to input");
+
+    pWordPairOwner->markPiecesAsRemovedFromInput(QVector<int>{3, 4});
+
+    QVERIFY2(!pWordPairOwner->isOnePieceLeftToAddToInput(), "More than one piece should be left to add to input after removing pieces");
+    QVERIFY2(pWordPairOwner->getAreMixedWordsPiecesAddedToInput() == (QVector<bool>{true, true, true, false, false, false}), "Incorrect added to input statuses after removing pieces");
+}
+
+void CoreFunctionalityTests::testGameSessionsSharingDataSource()
+{
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+
+    // each word piece is unique (medium level: 2 characters per piece) so the input can be built by matching the content
+    pDataSource->updateDataEntries({{"abcdefghij", "klmnopqrst", true}}, 0, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+    pDataSource->updateDataEntries({{"zyxwvutsrq", "ponmlkjihg", false}}, 1, DataSource::UpdateOperation::LOAD_AS_RESIDENT);
+
+    std::unique_ptr<GameSession> pFirstSession{new GameSession{1, pDataSource.get()}};
+    std::unique_ptr<GameSession> pSecondSession{new GameSession{2, pDataSource.get()}};
+
+    QVERIFY2(pFirstSession->setLanguage(0) && pSecondSession->setLanguage(1), "Resident languages could not be set for the sessions");
+    QVERIFY2(pFirstSession->getFirstReferenceWord() == "abcdefghij" && pFirstSession->areWordsFromCurrentPairSynonyms(), "Incorrect words pair provided to first session");
+    QVERIFY2(pSecondSession->getFirstReferenceWord() == "zyxwvutsrq" && !pSecondSession->areWordsFromCurrentPairSynonyms(), "Incorrect words pair provided to second session");
+
+    QVERIFY2(!pFirstSession->handleSubmitRequest(), "Empty input accepted as correct");
+
+    _addWordToInput(*pFirstSession, Game::InputWordNumber::ONE, "klmnopqrst");
+    _addWordToInput(*pFirstSession, Game::InputWordNumber::TWO, "abcdefghij");
+
+    QVERIFY2(pFirstSession->isInputComplete(), "Input should be complete after adding all pieces");
+    QVERIFY2(pFirstSession->handleSubmitRequest(), "Correct input (words in reverse order) not accepted");
+    QVERIFY2(pFirstSession->isWordsPairAvailable() && pFirstSession->getFirstWordInputIndexes().isEmpty(), "Next words pair not provided after correct input");
+
+    pSecondSession->provideCorrectWordsPairToUser();
+
+    QVERIFY2(pFirstSession->getGuessedWordPairs() == "1" && pFirstSession->getTotalWordPairs() == "1", "Incorrect statistics for first session");
+    QVERIFY2(pSecondSession->getGuessedWordPairs() == "0" && pSecondSession->getTotalWordPairs() == "1", "Incorrect statistics for second session");
+
+    QVERIFY2(pDataSource->isLanguagePinned(0) && pDataSource->isLanguagePinned(1), "The session languages are not pinned");
+    QVERIFY2(!pSecondSession->setLanguage(2) && !pSecondSession->isWordsPairAvailable(), "Language which is not resident set for session");
+    QVERIFY2(!pDataSource->isLanguagePinned(1), "The previous session language is still pinned");
+
+    pFirstSession.reset();
+
+    QVERIFY2(!pDataSource->isLanguagePinned(0), "The session language is still pinned after destroying the session");
+}
+
+void CoreFunctionalityTests::benchmarkMixWords_data()
+{
+    QTest::addColumn<int>("level");
+    QTest::addColumn<bool>("isHandedOverToOwner");
+
+    QTest::newRow("easy") << static_cast<int>(Game::Levels::LEVEL_EASY) << false;
+    QTest::newRow("medium") << static_cast<int>(Game::Levels::LEVEL_MEDIUM) << false;
+    QTest::newRow("hard") << static_cast<int>(Game::Levels::LEVEL_HARD) << false;
+    QTest::newRow("easy owned") << static_cast<int>(Game::Levels::LEVEL_EASY) << true;
+    QTest::newRow("medium owned") << static_cast<int>(Game::Levels::LEVEL_MEDIUM) << true;
+    QTest::newRow("hard owned") << static_cast<int>(Game::Levels::LEVEL_HARD) << true;
+}
+
+void CoreFunctionalityTests::benchmarkMixWords()
+{
+    QFETCH(int, level);
+    QFETCH(bool, isHandedOverToOwner);
+
+    // word sizes are not multiples of the easy and medium piece sizes so the last piece of each word is shorter (pieces of different sizes get swapped between slots)
+    const QPair<QString, QString> c_WordsPair{"example", "alternative"};
+    std::unique_ptr<WordMixer> pWordMixer{new WordMixer{}};
+    std::unique_ptr<WordPairOwner> pWordPairOwner{new WordPairOwner{}};
+    QVector<QString> consumerPiecesContent;
+
+    // same path as in facade and game session, the consumer keeping a shallow copy of the owned pieces (like the presentation model)
+    auto mixWords = [&]()
+    {
+        pWordMixer->mixWords(c_WordsPair, true);
+
+        if (isHandedOverToOwner)
+        {
+            const WordMixer::MixedWordsPair c_MixedWordsPair{pWordMixer->getMixedWordsPair()};
+
+            pWordPairOwner->setNewWordsPair(c_MixedWordsPair.piecesContent, c_MixedWordsPair.firstWord, c_MixedWordsPair.secondWord, c_MixedWordsPair.areSynonyms,
+                                            c_MixedWordsPair.firstWordFirstPieceIndex, c_MixedWordsPair.firstWordLastPieceIndex,
+                                            c_MixedWordsPair.secondWordFirstPieceIndex, c_MixedWordsPair.secondWordLastPieceIndex);
+
+            consumerPiecesContent = pWordPairOwner->getMixedWordsPiecesContent();
+        }
+    };
+
+    auto getBuffers = [](const QVector<QString>& piecesContent)
+    {
+        QVector<const void*> buffers{piecesContent.constData()};
+
+        for (const auto& piece : piecesContent)
+        {
+            buffers.append(piece.constData());
+        }
+
+        return buffers;
+    };
+
+    pWordMixer->setGameLevel(static_cast<Game::Levels>(level));
+
+    // warm-up (buffers are allocated here), the owner alternates between two buffers
+    mixWords();
+    QVector<const void*> ownerBuffers{getBuffers(pWordPairOwner->getMixedWordsPiecesContent())};
+    mixWords();
+    ownerBuffers.append(getBuffers(pWordPairOwner->getMixedWordsPiecesContent()));
+
+    // record the buffers allocated during warm-up, mixing should reuse them instead of allocating new ones
+    QVector<const void*> mixerBuffers{getBuffers(pWordMixer->getMixedWordsPiecesContent())};
+
+    QBENCHMARK
+    {
+        mixWords();
+    }
+
+    QVector<const void*> reusedMixerBuffers{getBuffers(pWordMixer->getMixedWordsPiecesContent())};
+
+    std::sort(mixerBuffers.begin(), mixerBuffers.end());
+    std::sort(reusedMixerBuffers.begin(), reusedMixerBuffers.end());
+
+    QVERIFY2(mixerBuffers == reusedMixerBuffers, "The mixer buffers have been reallocated after warm-up");
+
+    if (isHandedOverToOwner)
+    {
+        bool areOwnerBuffersReused{true};
+
+        for (auto pBuffer : getBuffers(pWordPairOwner->getMixedWordsPiecesContent()))
+        {
+            areOwnerBuffersReused = areOwnerBuffersReused && ownerBuffers.contains(pBuffer);
+        }
+
+        QVERIFY2(areOwnerBuffersReused, "The owner buffers have been reallocated after warm-up");
+        QVERIFY2(consumerPiecesContent == pWordPairOwner->getMixedWordsPiecesContent(), "Incorrect pieces provided by owner");
+    }
+}
+
 void CoreFunctionalityTests::_checkCorrectMixing(QVector<QString> mixedWords, QVector<QString> splitWords, const QString &level)
 {
     qInfo() << "Checking correct word mixing, level:" << level;
@@ -138,6 +342,18 @@ void CoreFunctionalityTests::_checkLevelAndPieceSize(const WordMixer& wordMixer,
     QVERIFY2(wordMixer.getCurrentPieceSize() == pieceSize, "The piece size for the setup level is incorrect");
 }
 
+void CoreFunctionalityTests::_addWordToInput(GameSession& gameSession, Game::InputWordNumber inputWordNumber, const QString& word)
+{
+    const int c_PieceSize{2};
+
+    for (int position{0}; position < word.size(); position += c_PieceSize)
+    {
+        const int c_PieceIndex{static_cast<int>(gameSession.getMixedWordsPiecesContent().indexOf(word.mid(position, c_PieceSize)))};
+
+        QVERIFY2(gameSession.addPieceToInputWord(inputWordNumber, c_PieceIndex), "Piece could not be added to input");
+    }
+}
+
 QTEST_APPLESS_MAIN(CoreFunctionalityTests)
 
 #include "tst_corefunctionalitytests.moc"
@@ -1,10 +1,17 @@
 #include <QtTest>
+#include <QSqlDatabase>
+#include <QSqlQuery>
 
 #include <memory>
+#include <algorithm>
 
 #include "datasource.h"
 #include "datasourceloader.h"
+#include "datasourcesnapshot.h"
 #include "datasourceaccesshelper.h"
+#include "databaseutils.h"
+#include "gameutils.h"
+#include "metricsregistry.h"
 
 class DataAccessTests : public QObject
 {
@@ -21,6 +28,26 @@ private slots:
     void testDataSourceAccessHelperUseAllEntries();
     void testDataSourceAccessHelperSelfReset();
     void testDataSourceAccessHelperResetUsedEntries();
+    void testDataSourceAccessHelperAddEntries();
+    void testDataSourceAccessHelperReleaseEntryNumber();
+    void testDataSourceEntryAlreadyExists();
+    void testDataSourceGetPrimarySourceDataEntry();
+    void testDataSourceAppendEntries();
+    void testDataSourceResidentLanguages();
+    void testDataSourcePreloadedLanguages();
+    void testDataSourceResidencyPins();
+    void testDataSourceLoaderChunkedLoad();
+    void testDataSourceLoaderInvalidRequest();
+    void testDataSourceLoaderRejectedEntries();
+    void testDataSourceLoaderQueryFilteringMatchesValidationRules();
+    void testDataSourceLoaderSnapshot();
+
+private:
+    // validation rules applied by the loader to all rows before the load query started filtering them (same order)
+    DataEntryValidator::ValidationCodes _getExpectedValidationCode(const DataSource::DataEntry& dataEntry);
+    bool _createDatabase(const QString& databasePath, int languageIndex, int nrOfEntries);
+    bool _createDatabase(const QString& databasePath, int languageIndex, const QVector<DataSource::DataEntry>& dataEntries);
+    QString _createWord(const QString& prefix, int wordNumber);
 };
 
 DataAccessTests::DataAccessTests()
@@ -167,6 +194,644 @@ void DataAccessTests::testDataSourceAccessHelperResetUsedEntries()
     QVERIFY2(pDataSourceAccessHelper->getTotalNrOfEntries() == 3, "The total number of entries after reset is not correct");
 }
 
-QTEST_APPLESS_MAIN(DataAccessTests)
+void DataAccessTests::testDataSourceAccessHelperAddEntries()
+{
+    std::unique_ptr<DataSourceAccessHelper> pDataSourceAccessHelper{new DataSourceAccessHelper{}};
+    QVector<bool> entryNumberGenerated(5, false);
+
+    pDataSourceAccessHelper->setEntriesTable(2);
+    entryNumberGenerated[pDataSourceAccessHelper->generateEntryNumber()] = true;
+    pDataSourceAccessHelper->addEntriesToTable(3);
+
+    QVERIFY2(pDataSourceAccessHelper->getNrOfUsedEntries() == 1, "The number of used entries has been changed by adding entries!");
+    QVERIFY2(pDataSourceAccessHelper->getTotalNrOfEntries() == 5, "The total number of entries after adding entries is not correct");
+
+    for (int iterationNr{0}; iterationNr < 4; ++iterationNr)
+    {
+        const int entryNumber{pDataSourceAccessHelper->generateEntryNumber()};
+
+        QVERIFY2(entryNumber >= 0 && entryNumber < 5, "Invalid entry number generated!");
+        QVERIFY2(!entryNumberGenerated[entryNumber], "Duplicate entry number generated after adding entries!");
+
+        entryNumberGenerated[entryNumber] = true;
+    }
+
+    QVERIFY2(pDataSourceAccessHelper->getNrOfUsedEntries() == 5, "The number of used entries is not correct");
+}
+
+void DataAccessTests::testDataSourceAccessHelperReleaseEntryNumber()
+{
+    std::unique_ptr<DataSourceAccessHelper> pDataSourceAccessHelper{new DataSourceAccessHelper{}};
+    QVector<bool> entryNumberGenerated(4, false);
+
+    pDataSourceAccessHelper->setEntriesTable(4);
+
+    const int c_ConsumedEntryNumber{pDataSourceAccessHelper->generateEntryNumber()};
+    const int c_FirstReleasedEntryNumber{pDataSourceAccessHelper->generateEntryNumber()};
+    const int c_SecondReleasedEntryNumber{pDataSourceAccessHelper->generateEntryNumber()};
+
+    QVERIFY2(pDataSourceAccessHelper->releaseEntryNumber(c_FirstReleasedEntryNumber), "The first entry number has not been released!");
+    QVERIFY2(pDataSourceAccessHelper->releaseEntryNumber(c_SecondReleasedEntryNumber), "The second entry number has not been released!");
+    QVERIFY2(!pDataSourceAccessHelper->releaseEntryNumber(c_SecondReleasedEntryNumber), "An entry number has been released twice!");
+    QVERIFY2(pDataSourceAccessHelper->getNrOfUsedEntries() == 1, "The number of used entries after releasing is not correct!");
+
+    entryNumberGenerated[c_ConsumedEntryNumber] = true;
+
+    // the released entry numbers should be generated again before the table gets reset
+    for (int iterationNr{0}; iterationNr < 3; ++iterationNr)
+    {
+        const int entryNumber{pDataSourceAccessHelper->generateEntryNumber()};
+
+        QVERIFY2(entryNumber >= 0 && entryNumber < 4, "Invalid entry number generated!");
+        QVERIFY2(!entryNumberGenerated[entryNumber], "Duplicate entry number generated after releasing entries!");
+
+        entryNumberGenerated[entryNumber] = true;
+    }
+
+    QVERIFY2(pDataSourceAccessHelper->getNrOfUsedEntries() == 4, "The number of used entries is not correct");
+
+    // not in use after resetting the table
+    pDataSourceAccessHelper->setEntriesTable(4);
+
+    QVERIFY2(!pDataSourceAccessHelper->releaseEntryNumber(c_ConsumedEntryNumber), "An unused entry number has been released!");
+    QVERIFY2(pDataSourceAccessHelper->getNrOfUsedEntries() == 0, "The number of used entries has been changed by releasing an unused entry!");
+}
+
+void DataAccessTests::testDataSourceEntryAlreadyExists()
+{
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+
+    pDataSource->updateDataEntries({{"firstword", "secondword", true}, {"thirdword", "fourthword", false}}, 0, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+
+    QVERIFY2(pDataSource->entryAlreadyExists({"firstword", "secondword", true}, 0), "Loaded entry not found in primary source!");
+    QVERIFY2(pDataSource->entryAlreadyExists({"fourthword", "thirdword", true}, 0), "Loaded entry with reversed words not found in primary source!");
+    QVERIFY2(!pDataSource->entryAlreadyExists({"firstword", "thirdword", true}, 0), "Entry found although it has not been loaded!");
+    QVERIFY2(!pDataSource->entryAlreadyExists({"firstword", "secondword", true}, 1), "Entry found for a language that is not loaded!");
+
+    pDataSource->updateDataEntries({{"fifthword", "sixthword", true}}, 1, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+
+    QVERIFY2(pDataSource->entryAlreadyExists({"firstword", "secondword", true}, 0), "Entry not found after primary source moved to secondary!");
+    QVERIFY2(pDataSource->entryAlreadyExists({"sixthword", "fifthword", true}, 1), "Entry not found in newly loaded primary source!");
+    QVERIFY2(!pDataSource->entryAlreadyExists({"fifthword", "sixthword", true}, 0), "Entry found in the wrong language!");
+
+    pDataSource->updateDataEntries({{"seventhword", "eighthword", false}}, 0, DataSource::UpdateOperation::APPEND);
+
+    QVERIFY2(pDataSource->entryAlreadyExists({"eighthword", "seventhword", false}, 0), "Appended entry not found!");
+    QVERIFY2(!pDataSource->entryAlreadyExists({"seventhword", "eighthword", false}, 1), "Appended entry found in the wrong language!");
+
+    pDataSource->updateDataEntries({}, 0, DataSource::UpdateOperation::SET_AS_PRIMARY);
+
+    QVERIFY2(pDataSource->getPrimarySourceLanguageIndex() == 0, "Sources have not been swapped!");
+    QVERIFY2(pDataSource->entryAlreadyExists({"thirdword", "fourthword", false}, 0), "Entry not found after swapping sources!");
+    QVERIFY2(pDataSource->entryAlreadyExists({"fifthword", "sixthword", true}, 1), "Entry not found after swapping sources!");
+}
+
+void DataAccessTests::testDataSourceGetPrimarySourceDataEntry()
+{
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+    DataSource::DataEntry dataEntry;
+
+    pDataSource->updateDataEntries({{"firstword", "secondword", true}, {"thirdword", "fourthword", false}}, 0, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+    pDataSource->updateDataEntries({{"fifthword", "sixthword", true}}, 0, DataSource::UpdateOperation::APPEND);
+
+    QVERIFY2(pDataSource->getPrimarySourceNrOfEntries() == 3, "Incorrect number of primary source entries!");
+    QVERIFY2(pDataSource->getPrimarySourceDataEntry(1, 0, dataEntry), "Loaded entry could not be retrieved!");
+    QVERIFY2(dataEntry.firstWord == "thirdword" && dataEntry.secondWord == "fourthword" && !dataEntry.areSynonyms, "Incorrect loaded entry retrieved!");
+    QVERIFY2(pDataSource->getPrimarySourceDataEntry(2, 0, dataEntry), "Appended entry could not be retrieved!");
+    QVERIFY2(dataEntry.firstWord == "fifthword" && dataEntry.secondWord == "sixthword" && dataEntry.areSynonyms, "Incorrect appended entry retrieved!");
+    QVERIFY2(!pDataSource->getPrimarySourceDataEntry(3, 0, dataEntry), "Entry retrieved although the entry number is out of range!");
+    QVERIFY2(!pDataSource->getPrimarySourceDataEntry(0, 1, dataEntry), "Entry retrieved for a language that is not loaded!");
+
+    pDataSource->updateDataEntries({{"seventhword", "eighthword", false}}, 1, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+    pDataSource->updateDataEntries({}, 0, DataSource::UpdateOperation::SET_AS_PRIMARY);
+
+    QVERIFY2(pDataSource->getPrimarySourceDataEntry(0, 0, dataEntry), "Entry could not be retrieved after swapping sources!");
+    QVERIFY2(dataEntry.firstWord == "firstword" && dataEntry.secondWord == "secondword" && dataEntry.areSynonyms, "Incorrect entry retrieved after swapping sources!");
+    QVERIFY2(pDataSource->getSecondarySourceNrOfEntries() == 1, "Incorrect number of secondary source entries after swapping sources!");
+}
+
+void DataAccessTests::testDataSourceAppendEntries()
+{
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+    DataSource::DataEntry dataEntry;
+    int nrOfEntries{0};
+    bool areEntriesCorrect{true};
+
+    pDataSource->updateDataEntries({{"firstword", "secondword", true}}, 0, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+    ++nrOfEntries;
+
+    // chunks of different sizes so the appended chunks get merged with the previous ones in various combinations
+    for (int chunkSize : {1, 1, 3, 2, 7, 1, 16, 4, 4, 1})
+    {
+        QVector<DataSource::DataEntry> dataEntries;
+
+        for (int chunkEntry{0}; chunkEntry < chunkSize; ++chunkEntry)
+        {
+            dataEntries.append({QString{"firstword%1"}.arg(nrOfEntries), QString{"secondword%1"}.arg(nrOfEntries), nrOfEntries % 2 == 0});
+            ++nrOfEntries;
+        }
+
+        pDataSource->updateDataEntries(dataEntries, 0, DataSource::UpdateOperation::APPEND);
+    }
+
+    QVERIFY2(pDataSource->getPrimarySourceNrOfEntries() == nrOfEntries, "Incorrect number of entries after appending!");
+
+    for (int entryNumber{1}; entryNumber < nrOfEntries; ++entryNumber)
+    {
+        areEntriesCorrect = areEntriesCorrect &&
+                            pDataSource->getPrimarySourceDataEntry(entryNumber, 0, dataEntry) &&
+                            dataEntry.firstWord == QString{"firstword%1"}.arg(entryNumber) &&
+                            dataEntry.secondWord == QString{"secondword%1"}.arg(entryNumber) &&
+                            dataEntry.areSynonyms == (entryNumber % 2 == 0) &&
+                            pDataSource->entryAlreadyExists({dataEntry.secondWord, dataEntry.firstWord, true}, 0);
+    }
+
+    QVERIFY2(areEntriesCorrect, "Appended entries not retrieved in the right order or not found!");
+    QVERIFY2(pDataSource->getPrimarySourceDataEntry(0, 0, dataEntry) && dataEntry.firstWord == "firstword", "Initially loaded entry not retrieved after appending!");
+}
+
+void DataAccessTests::testDataSourceResidentLanguages()
+{
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+
+    pDataSource->setResidencyLimits(3, 1024 * 1024);
+
+    pDataSource->updateDataEntries({{"firstword", "secondword", true}}, 0, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+    pDataSource->updateDataEntries({{"thirdword", "fourthword", true}}, 1, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+    pDataSource->updateDataEntries({{"fifthword", "sixthword", true}}, 2, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+
+    QVERIFY2(pDataSource->getResidentLanguageIndexes() == (QVector<int>{2, 1, 0}), "Incorrect resident languages!");
+    QVERIFY2(pDataSource->getPrimarySourceLanguageIndex() == 2 && pDataSource->getSecondarySourceLanguageIndex() == 1, "Incorrect primary/secondary languages!");
+    QVERIFY2(pDataSource->entryAlreadyExists({"secondword", "firstword", true}, 0), "Entry not found in resident language that is neither primary nor secondary!");
+
+    QVERIFY2(pDataSource->updateDataEntries({}, 0, DataSource::UpdateOperation::SET_AS_PRIMARY), "Resident language could not be set as primary!");
+    QVERIFY2(pDataSource->getResidentLanguageIndexes() == (QVector<int>{0, 2, 1}), "Resident languages not reordered after being used!");
+    QVERIFY2(pDataSource->getPrimarySourceLanguageIndex() == 0 && pDataSource->getSecondarySourceLanguageIndex() == 2, "Incorrect primary/secondary languages after setting primary!");
+
+    // least recently used language gets evicted
+    pDataSource->updateDataEntries({{"seventhword", "eighthword", true}}, 3, DataSource::UpdateOperation::LOAD_TO_SECONDARY);
+
+    QVERIFY2(pDataSource->getResidentLanguageIndexes() == (QVector<int>{3, 0, 2}), "Least recently used language not evicted!");
+    QVERIFY2(!pDataSource->isLanguageResident(1) && !pDataSource->entryAlreadyExists({"thirdword", "fourthword", true}, 1), "Evicted language still available!");
+    QVERIFY2(!pDataSource->updateDataEntries({}, 1, DataSource::UpdateOperation::SET_AS_PRIMARY), "Evicted language set as primary!");
+    QVERIFY2(!pDataSource->updateDataEntries({{"ninthword", "tenthword", true}}, 1, DataSource::UpdateOperation::APPEND), "Entries appended to evicted language!");
+
+    // primary and secondary languages are never evicted, even when exceeding the memory budget
+    pDataSource->setResidencyLimits(2, 0);
+
+    QVERIFY2(pDataSource->getResidentLanguageIndexes() == (QVector<int>{3, 0}), "Primary and secondary languages should be kept when exceeding the limits!");
+    QVERIFY2(pDataSource->getNrOfEntries(0) == 1 && pDataSource->getNrOfEntries(3) == 1, "Incorrect number of entries for the kept languages!");
+}
+
+void DataAccessTests::testDataSourcePreloadedLanguages()
+{
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+
+    pDataSource->updateDataEntries({{"firstword", "secondword", true}}, 0, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+    pDataSource->updateDataEntries({{"thirdword", "fourthword", false}}, 1, DataSource::UpdateOperation::LOAD_AS_RESIDENT);
+    pDataSource->updateDataEntries({{"fifthword", "sixthword", true}}, 1, DataSource::UpdateOperation::APPEND);
+
+    QVERIFY2(pDataSource->isLanguageResident(1) && pDataSource->getNrOfEntries(1) == 2, "Incorrect content of the preloaded language!");
+    QVERIFY2(pDataSource->getPrimarySourceLanguageIndex() == 0 && pDataSource->getSecondarySourceLanguageIndex() == -1, "Preloading should not change the primary/secondary languages!");
+
+    QVERIFY2(!pDataSource->updateDataEntries({}, 0, DataSource::UpdateOperation::UNLOAD), "Primary language unloaded!");
+    QVERIFY2(pDataSource->updateDataEntries({}, 1, DataSource::UpdateOperation::UNLOAD), "Preloaded language could not be unloaded!");
+    QVERIFY2(!pDataSource->isLanguageResident(1) && pDataSource->getResidentLanguageIndexes() == (QVector<int>{0}), "Unloaded language still resident!");
+    QVERIFY2(!pDataSource->updateDataEntries({}, 1, DataSource::UpdateOperation::UNLOAD), "Language unloaded twice!");
+
+    // preloaded languages are the least recently used ones until actually used, so they never evict a used language
+    pDataSource->setResidencyLimits(3, 1024 * 1024);
+    pDataSource->updateDataEntries({{"seventhword", "eighthword", true}}, 2, DataSource::UpdateOperation::LOAD_TO_SECONDARY);
+    pDataSource->updateDataEntries({{"ninthword", "tenthword", true}}, 3, DataSource::UpdateOperation::LOAD_AS_RESIDENT);
+
+    QVERIFY2(pDataSource->getResidentLanguageIndexes() == (QVector<int>{2, 0, 3}), "The preloaded language should be the least recently used one!");
+
+    pDataSource->updateDataEntries({{"eleventhword", "twelfthword", true}}, 4, DataSource::UpdateOperation::LOAD_AS_RESIDENT);
+
+    QVERIFY2(pDataSource->getResidentLanguageIndexes() == (QVector<int>{2, 0, 3}), "A preloaded language should be evicted right away when there is no room for it!");
+
+    QVERIFY2(pDataSource->updateDataEntries({}, 3, DataSource::UpdateOperation::SET_AS_SECONDARY), "The preloaded language could not be used!");
+    QVERIFY2(pDataSource->getResidentLanguageIndexes() == (QVector<int>{3, 2, 0}), "The preloaded language should become the most recently used one once used!");
+}
+
+void DataAccessTests::testDataSourceResidencyPins()
+{
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+
+    pDataSource->setResidencyLimits(2, 1024 * 1024);
+    pDataSource->updateDataEntries({{"firstword", "secondword", true}}, 0, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+    pDataSource->updateDataEntries({{"thirdword", "fourthword", true}}, 1, DataSource::UpdateOperation::LOAD_AS_RESIDENT);
+
+    QVERIFY2(pDataSource->pinLanguage(1) && pDataSource->isLanguagePinned(1), "Resident language could not be pinned!");
+    QVERIFY2(!pDataSource->pinLanguage(2) && !pDataSource->isLanguagePinned(2), "Language which is not resident has been pinned!");
+
+    // the pinned language is the least recently used one, it is kept although the limits are exceeded
+    pDataSource->updateDataEntries({{"fifthword", "sixthword", true}}, 2, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+
+    QVERIFY2(pDataSource->getResidentLanguageIndexes() == (QVector<int>{2, 0, 1}), "Pinned language evicted!");
+    QVERIFY2(!pDataSource->updateDataEntries({}, 1, DataSource::UpdateOperation::UNLOAD), "Pinned language unloaded!");
+
+    pDataSource->updateDataEntries({{"seventhword", "eighthword", true}}, 3, DataSource::UpdateOperation::LOAD_AS_RESIDENT);
+
+    QVERIFY2(pDataSource->getResidentLanguageIndexes() == (QVector<int>{2, 0, 1}), "The preloaded language should be evicted instead of the pinned one!");
+
+    // pins are counted, the language is only released by the last unpin and gets evicted by the next update
+    QVERIFY2(pDataSource->pinLanguage(1), "Pinned language could not be pinned again!");
+
+    pDataSource->unpinLanguage(1);
+
+    QVERIFY2(pDataSource->isLanguagePinned(1), "Language released while still pinned once!");
+
+    pDataSource->unpinLanguage(1);
+
+    QVERIFY2(!pDataSource->isLanguagePinned(1) && pDataSource->isLanguageResident(1), "Language should be released but not evicted when unpinned!");
+
+    pDataSource->updateDataEntries({}, 0, DataSource::UpdateOperation::SET_AS_SECONDARY);
+
+    QVERIFY2(pDataSource->getResidentLanguageIndexes() == (QVector<int>{0, 2}), "Released language not evicted by the next update!");
+}
+
+void DataAccessTests::testDataSourceLoaderChunkedLoad()
+{
+    QTemporaryDir dataDir;
+    QVERIFY2(dataDir.isValid(), "The temporary data directory could not be created!");
+
+    const QString c_DatabasePath{dataDir.path() + "/" + Database::Query::c_DatabaseName};
+    QVERIFY2(_createDatabase(c_DatabasePath, 0, 12000), "The test database could not be created!");
+
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+    std::unique_ptr<DataSourceLoader> pDataSourceLoader{new DataSourceLoader{pDataSource.get(), c_DatabasePath}};
+    QSignalSpy loadFinishedSpy{pDataSourceLoader.get(), &DataSourceLoader::loadDataFromDbForPrimaryLanguageFinished};
+    QVector<int> receivedChunkSizes;
+    int nrOfEntriesWhenFirstChunkReady{0};
+    bool areChunksForwardedCorrectly{true};
+
+    // the chunks are received synchronously (loader slot called directly) so the data source content can be checked right when each of them gets announced
+    auto connected{connect(pDataSourceLoader.get(), &DataSourceLoader::loadDataFromDbForPrimaryLanguageFirstChunkReady, [&](int requestId, int languageIndex, int nrOfEntries)
+    {
+        areChunksForwardedCorrectly = areChunksForwardedCorrectly && requestId == 1 && languageIndex == 0 && receivedChunkSizes.isEmpty() && loadFinishedSpy.isEmpty();
+        nrOfEntriesWhenFirstChunkReady = pDataSource->getPrimarySourceNrOfEntries();
+        receivedChunkSizes.append(nrOfEntries);
+    })};
+    Q_ASSERT(connected);
+    connected = connect(pDataSourceLoader.get(), &DataSourceLoader::loadDataFromDbForPrimaryLanguageChunkReady, [&](int requestId, int languageIndex, int nrOfEntries)
+    {
+        areChunksForwardedCorrectly = areChunksForwardedCorrectly && requestId == 1 && languageIndex == 0 && !receivedChunkSizes.isEmpty() && loadFinishedSpy.isEmpty();
+        receivedChunkSizes.append(nrOfEntries);
+    });
+    Q_ASSERT(connected);
+
+    pDataSourceLoader->onLoadDataFromDbForPrimaryLanguageRequested(1, 0, false);
+
+    QVERIFY2(areChunksForwardedCorrectly, "The chunks are not announced in the right order or with the right request ID/language!");
+    QVERIFY2(nrOfEntriesWhenFirstChunkReady == 5000, "The first chunk should be available before the remaining ones are loaded!");
+    QVERIFY2(receivedChunkSizes == (QVector<int>{5000, 5000, 2000}), "Incorrect chunk sizes!");
+    QVERIFY2(loadFinishedSpy.count() == 1, "The load should be acknowledged exactly once!");
+    QVERIFY2(loadFinishedSpy.at(0).at(0).toInt() == 1 && loadFinishedSpy.at(0).at(1).toBool() && loadFinishedSpy.at(0).at(2).toBool(), "Incorrect load finished notification!");
+    QVERIFY2(pDataSource->getPrimarySourceNrOfEntries() == 12000, "Incorrect number of loaded entries!");
+
+    DataSource::DataEntry dataEntry;
+    bool areEntriesInReadOrder{true};
+
+    for (int entryNumber : {0, 4999, 5000, 9999, 10000, 11999})
+    {
+        areEntriesInReadOrder = areEntriesInReadOrder &&
+                                pDataSource->getPrimarySourceDataEntry(entryNumber, 0, dataEntry) &&
+                                dataEntry.firstWord == _createWord("first", entryNumber) &&
+                                dataEntry.secondWord == _createWord("second", entryNumber);
+    }
+
+    QVERIFY2(areEntriesInReadOrder, "The chunks have not been appended in the order they were read!");
+}
+
+void DataAccessTests::testDataSourceLoaderInvalidRequest()
+{
+    QTemporaryDir dataDir;
+    QVERIFY2(dataDir.isValid(), "The temporary data directory could not be created!");
+
+    const QString c_DatabasePath{dataDir.path() + "/" + Database::Query::c_DatabaseName};
+    QVERIFY2(_createDatabase(c_DatabasePath, 0, 10), "The test database could not be created!");
+
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+    std::unique_ptr<DataSourceLoader> pDataSourceLoader{new DataSourceLoader{pDataSource.get(), c_DatabasePath}};
+    QSignalSpy loadFinishedSpy{pDataSourceLoader.get(), &DataSourceLoader::loadDataFromDbForPrimaryLanguageFinished};
+    QSignalSpy alreadyContainedSpy{pDataSourceLoader.get(), &DataSourceLoader::requestedPrimaryLanguageAlreadyContainedInDataSource};
+
+    // invalid requests are acknowledged as failed so the requester doesn't wait for them
+    pDataSourceLoader->onLoadDataFromDbForPrimaryLanguageRequested(1, -1, false);
+    pDataSourceLoader->onLoadDataFromDbForPrimaryLanguageRequested(2, Database::Query::c_LanguageCodes.size(), false);
+
+    QVERIFY2(loadFinishedSpy.count() == 2, "Invalid requests have not been acknowledged!");
+    QVERIFY2(loadFinishedSpy.at(0).at(0).toInt() == 1 && !loadFinishedSpy.at(0).at(1).toBool() && loadFinishedSpy.at(1).at(0).toInt() == 2 && !loadFinishedSpy.at(1).at(1).toBool(),
+             "Invalid requests should be acknowledged as failed!");
+    QVERIFY2(pDataSource->getPrimarySourceLanguageIndex() == -1, "The data source should not be changed by invalid requests!");
+
+    pDataSourceLoader->onLoadDataFromDbForPrimaryLanguageRequested(3, 0, false);
+    pDataSourceLoader->onLoadDataFromDbForPrimaryLanguageRequested(4, 0, false);
+
+    QVERIFY2(loadFinishedSpy.count() == 3 && loadFinishedSpy.at(2).at(0).toInt() == 3 && loadFinishedSpy.at(2).at(1).toBool(), "The valid request has not been acknowledged!");
+    QVERIFY2(alreadyContainedSpy.count() == 1 && alreadyContainedSpy.at(0).at(0).toInt() == 4 && alreadyContainedSpy.at(0).at(1).toBool(),
+             "The request for the primary language should be acknowledged without reloading it!");
+}
+
+void DataAccessTests::testDataSourceLoaderRejectedEntries()
+{
+    QTemporaryDir dataDir;
+    QVERIFY2(dataDir.isValid(), "The temporary data directory could not be created!");
+
+    // the first 3 invalid entries are discarded by the load query, the last one by the loader
+    const QVector<DataSource::DataEntry> c_DataEntries{{"validfirstword", "validsecondword", true},
+                                                       {"short", "words", true},
+                                                       {"averyveryverylongword", "anotherlongword", false},
+                                                       {"Uppercaseword", "anotherword", true},
+                                                       {"digit1word", "anotherword", false}};
+
+    const QString c_DatabasePath{dataDir.path() + "/" + Database::Query::c_DatabaseName};
+    QVERIFY2(_createDatabase(c_DatabasePath, 0, c_DataEntries), "The test database could not be created!");
+
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+    std::unique_ptr<DataSourceLoader> pDataSourceLoader{new DataSourceLoader{pDataSource.get(), c_DatabasePath}};
+
+    // the registry is shared by all loaders so only the increments caused by this load are checked
+    auto getRejectedRowsCounterValue = [](const QString& rejectionReason)
+    {
+        return MetricsRegistry::getRegistry()->getCounter("synant_database_rows_rejected_total", QString{}, "reason=\"" + rejectionReason + "\"")->getValue();
+    };
+
+    // same labels as used for the words pairs rejected when entered by user
+    const QVector<QString> c_RejectionReasons{"less_min_chars_per_word", "less_min_total_pair_chars", "more_max_total_pair_chars", "invalid_characters", "pair_already_exists", "identical_words"};
+    const QVector<int> c_ExpectedNrOfRejectedEntries{0, 1, 1, 2, 0, 0};
+    QVector<quint64> initialCounterValues;
+
+    for (const auto& rejectionReason : c_RejectionReasons)
+    {
+        initialCounterValues.append(getRejectedRowsCounterValue(rejectionReason));
+    }
+
+    pDataSourceLoader->onLoadDataFromDbForPrimaryLanguageRequested(1, 0, false);
+
+    QVERIFY2(pDataSource->getPrimarySourceNrOfEntries() == 1, "Only the valid entry should be loaded!");
+
+    for (int rejectionCode{0}; rejectionCode < c_RejectionReasons.size(); ++rejectionCode)
+    {
+        QVERIFY2(pDataSourceLoader->getNrOfRejectedEntries(static_cast<DataEntryValidator::ValidationCodes>(rejectionCode)) == c_ExpectedNrOfRejectedEntries.at(rejectionCode),
+                 qPrintable("Incorrect number of rejected entries: " + c_RejectionReasons.at(rejectionCode)));
+        QVERIFY2(getRejectedRowsCounterValue(c_RejectionReasons.at(rejectionCode)) - initialCounterValues.at(rejectionCode) == static_cast<quint64>(c_ExpectedNrOfRejectedEntries.at(rejectionCode)),
+                 qPrintable("Incorrect rejected rows counter increment: " + c_RejectionReasons.at(rejectionCode)));
+    }
+}
+
+void DataAccessTests::testDataSourceLoaderQueryFilteringMatchesValidationRules()
+{
+    QTemporaryDir dataDir;
+    QVERIFY2(dataDir.isValid(), "The temporary data directory could not be created!");
+
+    // each kind of invalid entry, alone and combined with other invalid criteria, and the size limits (min word size: 5, pair size: 15 - 30)
+    const QVector<DataSource::DataEntry> c_DataEntries{{"validfirstword", "validsecondword", true},
+                                                       {"exactminimum", "pair", true},                                // word too short (4 letters)
+                                                       {"fifteenchars", "abc", false},                                // pair 15, word too short
+                                                       {"tenletters", "fiveo", true},                                 // pair 15, valid
+                                                       {"fourteenletter", "abcdefghijklmnop", false},                 // pair 30, valid
+                                                       {"fourteenletter", "abcdefghijklmnopq", false},                // pair too long (31)
+                                                       {"ninechars", "fiveo", true},                                  // pair too short (14)
+                                                       {"short", "words", true},                                      // pair too short
+                                                       {"", "emptyfirstword", false},                                 // pair too short
+                                                       {"Short", "Words", true},                                      // pair too short, uppercase
+                                                       {"averyveryverylongword", "anotherlongword", false},           // pair too long
+                                                       {"AVERYVERYVERYLONGWORD", "anotherlongword", false},           // pair too long, uppercase
+                                                       {"Uppercaseword", "anotherword", true},                        // uppercase
+                                                       {"lowercaseword", "anotherWord", true},                        // uppercase (second word)
+                                                       {"Identicalword", "Identicalword", true},                      // uppercase, identical
+                                                       {"Abc", "anotherlongword", true},                              // uppercase, word too short
+                                                       {"digit1word", "anotherword", false},                          // digit
+                                                       {"two words", "anotherword", false},                           // space
+                                                       {"hyphen-word", "anotherword", true},                          // hyphen
+                                                       {"ab1", "anotherlongword", true},                              // digit, word too short
+                                                       {"identicalword", "identicalword", true},                      // identical
+                                                       {"identical1word", "identical1word", false},                   // digit, identical
+                                                       {QString::fromUtf8("übungsaufgabe"), "anotherword", true},     // non-ASCII lowercase, valid
+                                                       {QString::fromUtf8("Übungsaufgabe"), "anotherword", true},     // non-ASCII uppercase (not filtered by query)
+                                                       {"othervalidword", "secondvalidword", false}};
+
+    const QString c_DatabasePath{dataDir.path() + "/" + Database::Query::c_DatabaseName};
+    QVERIFY2(_createDatabase(c_DatabasePath, 0, c_DataEntries), "The test database could not be created!");
+
+    QVector<DataSource::DataEntry> expectedValidEntries;
+    QVector<int> expectedNrOfRejectedEntries(static_cast<int>(DataEntryValidator::ValidationCodes::InvalidCodesCount), 0);
+
+    for (const auto& dataEntry : c_DataEntries)
+    {
+        const DataEntryValidator::ValidationCodes c_ValidationCode{_getExpectedValidationCode(dataEntry)};
+
+        if (c_ValidationCode == DataEntryValidator::ValidationCodes::VALID_PAIR)
+        {
+            expectedValidEntries.append(dataEntry);
+        }
+        else
+        {
+            ++expectedNrOfRejectedEntries[static_cast<int>(c_ValidationCode)];
+        }
+    }
+
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+    std::unique_ptr<DataSourceLoader> pDataSourceLoader{new DataSourceLoader{pDataSource.get(), c_DatabasePath}};
+
+    pDataSourceLoader->onLoadDataFromDbForPrimaryLanguageRequested(1, 0, false);
+
+    QVector<DataSource::DataEntry> loadedEntries;
+    DataSource::DataEntry dataEntry;
+
+    for (int entryNumber{0}; entryNumber < pDataSource->getPrimarySourceNrOfEntries(); ++entryNumber)
+    {
+        QVERIFY2(pDataSource->getPrimarySourceDataEntry(entryNumber, 0, dataEntry), "A loaded entry cannot be retrieved!");
+        loadedEntries.append(dataEntry);
+    }
+
+    QVERIFY2(loadedEntries == expectedValidEntries, "The loaded entries are not the ones accepted by the validation rules!");
+
+    for (int rejectionCode{0}; rejectionCode < expectedNrOfRejectedEntries.size(); ++rejectionCode)
+    {
+        QVERIFY2(pDataSourceLoader->getNrOfRejectedEntries(static_cast<DataEntryValidator::ValidationCodes>(rejectionCode)) == expectedNrOfRejectedEntries.at(rejectionCode),
+                 qPrintable(QString{"Incorrect number of rejected entries for rejection code %1!"}.arg(rejectionCode)));
+    }
+}
+
+void DataAccessTests::testDataSourceLoaderSnapshot()
+{
+    QTemporaryDir dataDir;
+    QVERIFY2(dataDir.isValid(), "The temporary data directory could not be created!");
+
+    const QString c_DatabasePath{dataDir.path() + "/" + Database::Query::c_DatabaseName};
+    const QString c_SnapshotPath{DataSourceSnapshot::getFilePath(c_DatabasePath, 0)};
+    QVERIFY2(_createDatabase(c_DatabasePath, 0, 7000), "The test database could not be created!");
+
+    MetricsRegistry::Counter* const c_pDatabaseLoadsCounter{MetricsRegistry::getRegistry()->getCounter("synant_language_loads_total", QString{}, "source=\"database\"")};
+    MetricsRegistry::Counter* const c_pSnapshotLoadsCounter{MetricsRegistry::getRegistry()->getCounter("synant_language_loads_total", QString{}, "source=\"snapshot\"")};
+
+    // each load uses a new data source (otherwise the language is already contained), returns the second word of the given entry (empty if the load failed)
+    auto loadLanguage = [&c_DatabasePath](int entryNumber)
+    {
+        std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+        std::unique_ptr<DataSourceLoader> pDataSourceLoader{new DataSourceLoader{pDataSource.get(), c_DatabasePath}};
+        DataSource::DataEntry dataEntry;
+
+        pDataSourceLoader->onLoadDataFromDbForPrimaryLanguageRequested(1, 0, false);
+
+        return pDataSource->getPrimarySourceNrOfEntries() == 7000 && pDataSource->getPrimarySourceDataEntry(entryNumber, 0, dataEntry) ? dataEntry.secondWord : QString{};
+    };
+
+    // the database is switched to write-ahead logging by a connection which stays open so its writes are not merged into the database file
+    const QString c_ConnectionName{"DataAccessTestsWalConnection"};
+
+    {
+        QSqlDatabase db{QSqlDatabase::addDatabase(Database::Query::c_DbDriverName, c_ConnectionName)};
+        db.setDatabaseName(c_DatabasePath);
+
+        QVERIFY2(db.open() && QSqlQuery{db}.exec(Database::Query::c_SetJournalModePragma.arg(Database::Connection::c_WalJournalMode)), "Write-ahead logging could not be enabled!");
+
+        quint64 nrOfDatabaseLoads{c_pDatabaseLoadsCounter->getValue()};
+        quint64 nrOfSnapshotLoads{c_pSnapshotLoadsCounter->getValue()};
+
+        QVERIFY2(loadLanguage(6000) == _createWord("second", 6000), "Incorrect entries loaded from database!");
+        QVERIFY2(c_pDatabaseLoadsCounter->getValue() == ++nrOfDatabaseLoads && QFile::exists(c_SnapshotPath), "The snapshot has not been created by loading from database!");
+
+        QVERIFY2(loadLanguage(6000) == _createWord("second", 6000), "Incorrect entries loaded from snapshot!");
+        QVERIFY2(c_pSnapshotLoadsCounter->getValue() == ++nrOfSnapshotLoads, "The snapshot has not been used!");
+
+        // neither the number of rows nor the highest row ID change, the update is only contained in the log
+        QVERIFY2(QSqlQuery{db}.exec("UPDATE GameDataTable SET secondWord = 'updatedword' WHERE rowId = 6001"), "The entry could not be updated!");
+
+        QVERIFY2(loadLanguage(6000) == "updatedword", "The outdated snapshot has been used after updating an entry!");
+        QVERIFY2(c_pDatabaseLoadsCounter->getValue() == ++nrOfDatabaseLoads, "The language has not been reloaded from database!");
+
+        // a damaged section (last one) is only detected when reading it, the entries already pushed cannot be replaced so the load fails and the snapshot is removed
+        QFile snapshotFile{c_SnapshotPath};
+        QVERIFY2(snapshotFile.open(QIODevice::ReadWrite) && snapshotFile.seek(snapshotFile.size() - 1) && snapshotFile.putChar('#'), "The snapshot could not be damaged!");
+        snapshotFile.close();
+
+        QVERIFY2(loadLanguage(6000).isEmpty(), "The load should fail when a section of the snapshot is damaged!");
+        QVERIFY2(!QFile::exists(c_SnapshotPath), "The damaged snapshot has not been removed!");
+
+        QVERIFY2(loadLanguage(6000) == "updatedword", "Incorrect entries loaded from database after removing the damaged snapshot!");
+        QVERIFY2(c_pDatabaseLoadsCounter->getValue() == ++nrOfDatabaseLoads && QFile::exists(c_SnapshotPath), "The snapshot has not been recreated!");
+
+        // a damaged first section is replaced by reading the database as nothing has been pushed yet
+        QVERIFY2(snapshotFile.open(QIODevice::ReadWrite) && snapshotFile.seek(56 + 16) && snapshotFile.putChar('#'), "The snapshot could not be damaged!");
+        snapshotFile.close();
+
+        QVERIFY2(loadLanguage(6000) == "updatedword", "The language has not been loaded from database when the first snapshot section is damaged!");
+        QVERIFY2(c_pDatabaseLoadsCounter->getValue() == ++nrOfDatabaseLoads, "The language has not been reloaded from database!");
+
+        QVERIFY2(loadLanguage(6000) == "updatedword", "Incorrect entries loaded from the recreated snapshot!");
+        QVERIFY2(c_pSnapshotLoadsCounter->getValue() == ++nrOfSnapshotLoads, "The recreated snapshot has not been used!");
+
+        db.close();
+    }
+
+    QSqlDatabase::removeDatabase(c_ConnectionName);
+}
+
+DataEntryValidator::ValidationCodes DataAccessTests::_getExpectedValidationCode(const DataSource::DataEntry& dataEntry)
+{
+    auto containsOnlyLowercaseCharacters = [](const QString& word)
+    {
+        return std::all_of(word.cbegin(), word.cend(), [](const QChar& character) {return character.isLower();});
+    };
+
+    DataEntryValidator::ValidationCodes validationCode{DataEntryValidator::ValidationCodes::VALID_PAIR};
+    const int c_TotalPairSize{static_cast<int>(dataEntry.firstWord.size() + dataEntry.secondWord.size())};
+
+    if (c_TotalPairSize < Game::Constraints::c_MinPairSize)
+    {
+        validationCode = DataEntryValidator::ValidationCodes::LESS_MIN_TOTAL_PAIR_CHARS;
+    }
+    else if (c_TotalPairSize > Game::Constraints::c_MaxPairSize)
+    {
+        validationCode = DataEntryValidator::ValidationCodes::MORE_MAX_TOTAL_PAIR_CHARS;
+    }
+    else if (!containsOnlyLowercaseCharacters(dataEntry.firstWord) || !containsOnlyLowercaseCharacters(dataEntry.secondWord))
+    {
+        validationCode = DataEntryValidator::ValidationCodes::INVALID_CHARACTERS;
+    }
+    else if (dataEntry.firstWord.size() < Game::Constraints::c_MinWordSize || dataEntry.secondWord.size() < Game::Constraints::c_MinWordSize)
+    {
+        validationCode = DataEntryValidator::ValidationCodes::LESS_MIN_CHARS_PER_WORD;
+    }
+    else if (dataEntry.firstWord == dataEntry.secondWord)
+    {
+        validationCode = DataEntryValidator::ValidationCodes::IDENTICAL_WORDS;
+    }
+
+    return validationCode;
+}
+
+bool DataAccessTests::_createDatabase(const QString& databasePath, int languageIndex, int nrOfEntries)
+{
+    QVector<DataSource::DataEntry> dataEntries;
+
+    for (int entryNumber{0}; entryNumber < nrOfEntries; ++entryNumber)
+    {
+        dataEntries.append(DataSource::DataEntry{_createWord("first", entryNumber), _createWord("second", entryNumber), entryNumber % 2 == 1});
+    }
+
+    return _createDatabase(databasePath, languageIndex, dataEntries);
+}
+
+bool DataAccessTests::_createDatabase(const QString& databasePath, int languageIndex, const QVector<DataSource::DataEntry>& dataEntries)
+{
+    const QString c_ConnectionName{"DataAccessTestsConnection"};
+    bool success{false};
+
+    {
+        QSqlDatabase db{QSqlDatabase::addDatabase(Database::Query::c_DbDriverName, c_ConnectionName)};
+        db.setDatabaseName(databasePath);
+
+        if (db.open())
+        {
+            QSqlQuery query{db};
+
+            success = query.exec(Database::Query::c_CreateTableQuery) && db.transaction();
+
+            if (success)
+            {
+                success = query.prepare("INSERT INTO GameDataTable(firstWord, secondWord, areSynonyms, language) VALUES(?, ?, ?, ?)");
+
+                for (int entryIndex{0}; success && entryIndex < dataEntries.size(); ++entryIndex)
+                {
+                    query.addBindValue(dataEntries.at(entryIndex).firstWord);
+                    query.addBindValue(dataEntries.at(entryIndex).secondWord);
+                    query.addBindValue(static_cast<int>(dataEntries.at(entryIndex).areSynonyms));
+                    query.addBindValue(Database::Query::c_LanguageCodes.at(languageIndex));
+
+                    success = query.exec();
+                }
+
+                success = db.commit() && success;
+            }
+
+            db.close();
+        }
+    }
+
+    QSqlDatabase::removeDatabase(c_ConnectionName);
+
+    return success;
+}
+
+QString DataAccessTests::_createWord(const QString& prefix, int wordNumber)
+{
+    QString word{prefix};
+
+    // lowercase letters only (digits are rejected by loader), each number getting its own suffix
+    for (int letterIndex{0}; letterIndex < 4; ++letterIndex)
+    {
+        word.append(QChar{'a' + wordNumber % 26});
+        wordNumber /= 26;
+    }
+
+    return word;
+}
+
+QTEST_GUILESS_MAIN(DataAccessTests)
 
 #include "tst_dataaccesstests.moc"
@@ -19,6 +19,7 @@ private slots:
     void testEnteredWordsAreInvalid();
     void testEnteredWordsAreValid();
     void testAddingWordPairsToCache();
+    void testCacheRequestsAcknowledged();
 };
 
 DataEntryTests::DataEntryTests()
@@ -132,7 +133,26 @@ void DataEntryTests::testAddingWordPairsToCache()
     pDataEntryCache->onValidEntryReceived(DataSource::DataEntry{"langwordfour", "langwordthree", true}, 3);
     QVERIFY2(pDataEntryCache->getNrOfCachedEntries() == 7, "The data entry cache has not been correctly updated!");
 
-    pDataEntryCache->onResetCacheRequested();
+    pDataEntryCache->onResetCacheRequested(1);
+    QVERIFY2(pDataEntryCache->getNrOfCachedEntries() == 0, "The data entry cache has not been correctly reset!");
+}
+
+void DataEntryTests::testCacheRequestsAcknowledged()
+{
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+    std::unique_ptr<DataEntryCache> pDataEntryCache{new DataEntryCache{pDataSource.get(), ""}};
+
+    QSignalSpy cacheResetSpy{pDataEntryCache.get(), &DataEntryCache::cacheReset};
+
+    pDataEntryCache->onValidEntryReceived(DataSource::DataEntry{"languagewordone", "languagewordtwo", true}, 0);
+    pDataEntryCache->onResetCacheRequested(1);
+    pDataEntryCache->onValidEntryReceived(DataSource::DataEntry{"langwordthree", "langwordfour", true}, 1);
+    pDataEntryCache->onResetCacheRequested(2);
+
+    // the acknowledgements should be issued right away (no delay) and in the order the requests have been received
+    QVERIFY2(cacheResetSpy.count() == 2, "The cache reset requests have not been acknowledged!");
+    QVERIFY2(cacheResetSpy.at(0).at(0).toInt() == 1, "Incorrect request ID for the first cache reset acknowledgement!");
+    QVERIFY2(cacheResetSpy.at(1).at(0).toInt() == 2, "Incorrect request ID for the second cache reset acknowledgement!");
     QVERIFY2(pDataEntryCache->getNrOfCachedEntries() == 0, "The data entry cache has not been correctly reset!");
 }
 
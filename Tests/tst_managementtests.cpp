@@ -0,0 +1,556 @@
+#include <QtTest>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QTemporaryDir>
+#include <QThread>
+#include <QMutex>
+
+#include <memory>
+
+#include "gamemanager.h"
+#include "gamefacade.h"
+#include "dataentryfacade.h"
+#include "datasourceaccesshelper.h"
+#include "datasource.h"
+#include "gamesession.h"
+#include "gamesessionpool.h"
+#include "gamesessionshard.h"
+#include "databaseutils.h"
+
+class ManagementTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    ManagementTests();
+
+private slots:
+    void cleanup();
+
+    void testGameFacadeStreamedLanguageLoad();
+    void testGameFacadeStreamedLanguageLoadFailure();
+    void testGameFacadeLanguageRequestsStatusOrder();
+    void testGameFacadeResidentLanguageSwitch();
+    void testDataEntryFacadeSaveRequestsStatusOrder();
+    void testDataEntryFacadeSavingError();
+    void testGameSessionPoolSessionRouting();
+    void testGameSessionPoolCrossThreadTasks();
+    void testGameSessionPoolShutdown();
+
+private:
+    // the entries of each language are added in the order of the language indexes
+    bool _setEnvironment(const QVector<int>& nrOfEntriesPerLanguage);
+    bool _createDatabase(const QString& databasePath, const QVector<int>& nrOfEntriesPerLanguage);
+    QString _createWord(const QString& prefix, int wordNumber);
+    std::unique_ptr<DataSource> _createDataSource(int nrOfLanguages);
+
+    // the manager (singleton) is created for each test within its own data directory and released afterwards
+    std::unique_ptr<QTemporaryDir> m_pDataDir;
+};
+
+ManagementTests::ManagementTests()
+{
+}
+
+void ManagementTests::cleanup()
+{
+    if (m_pDataDir)
+    {
+        GameManager::getManager()->releaseResources();
+        m_pDataDir.reset();
+    }
+}
+
+void ManagementTests::testGameFacadeStreamedLanguageLoad()
+{
+    QVERIFY2(_setEnvironment({12000}), "The game environment could not be set!");
+
+    GameManager* pGameManager{GameManager::getManager()};
+    GameFacade* pGameFacade{pGameManager->getGameFacade()};
+    DataSourceAccessHelper* pDataSourceAccessHelper{pGameManager->getDataSourceAccessHelper()};
+    QSignalSpy loadFinishedSpy{pGameManager, &GameManager::fetchDataForPrimaryLanguageFinished};
+    QVector<GameFacade::StatusCodes> statusCodes;
+    QVector<int> receivedChunkSizes;
+    bool isDataAvailableWhenFirstChunkReady{false};
+    int nrOfEntriesWhenFirstChunkReady{0};
+    bool areChunksReceivedInOrder{true};
+
+    pGameFacade->init();
+
+    // the facade is connected first, so it already handled each notification when these ones get executed
+    auto connected{connect(pGameFacade, &GameFacade::statusChanged, [&]() {statusCodes.append(pGameFacade->getStatusCode());})};
+    Q_ASSERT(connected);
+    connected = connect(pGameManager, &GameManager::fetchDataForPrimaryLanguageFirstChunkReady, [&](int languageIndex, int nrOfEntries)
+    {
+        areChunksReceivedInOrder = areChunksReceivedInOrder && languageIndex == 0 && receivedChunkSizes.isEmpty() && loadFinishedSpy.isEmpty();
+        isDataAvailableWhenFirstChunkReady = pGameFacade->isDataAvailable() && !pGameFacade->isDataFetchingInProgress();
+        nrOfEntriesWhenFirstChunkReady = pDataSourceAccessHelper->getTotalNrOfEntries();
+        receivedChunkSizes.append(nrOfEntries);
+    });
+    Q_ASSERT(connected);
+    connected = connect(pGameManager, &GameManager::fetchDataForPrimaryLanguageChunkReady, [&](int languageIndex, int nrOfEntries)
+    {
+        areChunksReceivedInOrder = areChunksReceivedInOrder && languageIndex == 0 && !receivedChunkSizes.isEmpty() && loadFinishedSpy.isEmpty();
+        receivedChunkSizes.append(nrOfEntries);
+    });
+    Q_ASSERT(connected);
+
+    pGameFacade->setLanguage(0, false);
+
+    QTRY_VERIFY2(loadFinishedSpy.count() == 1, "The language load has not been completed!");
+    QVERIFY2(loadFinishedSpy.at(0).at(0).toBool() && loadFinishedSpy.at(0).at(1).toBool(), "The language load should succeed!");
+    QVERIFY2(areChunksReceivedInOrder, "The chunks are not received in the right order!");
+    QVERIFY2(receivedChunkSizes == (QVector<int>{5000, 5000, 2000}), "Incorrect chunk sizes!");
+    QVERIFY2(isDataAvailableWhenFirstChunkReady && nrOfEntriesWhenFirstChunkReady == 5000, "The game should start using the first chunk before the load is complete!");
+    QVERIFY2(pDataSourceAccessHelper->getTotalNrOfEntries() == 12000, "The remaining chunks have not been added to the entries table!");
+    QVERIFY2(statusCodes == (QVector<GameFacade::StatusCodes>{GameFacade::StatusCodes::FETCHING_DATA, GameFacade::StatusCodes::DATA_FETCHING_COMPLETE}),
+             "Incorrect status codes sequence!");
+}
+
+void ManagementTests::testGameFacadeStreamedLanguageLoadFailure()
+{
+    QVERIFY2(_setEnvironment({12000}), "The game environment could not be set!");
+
+    GameManager* pGameManager{GameManager::getManager()};
+    GameFacade* pGameFacade{pGameManager->getGameFacade()};
+    QSignalSpy loadFinishedSpy{pGameManager, &GameManager::fetchDataForPrimaryLanguageFinished};
+    QVector<GameFacade::StatusCodes> statusCodes;
+
+    pGameFacade->init();
+    pGameFacade->setLanguage(0, false);
+
+    QTRY_VERIFY2(loadFinishedSpy.count() == 1 && pGameFacade->isDataAvailable(), "The language load has not been completed!");
+
+    auto connected{connect(pGameFacade, &GameFacade::statusChanged, [&]() {statusCodes.append(pGameFacade->getStatusCode());})};
+    Q_ASSERT(connected);
+
+    // stream failing after the first chunk has been used (e.g. database error when reading the remaining entries)
+    Q_EMIT pGameManager->fetchDataForPrimaryLanguageFirstChunkReady(0, 5000);
+
+    QVERIFY2(pGameFacade->isDataAvailable(), "The first chunk should be used as soon as it is received!");
+
+    Q_EMIT pGameManager->fetchDataForPrimaryLanguageFinished(false, false);
+
+    QVERIFY2(!pGameFacade->isDataAvailable(), "The incompletely loaded language should no longer be used!");
+    QVERIFY2(statusCodes == (QVector<GameFacade::StatusCodes>{GameFacade::StatusCodes::DATA_FETCHING_COMPLETE, GameFacade::StatusCodes::DATA_FETCHING_ERROR}),
+             "The stream failure has not been reported!");
+
+    // the streaming state has been reset, a new stream is handled normally
+    Q_EMIT pGameManager->fetchDataForPrimaryLanguageFirstChunkReady(0, 5000);
+    Q_EMIT pGameManager->fetchDataForPrimaryLanguageFinished(true, true);
+
+    QVERIFY2(pGameFacade->isDataAvailable() && statusCodes.size() == 3 && statusCodes.last() == GameFacade::StatusCodes::DATA_FETCHING_COMPLETE,
+             "Incorrect status after receiving a new stream!");
+}
+
+void ManagementTests::testGameFacadeLanguageRequestsStatusOrder()
+{
+    QVERIFY2(_setEnvironment({100, 200}), "The game environment could not be set!");
+
+    GameManager* pGameManager{GameManager::getManager()};
+    GameFacade* pGameFacade{pGameManager->getGameFacade()};
+    QSignalSpy loadFinishedSpy{pGameManager, &GameManager::fetchDataForPrimaryLanguageFinished};
+    QVector<GameFacade::StatusCodes> statusCodes;
+
+    pGameFacade->init();
+
+    auto connected{connect(pGameFacade, &GameFacade::statusChanged, [&]() {statusCodes.append(pGameFacade->getStatusCode());})};
+    Q_ASSERT(connected);
+
+    pGameFacade->setLanguage(0, false);
+
+    QTRY_VERIFY2(loadFinishedSpy.count() == 1, "The language load has not been completed!");
+    QVERIFY2(statusCodes == (QVector<GameFacade::StatusCodes>{GameFacade::StatusCodes::FETCHING_DATA, GameFacade::StatusCodes::DATA_FETCHING_COMPLETE}),
+             "Incorrect status codes sequence for a single request!");
+
+    statusCodes.clear();
+    loadFinishedSpy.clear();
+
+    // requests issued faster than the loader handles them: the obsolete ones are handled by loader in order but only the last one is acknowledged to facade
+    pGameFacade->setLanguage(1, false);
+    pGameFacade->setLanguage(0, false);
+    pGameFacade->setLanguage(1, false);
+
+    QTRY_VERIFY2(loadFinishedSpy.count() == 1, "The last language request has not been acknowledged!");
+    QVERIFY2(loadFinishedSpy.at(0).at(0).toBool() && loadFinishedSpy.at(0).at(1).toBool(), "The last language request should succeed!");
+    QVERIFY2(statusCodes == (QVector<GameFacade::StatusCodes>{GameFacade::StatusCodes::FETCHING_DATA,
+                                                              GameFacade::StatusCodes::FETCHING_DATA,
+                                                              GameFacade::StatusCodes::FETCHING_DATA,
+                                                              GameFacade::StatusCodes::DATA_FETCHING_COMPLETE}),
+             "Incorrect status codes sequence for consecutive requests!");
+    QVERIFY2(pGameFacade->getCurrentLanguageIndex() == 1 && pGameManager->getDataSourceAccessHelper()->getTotalNrOfEntries() == 200,
+             "The data of the last requested language is not used!");
+}
+
+void ManagementTests::testGameFacadeResidentLanguageSwitch()
+{
+    QVERIFY2(_setEnvironment({100, 200}), "The game environment could not be set!");
+
+    GameManager* pGameManager{GameManager::getManager()};
+    GameFacade* pGameFacade{pGameManager->getGameFacade()};
+    QSignalSpy loadFinishedSpy{pGameManager, &GameManager::fetchDataForPrimaryLanguageFinished};
+    QVector<GameFacade::StatusCodes> statusCodes;
+
+    // no preload should be ongoing so the languages are only made resident by the requests below
+    pGameManager->setLanguagePreloadPolicy(false, {});
+    pGameFacade->init();
+    pGameFacade->setLanguage(0, false);
+
+    QTRY_VERIFY2(loadFinishedSpy.count() == 1, "The first language load has not been completed!");
+
+    pGameFacade->setLanguage(1, false);
+
+    QTRY_VERIFY2(loadFinishedSpy.count() == 2, "The second language load has not been completed!");
+
+    auto connected{connect(pGameFacade, &GameFacade::statusChanged, [&]() {statusCodes.append(pGameFacade->getStatusCode());})};
+    Q_ASSERT(connected);
+
+    // no event processing required, the (resident) language is used before setLanguage() returns
+    pGameFacade->setLanguage(0, false);
+
+    QVERIFY2(statusCodes == (QVector<GameFacade::StatusCodes>{GameFacade::StatusCodes::DATA_FETCHING_COMPLETE}), "The fetching state should be skipped for a resident language!");
+    QVERIFY2(pGameFacade->isDataAvailable() && !pGameFacade->isDataFetchingInProgress(), "The resident language is not used right away!");
+    QVERIFY2(pGameManager->getDataSourceAccessHelper()->getTotalNrOfEntries() == 100, "The entries of the resident language are not used!");
+
+    QTest::qWait(50);
+
+    QVERIFY2(loadFinishedSpy.count() == 2, "No request should be sent to loader for a resident language!");
+}
+
+void ManagementTests::testDataEntryFacadeSaveRequestsStatusOrder()
+{
+    QVERIFY2(_setEnvironment({100, 200}), "The game environment could not be set!");
+
+    GameManager* pGameManager{GameManager::getManager()};
+    GameFacade* pGameFacade{pGameManager->getGameFacade()};
+    DataEntryFacade* pDataEntryFacade{pGameManager->getDataEntryFacade()};
+    QVector<DataEntryFacade::StatusCodes> statusCodes;
+
+    pGameFacade->init();
+    pGameFacade->setLanguage(0, false);
+
+    // data entry is only allowed once the game language has been loaded
+    QTRY_VERIFY2(pDataEntryFacade->isDataEntryAllowed(), "Data entry has not been allowed!");
+
+    auto connected{connect(pDataEntryFacade, &DataEntryFacade::statusChanged, [&]() {statusCodes.append(pDataEntryFacade->getStatusCode());})};
+    Q_ASSERT(connected);
+
+    pDataEntryFacade->setLanguage(1);
+
+    QTRY_VERIFY2(!pDataEntryFacade->isDataFetchingInProgress(), "The data entry language has not been fetched!");
+
+    pDataEntryFacade->requestAddPairToCache("freshword", "anotherword", true);
+
+    QTRY_VERIFY2(pDataEntryFacade->isSavingToDbAllowed(), "The words pair has not been added to cache!");
+
+    pDataEntryFacade->requestSaveDataToDb();
+
+    QTRY_VERIFY2(!pDataEntryFacade->isDataSavingInProgress(), "The saving has not been completed!");
+    QVERIFY2(statusCodes == (QVector<DataEntryFacade::StatusCodes>{DataEntryFacade::StatusCodes::FETCHING_DATA,
+                                                                   DataEntryFacade::StatusCodes::DATA_FETCHING_FINISHED,
+                                                                   DataEntryFacade::StatusCodes::DATA_ENTRY_ADD_SUCCESS,
+                                                                   DataEntryFacade::StatusCodes::DATA_SAVE_IN_PROGRESS,
+                                                                   DataEntryFacade::StatusCodes::DATA_SUCCESSFULLY_SAVED}),
+             "Incorrect status codes sequence for saving!");
+
+    statusCodes.clear();
+
+    pDataEntryFacade->requestAddPairToCache("otherfreshword", "otheranotherword", false);
+
+    QTRY_VERIFY2(pDataEntryFacade->isSavingToDbAllowed(), "The second words pair has not been added to cache!");
+
+    // saving requested while fetching is deferred until the language has been fetched
+    pDataEntryFacade->setLanguage(0);
+    pDataEntryFacade->requestSaveDataToDb();
+
+    QVERIFY2(!pDataEntryFacade->isDataSavingInProgress(), "The saving should be deferred while fetching data!");
+    QTRY_VERIFY2(statusCodes.size() == 4, "The deferred saving has not been completed!");
+    QVERIFY2(statusCodes == (QVector<DataEntryFacade::StatusCodes>{DataEntryFacade::StatusCodes::DATA_ENTRY_ADD_SUCCESS,
+                                                                   DataEntryFacade::StatusCodes::FETCHING_DATA,
+                                                                   DataEntryFacade::StatusCodes::DATA_FETCHING_FINISHED_SAVE_IN_PROGRESS,
+                                                                   DataEntryFacade::StatusCodes::DATA_SUCCESSFULLY_SAVED}),
+             "Incorrect status codes sequence for deferred saving!");
+    QVERIFY2(pDataEntryFacade->getLastSavedTotalNrOfPairs() == 1, "Incorrect number of saved pairs!");
+}
+
+void ManagementTests::testDataEntryFacadeSavingError()
+{
+    QVERIFY2(_setEnvironment({100}), "The game environment could not be set!");
+
+    GameManager* pGameManager{GameManager::getManager()};
+    GameFacade* pGameFacade{pGameManager->getGameFacade()};
+    DataEntryFacade* pDataEntryFacade{pGameManager->getDataEntryFacade()};
+
+    pGameFacade->init();
+    pGameFacade->setLanguage(0, false);
+
+    QTRY_VERIFY2(pDataEntryFacade->isDataEntryAllowed(), "Data entry has not been allowed!");
+
+    pDataEntryFacade->requestAddPairToCache("failedword", "anotherfailedword", true);
+
+    QTRY_VERIFY2(pDataEntryFacade->isSavingToDbAllowed(), "The words pair has not been added to cache!");
+
+    // simulates a database write failure as reported by the data source
+    const QVector<DataSource::DataEntry> c_FailedEntries{{"failedword", "anotherfailedword", true}};
+    Q_EMIT pGameManager->dataSavingErrorOccured(c_FailedEntries);
+
+    QVERIFY2(pDataEntryFacade->getStatusCode() == DataEntryFacade::StatusCodes::DATA_SAVING_ERROR, "Incorrect status code for saving error!");
+    QVERIFY2(pDataEntryFacade->getFailedSaveEntries().size() == 1, "Incorrect number of failed entries!");
+    QVERIFY2(pDataEntryFacade->getFailedSaveEntries().at(0).firstWord == "failedword" &&
+             pDataEntryFacade->getFailedSaveEntries().at(0).secondWord == "anotherfailedword" &&
+             pDataEntryFacade->getFailedSaveEntries().at(0).areSynonyms, "Incorrect failed entry!");
+    QVERIFY2(!pDataEntryFacade->isDataSavingInProgress(), "Saving should no longer be in progress!");
+    QVERIFY2(pDataEntryFacade->isSavingToDbAllowed() && pDataEntryFacade->isCacheResetAllowed(), "Saving again or discarding the failed entries should be allowed!");
+
+    // a new saving attempt clears the previously failed entries
+    pDataEntryFacade->requestSaveDataToDb();
+
+    QVERIFY2(pDataEntryFacade->getFailedSaveEntries().isEmpty(), "The failed entries have not been cleared!");
+    QTRY_VERIFY2(pDataEntryFacade->getStatusCode() == DataEntryFacade::StatusCodes::DATA_SUCCESSFULLY_SAVED, "The entries have not been saved again!");
+}
+
+void ManagementTests::testGameSessionPoolSessionRouting()
+{
+    std::unique_ptr<DataSource> pDataSource{_createDataSource(1)};
+    std::unique_ptr<GameSessionPool> pGameSessionPool{new GameSessionPool{pDataSource.get(), 3}};
+    QMutex resultsMutex;
+    QHash<int, QThread*> sessionThreads;
+
+    QVERIFY2(pGameSessionPool->getNrOfShards() == 3, "Incorrect number of shards!");
+
+    // a shard used from the current thread, same operations as requested by pool within the shard threads
+    std::unique_ptr<GameSessionShard> pGameSessionShard{new GameSessionShard{pDataSource.get()}};
+    GameSession* pGameSession{pGameSessionShard->createSession(7)};
+
+    QVERIFY2(pGameSession && pGameSession->getSessionId() == 7 && pGameSessionShard->getSession(7) == pGameSession, "Session not provided by shard!");
+    QVERIFY2(pGameSessionShard->getNrOfSessions() == 1 && !pGameSessionShard->getSession(8), "Incorrect sessions provided by shard!");
+    QVERIFY2(pGameSession->setLanguage(0) && pDataSource->isLanguagePinned(0), "Session language not pinned!");
+    QVERIFY2(pGameSessionShard->destroySession(7) && !pGameSessionShard->destroySession(7), "Session not destroyed exactly once!");
+    QVERIFY2(pGameSessionShard->getNrOfSessions() == 0 && !pDataSource->isLanguagePinned(0), "Destroyed session still referenced!");
+
+    for (int sessionNumber{1}; sessionNumber <= 6; ++sessionNumber)
+    {
+        const int c_SessionId{pGameSessionPool->createSession()};
+
+        QVERIFY2(c_SessionId == sessionNumber && pGameSessionPool->getShardIndex(c_SessionId) == sessionNumber % 3, "Session not assigned round robin!");
+
+        // requested right after creation, the session should already exist when the task gets executed
+        pGameSessionPool->runInSession(c_SessionId, [&resultsMutex, &sessionThreads, c_SessionId](GameSession* pGameSession) {
+            QMutexLocker mutexLocker{&resultsMutex};
+            sessionThreads.insert(c_SessionId, pGameSession && pGameSession->getSessionId() == c_SessionId ? pGameSession->thread() : nullptr);
+        });
+    }
+
+    auto getNrOfExecutedTasks = [&resultsMutex, &sessionThreads]()
+    {
+        QMutexLocker mutexLocker{&resultsMutex};
+        return sessionThreads.size();
+    };
+
+    QTRY_VERIFY2(getNrOfExecutedTasks() == 6, "The session tasks have not been executed!");
+
+    QMutexLocker mutexLocker{&resultsMutex};
+
+    for (int sessionId{1}; sessionId <= 6; ++sessionId)
+    {
+        QThread* pSessionThread{sessionThreads.value(sessionId)};
+
+        QVERIFY2(pSessionThread && pSessionThread != QThread::currentThread(), "Session not created within a shard thread!");
+        QVERIFY2((pSessionThread == sessionThreads.value(sessionId <= 3 ? sessionId + 3 : sessionId - 3)), "Sessions of the same shard are not hosted by the same thread!");
+        QVERIFY2((pSessionThread != sessionThreads.value(sessionId % 3 + 1)), "Sessions of different shards are hosted by the same thread!");
+    }
+}
+
+void ManagementTests::testGameSessionPoolCrossThreadTasks()
+{
+    std::unique_ptr<DataSource> pDataSource{_createDataSource(2)};
+    std::unique_ptr<GameSessionPool> pGameSessionPool{new GameSessionPool{pDataSource.get(), 2}};
+    QThread* const c_pTestThread{QThread::currentThread()};
+    QAtomicInt nrOfExecutedTasks{0};
+    QAtomicInt nrOfFailedTasks{0};
+
+    const int c_FirstSessionId{pGameSessionPool->createSession()};
+    const int c_SecondSessionId{pGameSessionPool->createSession()};
+
+    // each task checks it is executed by the thread that owns the session, the tasks of a session being executed in the requested order
+    auto checkTask = [c_pTestThread, &nrOfExecutedTasks, &nrOfFailedTasks](const std::function<bool(GameSession*)>& task)
+    {
+        return [c_pTestThread, &nrOfExecutedTasks, &nrOfFailedTasks, task](GameSession* pGameSession)
+        {
+            const bool c_Success{pGameSession && QThread::currentThread() != c_pTestThread && QThread::currentThread() == pGameSession->thread() && task(pGameSession)};
+
+            if (!c_Success)
+            {
+                nrOfFailedTasks.ref();
+            }
+
+            nrOfExecutedTasks.ref();
+        };
+    };
+
+    pGameSessionPool->runInSession(c_FirstSessionId, checkTask([](GameSession* pGameSession) {return pGameSession->setLanguage(0);}));
+    pGameSessionPool->runInSession(c_SecondSessionId, checkTask([](GameSession* pGameSession) {return pGameSession->setLanguage(1);}));
+    pGameSessionPool->runInSession(c_FirstSessionId, checkTask([](GameSession* pGameSession) {
+        return pGameSession->getLanguageIndex() == 0 && pGameSession->isWordsPairAvailable() && pGameSession->getFirstReferenceWord().startsWith("lang0");
+    }));
+    pGameSessionPool->runInSession(c_SecondSessionId, checkTask([](GameSession* pGameSession) {
+        pGameSession->provideCorrectWordsPairToUser();
+        return pGameSession->getLanguageIndex() == 1 && pGameSession->getTotalWordPairs() == "1";
+    }));
+
+    QTRY_VERIFY2(nrOfExecutedTasks.loadAcquire() == 4, "The session tasks have not been executed!");
+    QVERIFY2(nrOfFailedTasks.loadAcquire() == 0, "The session tasks have not been executed correctly within the shard threads!");
+
+    // the languages used by the live sessions are pinned, so they cannot be evicted
+    QVERIFY2(pDataSource->isLanguagePinned(0) && pDataSource->isLanguagePinned(1), "The session languages are not pinned!");
+
+    pDataSource->setResidencyLimits(2, 0);
+    pDataSource->updateDataEntries({{"firstword", "secondword", true}}, 2, DataSource::UpdateOperation::LOAD_TO_PRIMARY);
+
+    QVERIFY2(pDataSource->isLanguageResident(0) && pDataSource->isLanguageResident(1), "Language used by a live session evicted!");
+}
+
+void ManagementTests::testGameSessionPoolShutdown()
+{
+    std::unique_ptr<DataSource> pDataSource{_createDataSource(1)};
+    std::unique_ptr<GameSessionPool> pGameSessionPool{new GameSessionPool{pDataSource.get(), 2}};
+    QAtomicInt nrOfExecutedTasks{0};
+    QAtomicInt nrOfMissingSessions{0};
+
+    const int c_FirstSessionId{pGameSessionPool->createSession()};
+    const int c_SecondSessionId{pGameSessionPool->createSession()};
+
+    pGameSessionPool->runInSession(c_FirstSessionId, [](GameSession* pGameSession) {Q_UNUSED(pGameSession && pGameSession->setLanguage(0));});
+    pGameSessionPool->runInSession(c_SecondSessionId, [](GameSession* pGameSession) {Q_UNUSED(pGameSession && pGameSession->setLanguage(0));});
+
+    // a destroyed session is no longer provided to the tasks requested afterwards
+    pGameSessionPool->destroySession(c_FirstSessionId);
+    pGameSessionPool->runInSession(c_FirstSessionId, [&nrOfExecutedTasks, &nrOfMissingSessions](GameSession* pGameSession) {
+        if (!pGameSession)
+        {
+            nrOfMissingSessions.ref();
+        }
+
+        nrOfExecutedTasks.ref();
+    });
+
+    // queued right before shutting down, these tasks should still be executed
+    for (int taskNumber{0}; taskNumber < 100; ++taskNumber)
+    {
+        pGameSessionPool->runInSession(c_SecondSessionId, [&nrOfExecutedTasks, &nrOfMissingSessions](GameSession* pGameSession) {
+            if (!pGameSession)
+            {
+                nrOfMissingSessions.ref();
+            }
+            else
+            {
+                pGameSession->provideCorrectWordsPairToUser();
+            }
+
+            nrOfExecutedTasks.ref();
+        });
+    }
+
+    pGameSessionPool.reset();
+
+    QVERIFY2(nrOfExecutedTasks.loadAcquire() == 101, "Queued tasks not executed before shutting down!");
+    QVERIFY2(nrOfMissingSessions.loadAcquire() == 1, "Destroyed session still provided or live session missing!");
+    QVERIFY2(!pDataSource->isLanguagePinned(0), "The session languages are still pinned after shutting down!");
+}
+
+bool ManagementTests::_setEnvironment(const QVector<int>& nrOfEntriesPerLanguage)
+{
+    bool success{false};
+    std::unique_ptr<QTemporaryDir> pDataDir{new QTemporaryDir{}};
+
+    if (pDataDir->isValid() && _createDatabase(pDataDir->path() + "/" + Database::Query::c_DatabaseName, nrOfEntriesPerLanguage))
+    {
+        GameManager::getManager()->setEnvironment(pDataDir->path());
+        m_pDataDir = std::move(pDataDir);
+        success = true;
+    }
+
+    return success;
+}
+
+bool ManagementTests::_createDatabase(const QString& databasePath, const QVector<int>& nrOfEntriesPerLanguage)
+{
+    const QString c_ConnectionName{"ManagementTestsConnection"};
+    bool success{false};
+
+    {
+        QSqlDatabase db{QSqlDatabase::addDatabase(Database::Query::c_DbDriverName, c_ConnectionName)};
+        db.setDatabaseName(databasePath);
+
+        if (db.open())
+        {
+            QSqlQuery query{db};
+
+            success = query.exec(Database::Query::c_CreateTableQuery) && db.transaction();
+
+            if (success)
+            {
+                success = query.prepare("INSERT INTO GameDataTable(firstWord, secondWord, areSynonyms, language) VALUES(?, ?, ?, ?)");
+
+                for (int languageIndex{0}; success && languageIndex < nrOfEntriesPerLanguage.size(); ++languageIndex)
+                {
+                    for (int entryNumber{0}; success && entryNumber < nrOfEntriesPerLanguage.at(languageIndex); ++entryNumber)
+                    {
+                        query.addBindValue(_createWord("first", entryNumber));
+                        query.addBindValue(_createWord("second", entryNumber));
+                        query.addBindValue(entryNumber % 2);
+                        query.addBindValue(Database::Query::c_LanguageCodes.at(languageIndex));
+
+                        success = query.exec();
+                    }
+                }
+
+                success = db.commit() && success;
+            }
+
+            db.close();
+        }
+    }
+
+    QSqlDatabase::removeDatabase(c_ConnectionName);
+
+    return success;
+}
+
+std::unique_ptr<DataSource> ManagementTests::_createDataSource(int nrOfLanguages)
+{
+    std::unique_ptr<DataSource> pDataSource{new DataSource{}};
+
+    // the first language is primary, the other ones are only resident (as needed by the game sessions)
+    for (int languageIndex{0}; languageIndex < nrOfLanguages; ++languageIndex)
+    {
+        QVector<DataSource::DataEntry> dataEntries;
+
+        for (int entryNumber{0}; entryNumber < 10; ++entryNumber)
+        {
+            dataEntries.append({_createWord(QString{"lang%1first"}.arg(languageIndex), entryNumber), _createWord(QString{"lang%1second"}.arg(languageIndex), entryNumber), true});
+        }
+
+        pDataSource->updateDataEntries(dataEntries, languageIndex, languageIndex == 0 ? DataSource::UpdateOperation::LOAD_TO_PRIMARY : DataSource::UpdateOperation::LOAD_AS_RESIDENT);
+    }
+
+    return pDataSource;
+}
+
+QString ManagementTests::_createWord(const QString& prefix, int wordNumber)
+{
+    QString word{prefix};
+
+    // lowercase letters only (digits are rejected by loader), each number getting its own suffix
+    for (int letterIndex{0}; letterIndex < 4; ++letterIndex)
+    {
+        word.append(QChar{'a' + wordNumber % 26});
+        wordNumber /= 26;
+    }
+
+    return word;
+}
+
+QTEST_GUILESS_MAIN(ManagementTests)
+
+#include "tst_managementtests.moc"
@@ -2,8 +2,14 @@
 #include <QtAlgorithms>
 
 #include <memory>
+#include <thread>
 
 #include "statisticsitem.h"
+#include "requestsequencer.h"
+#include "ringbuffer.h"
+#include "sessionlog.h"
+#include "tracer.h"
+#include "metricsregistry.h"
 
 class UtilitiesTests : public QObject
 {
@@ -16,6 +22,11 @@ private slots:
     void testLevelCorrectlySetup();
     void testStatisticsCorrectlyUpdated();
     void testSetScoreIncrementForLevel();
+    void testRequestSequencer();
+    void testRingBuffer();
+    void testSessionLog();
+    void testTracer();
+    void testMetricsRegistry();
 
 private:
     void _doFullStatisticsUpdateCheck(std::unique_ptr<StatisticsItem>& pStatisticsItem, const int referenceGuessedWordPairs, const int referenceTotalWordPairs, const int referenceObtainedScore,
@@ -270,6 +281,300 @@ void UtilitiesTests::_checkCorrectStatistics(const StatisticsItem& statisticsIte
     QVERIFY2(statisticsItem.getTotalAvailableScore() == QString::number(referenceTotalAvailableScore), "Total available score is incorrect");
 }
 
+void UtilitiesTests::testRequestSequencer()
+{
+    {
+        RequestSequencer requestSequencer;
+
+        QVERIFY2(!requestSequencer.isRequestPending(), "No request should be pending after initialization");
+        QVERIFY2(requestSequencer.getLastIssuedRequestId() == 0 && requestSequencer.getLastAcknowledgedRequestId() == 0, "The request sequencer has not been correctly initialized");
+
+        const int c_FirstRequestId{requestSequencer.issueRequest()};
+
+        QVERIFY2(requestSequencer.isRequestPending(), "The issued request should be pending");
+        QVERIFY2(requestSequencer.isLatestRequest(c_FirstRequestId), "The issued request should be the latest one");
+        QVERIFY2(requestSequencer.acknowledgeRequest(c_FirstRequestId), "The acknowledgement of the latest request has not been accepted");
+        QVERIFY2(!requestSequencer.isRequestPending(), "No request should be pending after acknowledging the latest one");
+    }
+
+    {
+        RequestSequencer requestSequencer;
+
+        const int c_FirstRequestId{requestSequencer.issueRequest()};
+        const int c_SecondRequestId{requestSequencer.issueRequest()};
+        const int c_ThirdRequestId{requestSequencer.issueRequest()};
+
+        QVERIFY2(c_FirstRequestId < c_SecondRequestId && c_SecondRequestId < c_ThirdRequestId, "The request IDs are not increasing");
+        QVERIFY2(!requestSequencer.isLatestRequest(c_FirstRequestId) && !requestSequencer.isLatestRequest(c_SecondRequestId), "An older request has been considered the latest one");
+
+        QVERIFY2(!requestSequencer.acknowledgeRequest(c_FirstRequestId), "The acknowledgement of an obsolete request should be reported as such");
+        QVERIFY2(requestSequencer.isRequestPending(), "The latest request should still be pending");
+        QVERIFY2(!requestSequencer.acknowledgeRequest(c_SecondRequestId), "The acknowledgement of an obsolete request should be reported as such");
+        QVERIFY2(requestSequencer.getLastAcknowledgedRequestId() == c_SecondRequestId, "The last acknowledged request has not been correctly recorded");
+        QVERIFY2(requestSequencer.acknowledgeRequest(c_ThirdRequestId), "The acknowledgement of the latest request has not been accepted");
+        QVERIFY2(!requestSequencer.isRequestPending(), "No request should be pending after acknowledging the latest one");
+    }
+}
+
+void UtilitiesTests::testRingBuffer()
+{
+    RingBuffer<QString> ringBuffer{3};
+
+    QVERIFY2(ringBuffer.isEmpty() && ringBuffer.size() == 0 && ringBuffer.capacity() == 3, "The ring buffer has not been correctly initialized");
+
+    QVERIFY2(ringBuffer.push("first") && ringBuffer.push("second") && ringBuffer.push("third"), "Element not added although ring buffer is not full");
+    QVERIFY2(ringBuffer.isFull(), "The ring buffer should be full");
+    QVERIFY2(!ringBuffer.push("fourth"), "Element added although ring buffer is full");
+
+    QVERIFY2(ringBuffer.takeFirst() == "first", "Elements are not retrieved in the order they were added");
+    QVERIFY2(ringBuffer.push("fourth"), "Element not added after retrieving an element from a full ring buffer");
+    QVERIFY2(ringBuffer.takeFirst() == "second" && ringBuffer.takeFirst() == "third" && ringBuffer.takeFirst() == "fourth", "Elements are not retrieved in the order they were added after wrapping around");
+    QVERIFY2(ringBuffer.isEmpty(), "The ring buffer should be empty after retrieving all elements");
+
+    QVERIFY2(ringBuffer.push("fifth"), "Element not added to empty ring buffer");
+    ringBuffer.clear();
+
+    QVERIFY2(ringBuffer.isEmpty() && ringBuffer.capacity() == 3, "The ring buffer has not been correctly cleared");
+}
+
+void UtilitiesTests::testSessionLog()
+{
+    QTemporaryDir temporaryDir;
+    QVERIFY2(temporaryDir.isValid(), "Cannot create the temporary directory for the session log");
+
+    const QString c_LogFilePath{temporaryDir.filePath("session.log")};
+
+    {
+        SessionLog sessionLog;
+
+        QVERIFY2(!sessionLog.append(SessionLog::Events::INIT), "Entry written although the log is not open");
+        QVERIFY2(sessionLog.openForWriting(c_LogFilePath), "Cannot open the session log for writing");
+        QVERIFY2(sessionLog.append(SessionLog::Events::SESSION_STARTED, 4294967295u) &&
+                 sessionLog.append(SessionLog::Events::SET_LANGUAGE, 1, 1) &&
+                 sessionLog.append(SessionLog::Events::ADD_PIECE_TO_INPUT_WORD, 1, 300) &&
+                 sessionLog.append(SessionLog::Events::CLEAR_INPUT, 5, 5) &&
+                 sessionLog.append(SessionLog::Events::HANDLE_SUBMIT_REQUEST, 1), "Cannot write entries to the session log");
+
+        sessionLog.close();
+    }
+
+    {
+        SessionLog sessionLog;
+        SessionLog::Entry entry;
+
+        QVERIFY2(sessionLog.openForReading(c_LogFilePath), "Cannot open the session log for reading");
+        QVERIFY2(!sessionLog.isOpenForWriting(), "The session log should not be writable when opened for reading");
+
+        QVERIFY2(sessionLog.readEntry(entry) && entry.event == SessionLog::Events::SESSION_STARTED && entry.firstArgument == 4294967295u, "Incorrect session started entry");
+        QVERIFY2(sessionLog.readEntry(entry) && entry.event == SessionLog::Events::SET_LANGUAGE && entry.firstArgument == 1 && entry.secondArgument == 1, "Incorrect set language entry");
+        QVERIFY2(sessionLog.readEntry(entry) && entry.event == SessionLog::Events::ADD_PIECE_TO_INPUT_WORD && entry.firstArgument == 1 && entry.secondArgument == 300, "Incorrect add piece entry");
+        QVERIFY2(sessionLog.readEntry(entry) && entry.event == SessionLog::Events::CLEAR_INPUT && entry.firstArgument == 0 && entry.secondArgument == 0, "Arguments stored for an event that has no arguments");
+        QVERIFY2(sessionLog.readEntry(entry) && entry.event == SessionLog::Events::HANDLE_SUBMIT_REQUEST && entry.firstArgument == 1, "Incorrect submit entry");
+        QVERIFY2(sessionLog.isAtEnd() && !sessionLog.readEntry(entry), "Entry read beyond the end of the session log");
+    }
+
+    {
+        QFile logFile{c_LogFilePath};
+        QVERIFY2(logFile.open(QIODevice::Append), "Cannot open the session log for corrupting it");
+
+        // add piece event with an unterminated argument
+        logFile.write(QByteArray(1, static_cast<char>(SessionLog::Events::ADD_PIECE_TO_INPUT_WORD)) + QByteArray(3, static_cast<char>(0x80)));
+        logFile.close();
+
+        SessionLog sessionLog;
+        SessionLog::Entry entry;
+        int nrOfReadEntries{0};
+
+        QVERIFY2(sessionLog.openForReading(c_LogFilePath), "Cannot open the session log for reading");
+
+        while (sessionLog.readEntry(entry))
+        {
+            ++nrOfReadEntries;
+        }
+
+        QVERIFY2(nrOfReadEntries == 5 && sessionLog.isAtEnd(), "The corrupted entry has not been detected");
+    }
+
+    {
+        QFile logFile{c_LogFilePath};
+        QVERIFY2(logFile.open(QIODevice::WriteOnly | QIODevice::Truncate), "Cannot open the session log for overwriting it");
+        logFile.write("SYNX");
+        logFile.close();
+
+        SessionLog sessionLog;
+        QVERIFY2(!sessionLog.openForReading(c_LogFilePath), "A file without session log header has been accepted");
+    }
+}
+
+void UtilitiesTests::testTracer()
+{
+    static constexpr int c_NrOfWorkerEvents{50000}; // more than fit into a thread buffer
+
+    Tracer* const c_pTracer{Tracer::getTracer()};
+
+    for (int eventNumber{0}; eventNumber < 3; ++eventNumber)
+    {
+        const qint64 c_StartTime{c_pTracer->getCurrentTime()};
+        c_pTracer->addEvent("MainThreadEvent", c_StartTime, c_pTracer->getCurrentTime());
+    }
+
+    std::thread workerThread{[c_pTracer]() {
+        for (int eventNumber{0}; eventNumber < c_NrOfWorkerEvents; ++eventNumber)
+        {
+            const qint64 c_StartTime{c_pTracer->getCurrentTime()};
+            c_pTracer->addEvent("WorkerThreadEvent", c_StartTime, c_pTracer->getCurrentTime());
+        }
+    }};
+
+    workerThread.join();
+
+    QTemporaryDir temporaryDir;
+    QVERIFY2(temporaryDir.isValid(), "Cannot create the temporary directory for the trace");
+
+    const QString c_TraceFilePath{temporaryDir.filePath("trace.json")};
+    QVERIFY2(c_pTracer->writeChromeTrace(c_TraceFilePath), "Cannot write the trace");
+
+    QFile traceFile{c_TraceFilePath};
+    QVERIFY2(traceFile.open(QIODevice::ReadOnly), "Cannot open the written trace");
+
+    const QJsonArray c_TraceEvents{QJsonDocument::fromJson(traceFile.readAll()).object().value("traceEvents").toArray()};
+
+    int nrOfMainThreadEvents{0};
+    int nrOfWorkerThreadEvents{0};
+    int nrOfThreadNames{0};
+    bool areDurationsValid{true};
+
+    for (const QJsonValue& traceEvent : c_TraceEvents)
+    {
+        const QJsonObject c_TraceEvent{traceEvent.toObject()};
+        const QString c_Name{c_TraceEvent.value("name").toString()};
+
+        if (c_Name == "thread_name")
+        {
+            ++nrOfThreadNames;
+        }
+        else
+        {
+            nrOfMainThreadEvents += c_Name == "MainThreadEvent" ? 1 : 0;
+            nrOfWorkerThreadEvents += c_Name == "WorkerThreadEvent" ? 1 : 0;
+            areDurationsValid = areDurationsValid && c_TraceEvent.value("ph").toString() == "X" && c_TraceEvent.value("dur").toDouble(-1.0) >= 0.0;
+        }
+    }
+
+    QVERIFY2(nrOfThreadNames == 2, "Each tracing thread should be named in the trace");
+    QVERIFY2(nrOfMainThreadEvents == 3, "Incorrect number of events traced on the main thread");
+    QVERIFY2(nrOfWorkerThreadEvents > 0 && nrOfWorkerThreadEvents < c_NrOfWorkerEvents, "The oldest events of a full thread buffer should have been overwritten");
+    QVERIFY2(areDurationsValid, "Invalid trace event found");
+}
+
+void UtilitiesTests::testMetricsRegistry()
+{
+    MetricsRegistry* const c_pRegistry{MetricsRegistry::getRegistry()};
+
+    // registration
+    {
+        MetricsRegistry::Counter* const c_pCounter{c_pRegistry->getCounter("test_requests_total", "Test requests.", "result=\"ok\"")};
+
+        QVERIFY2(c_pRegistry->getCounter("test_requests_total", "Test requests.", "result=\"ok\"") == c_pCounter, "The same counter should be returned for the same name and labels");
+        QVERIFY2(c_pRegistry->getCounter("test_requests_total", "Test requests.", "result=\"failed\"") != c_pCounter, "A new counter should be registered for other labels");
+        QVERIFY2(c_pRegistry->getHistogram("test_latency_seconds", "Test latency.") == c_pRegistry->getHistogram("test_latency_seconds", "Test latency."),
+                 "The same histogram should be returned for the same name");
+
+        c_pCounter->increment();
+        c_pCounter->increment(4);
+        QVERIFY2(c_pCounter->getValue() == 5, "Incorrect counter value");
+
+        MetricsRegistry::Gauge* const c_pGauge{c_pRegistry->getGauge("test_queue_size", "Test queue size.")};
+
+        c_pGauge->set(12);
+        c_pGauge->set(-3);
+        QVERIFY2(c_pGauge->getValue() == -3, "Incorrect gauge value");
+    }
+
+    // bucketing
+    {
+        const int c_SubBucketCount{MetricsRegistry::Histogram::sc_SubBucketCount};
+        const int c_NrOfBuckets{MetricsRegistry::Histogram::sc_NrOfBuckets};
+        const quint64 c_MaxValue{MetricsRegistry::Histogram::sc_MaxValue};
+
+        QVERIFY2(MetricsRegistry::Histogram::getBucketIndex(c_MaxValue) == c_NrOfBuckets - 1, "The maximum value should be contained in the last bucket");
+        QVERIFY2(MetricsRegistry::Histogram::getBucketUpperLimit(c_NrOfBuckets - 1) == c_MaxValue, "The last bucket should end at the maximum value");
+
+        bool areLimitsConsistent{true};
+        bool isRelativeErrorBounded{true};
+        quint64 previousUpperLimit{0};
+
+        for (int bucketIndex{0}; bucketIndex < c_NrOfBuckets; ++bucketIndex)
+        {
+            const quint64 c_UpperLimit{MetricsRegistry::Histogram::getBucketUpperLimit(bucketIndex)};
+            const quint64 c_LowerLimit{bucketIndex == 0 ? 0 : previousUpperLimit + 1};
+
+            areLimitsConsistent = areLimitsConsistent &&
+                                  (bucketIndex == 0 || c_UpperLimit > previousUpperLimit) &&
+                                  MetricsRegistry::Histogram::getBucketIndex(c_LowerLimit) == bucketIndex &&
+                                  MetricsRegistry::Histogram::getBucketIndex(c_UpperLimit) == bucketIndex;
+
+            // the exact buckets (first sc_SubBucketCount values) have no error
+            isRelativeErrorBounded = isRelativeErrorBounded &&
+                                     (bucketIndex < c_SubBucketCount || (c_UpperLimit - c_LowerLimit + 1) * (c_SubBucketCount / 2) <= c_LowerLimit);
+
+            previousUpperLimit = c_UpperLimit;
+        }
+
+        QVERIFY2(areLimitsConsistent, "The buckets should be contiguous and each value should be mapped to the bucket containing it");
+        QVERIFY2(isRelativeErrorBounded, "The relative bucket width should not exceed 1/32");
+    }
+
+    // quantiles
+    {
+        MetricsRegistry::Histogram* const c_pHistogram{c_pRegistry->getHistogram("test_quantiles_seconds", "Test quantiles.")};
+
+        QVERIFY2(c_pHistogram->getValueAtQuantile(0.5) == 0, "The quantiles of an empty histogram should be 0");
+
+        // values 1..1000 us
+        for (qint64 value{1}; value <= 1000; ++value)
+        {
+            c_pHistogram->record(value * 1000);
+        }
+
+        c_pHistogram->record(-5); // recorded as 0
+
+        const qint64 c_Median{c_pHistogram->getValueAtQuantile(0.5)};
+        const qint64 c_NinetyNinthPercentile{c_pHistogram->getValueAtQuantile(0.99)};
+
+        QVERIFY2(c_pHistogram->getCount() == 1001, "Incorrect number of recorded values");
+        QVERIFY2(c_pHistogram->getMaxValue() == 1000000, "Incorrect maximum value");
+        QVERIFY2(c_pHistogram->getValueAtQuantile(1.0) == 1000000, "The maximum quantile should be the exact maximum value");
+        QVERIFY2(c_pHistogram->getValueAtQuantile(0.0) == 0, "The minimum quantile should be contained in the first bucket");
+        QVERIFY2(c_Median >= 500000 && c_Median <= 500000 + 500000 / 32, "Incorrect median");
+        QVERIFY2(c_NinetyNinthPercentile >= 990000 && c_NinetyNinthPercentile <= 990000 + 990000 / 32, "Incorrect 99th percentile");
+    }
+
+    // export
+    {
+        const QString c_PrometheusText{c_pRegistry->getSnapshot().toPrometheusText()};
+
+        QVERIFY2(c_PrometheusText.count("# TYPE test_requests_total counter\n") == 1, "The samples of the same counter family should share a single header");
+        QVERIFY2(c_PrometheusText.contains("test_requests_total{result=\"ok\"} 5\n"), "Missing or incorrect counter sample");
+        QVERIFY2(c_PrometheusText.contains("test_requests_total{result=\"failed\"} 0\n"), "Missing or incorrect counter sample");
+        QVERIFY2(c_PrometheusText.contains("# HELP test_queue_size Test queue size.\n# TYPE test_queue_size gauge\ntest_queue_size -3\n"), "Missing or incorrect gauge");
+        QVERIFY2(c_PrometheusText.contains("# TYPE test_quantiles_seconds summary\n"), "The histograms should be exported as summaries");
+        QVERIFY2(c_PrometheusText.contains("test_quantiles_seconds{quantile=\"1\"} 0.001\n"), "Missing or incorrect quantile sample");
+        QVERIFY2(c_PrometheusText.contains("test_quantiles_seconds_sum 0.5005\n"), "Missing or incorrect summary sum");
+        QVERIFY2(c_PrometheusText.contains("test_quantiles_seconds_count 1001\n"), "Missing or incorrect summary count");
+
+        QTemporaryDir temporaryDir;
+        QVERIFY2(temporaryDir.isValid(), "Cannot create the temporary directory for the metrics");
+
+        const QString c_MetricsFilePath{temporaryDir.filePath("metrics.prom")};
+        QVERIFY2(c_pRegistry->getSnapshot().writePrometheusText(c_MetricsFilePath), "Cannot write the metrics");
+
+        QFile metricsFile{c_MetricsFilePath};
+        QVERIFY2(metricsFile.open(QIODevice::ReadOnly | QIODevice::Text), "Cannot open the written metrics");
+        QVERIFY2(QString::fromUtf8(metricsFile.readAll()) == c_PrometheusText, "The written metrics differ from the snapshot");
+    }
+}
+
 QTEST_APPLESS_MAIN(UtilitiesTests)
 
 #include "tst_utilitiestests.moc"
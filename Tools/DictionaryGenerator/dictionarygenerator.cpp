@@ -0,0 +1,270 @@
+#include <QSqlDatabase>
+#include <QSqlQuery>
+
+#include <algorithm>
+
+#include "dictionarygenerator.h"
+#include "databaseutils.h"
+#include "gameutils.h"
+
+// required for generating a pair with valid words that is still too short
+static_assert(2 * Game::Constraints::c_MinWordSize < Game::Constraints::c_MinPairSize, "Pairs consisting of valid words are never too short");
+
+DictionaryGenerator::Settings::Settings()
+    : nrOfEntriesPerLanguage{1000}
+    , invalidEntriesRatio{0.0}
+    , seed{1}
+{
+}
+
+DictionaryGenerator::DictionaryGenerator(const Settings& settings)
+    : m_Settings{settings}
+    , m_EntryNumberSuffixSize{1}
+    , m_NrOfValidEntries{0}
+    , m_NrOfInvalidEntries{0}
+    , m_ConnectionName{"DictionaryGeneratorConnection"}
+{
+    Q_ASSERT(m_Settings.nrOfEntriesPerLanguage > 0);
+    Q_ASSERT(m_Settings.invalidEntriesRatio >= 0.0 && m_Settings.invalidEntriesRatio <= 1.0);
+
+    qint64 nrOfDistinctSuffixes{26};
+
+    while (nrOfDistinctSuffixes < m_Settings.nrOfEntriesPerLanguage)
+    {
+        nrOfDistinctSuffixes *= 26;
+        ++m_EntryNumberSuffixSize;
+    }
+}
+
+bool DictionaryGenerator::writeToDatabase(const QString& databasePath)
+{
+    bool success{false};
+
+    m_NrOfValidEntries = 0;
+    m_NrOfInvalidEntries = 0;
+    m_ErrorMessage.clear();
+    m_Engine.seed(m_Settings.seed);
+
+    if (QSqlDatabase::isDriverAvailable(Database::Query::c_DbDriverName))
+    {
+        {
+            QSqlDatabase db{QSqlDatabase::addDatabase(Database::Query::c_DbDriverName, m_ConnectionName)};
+            db.setDatabaseName(databasePath);
+
+            if (db.open())
+            {
+                QSqlQuery createTableQuery{db};
+
+                if (createTableQuery.exec(Database::Query::c_CreateTableQuery))
+                {
+                    success = true;
+
+                    for (auto languageIndex : m_Settings.languageIndexes)
+                    {
+                        if (!_writeLanguageEntries(languageIndex))
+                        {
+                            success = false;
+                            break;
+                        }
+                    }
+                }
+                else
+                {
+                    m_ErrorMessage = Database::Error::c_CannotCreateTable;
+                }
+
+                db.close();
+            }
+            else
+            {
+                m_ErrorMessage = Database::Error::c_CannotOpenDatabase;
+            }
+        }
+
+        QSqlDatabase::removeDatabase(m_ConnectionName);
+    }
+    else
+    {
+        m_ErrorMessage = Database::Error::c_DatabaseDriverNotAvailable;
+    }
+
+    return success;
+}
+
+int DictionaryGenerator::getNrOfValidEntries() const
+{
+    return m_NrOfValidEntries;
+}
+
+int DictionaryGenerator::getNrOfInvalidEntries() const
+{
+    return m_NrOfInvalidEntries;
+}
+
+QString DictionaryGenerator::getErrorMessage() const
+{
+    return m_ErrorMessage;
+}
+
+bool DictionaryGenerator::_writeLanguageEntries(int languageIndex)
+{
+    Q_ASSERT(languageIndex >= 0 && languageIndex < Database::Query::c_LanguageCodes.size());
+
+    bool success{true};
+
+    QSqlDatabase db{QSqlDatabase::database(m_ConnectionName)};
+    QSqlQuery insertEntryQuery{db};
+    insertEntryQuery.prepare(Database::Query::c_InsertEntryForLanguageIntoDbQuery);
+
+    std::bernoulli_distribution isInvalidEntryDist{m_Settings.invalidEntriesRatio};
+    int nrOfValidLanguageEntries{0};
+
+    // entries are written in batches (one transaction per batch), a transaction per entry would make writing millions of rows far too slow
+    for (int entryNumber{0}; entryNumber < m_Settings.nrOfEntriesPerLanguage && success; ++entryNumber)
+    {
+        if (entryNumber % sc_NrOfEntriesPerTransaction == 0 && !db.transaction())
+        {
+            success = false;
+            break;
+        }
+
+        const bool c_IsInvalidEntry{isInvalidEntryDist(m_Engine)};
+        const DataSource::DataEntry c_DataEntry{c_IsInvalidEntry ? _generateInvalidEntry() : _generateValidEntry(nrOfValidLanguageEntries)};
+
+        insertEntryQuery.bindValue(Database::Query::c_FirstWordFieldPlaceholder, c_DataEntry.firstWord);
+        insertEntryQuery.bindValue(Database::Query::c_SecondWordFieldPlaceholder, c_DataEntry.secondWord);
+        insertEntryQuery.bindValue(Database::Query::c_AreSynonymsFieldPlaceholder, static_cast<int>(c_DataEntry.areSynonyms));
+        insertEntryQuery.bindValue(Database::Query::c_LanguageFieldPlaceholder, Database::Query::c_LanguageCodes.at(languageIndex));
+
+        success = insertEntryQuery.exec();
+
+        if (success)
+        {
+            if (c_IsInvalidEntry)
+            {
+                ++m_NrOfInvalidEntries;
+            }
+            else
+            {
+                ++nrOfValidLanguageEntries;
+                ++m_NrOfValidEntries;
+            }
+        }
+
+        if (success && (entryNumber % sc_NrOfEntriesPerTransaction == sc_NrOfEntriesPerTransaction - 1 || entryNumber == m_Settings.nrOfEntriesPerLanguage - 1))
+        {
+            success = db.commit();
+        }
+    }
+
+    if (!success)
+    {
+        db.rollback();
+        m_ErrorMessage = QString{"Cannot write the entries for language %1!"}.arg(Database::Query::c_LanguageCodes.at(languageIndex));
+    }
+
+    return success;
+}
+
+// the first word ends with the entry number (written with letters) so all valid pairs from a language are unique
+DataSource::DataEntry DictionaryGenerator::_generateValidEntry(int entryNumber)
+{
+    const int c_MinFirstWordSize{std::max(Game::Constraints::c_MinWordSize, m_EntryNumberSuffixSize)};
+
+    std::uniform_int_distribution<int> pairSizeDist{std::max(Game::Constraints::c_MinPairSize, c_MinFirstWordSize + Game::Constraints::c_MinWordSize), Game::Constraints::c_MaxPairSize};
+    const int c_PairSize{pairSizeDist(m_Engine)};
+
+    std::uniform_int_distribution<int> firstWordSizeDist{c_MinFirstWordSize, c_PairSize - Game::Constraints::c_MinWordSize};
+    const int c_FirstWordSize{firstWordSizeDist(m_Engine)};
+
+    const QString c_FirstWord{_generateWord(c_FirstWordSize - m_EntryNumberSuffixSize) + _getEntryNumberSuffix(entryNumber, m_EntryNumberSuffixSize)};
+    QString secondWord;
+
+    do
+    {
+        secondWord = _generateWord(c_PairSize - c_FirstWordSize);
+    }
+    while (secondWord == c_FirstWord);
+
+    std::bernoulli_distribution areSynonymsDist{0.5};
+
+    return DataSource::DataEntry{c_FirstWord, secondWord, areSynonymsDist(m_Engine)};
+}
+
+// each invalid entry breaks exactly one of the rules checked by the data source loader
+DataSource::DataEntry DictionaryGenerator::_generateInvalidEntry()
+{
+    std::uniform_int_distribution<int> invalidEntryTypeDist{0, static_cast<int>(InvalidEntryTypes::InvalidEntryTypesCount) - 1};
+    std::bernoulli_distribution areSynonymsDist{0.5};
+
+    const int c_ValidPairSize{(Game::Constraints::c_MinPairSize + Game::Constraints::c_MaxPairSize) / 2};
+
+    QString firstWord;
+    QString secondWord;
+
+    switch (static_cast<InvalidEntryTypes>(invalidEntryTypeDist(m_Engine)))
+    {
+    case InvalidEntryTypes::WORD_TOO_SHORT:
+        firstWord = _generateWord(Game::Constraints::c_MinWordSize - 1);
+        secondWord = _generateWord(c_ValidPairSize - firstWord.size());
+        break;
+    case InvalidEntryTypes::PAIR_TOO_SHORT:
+        firstWord = _generateWord(Game::Constraints::c_MinWordSize);
+        secondWord = _generateWord(Game::Constraints::c_MinWordSize);
+        break;
+    case InvalidEntryTypes::PAIR_TOO_LONG:
+        firstWord = _generateWord(Game::Constraints::c_MaxPairSize / 2 + 1);
+        secondWord = _generateWord(Game::Constraints::c_MaxPairSize - firstWord.size() + 1);
+        break;
+    case InvalidEntryTypes::INVALID_CHARACTER:
+    {
+        firstWord = _generateWord(c_ValidPairSize / 2);
+        secondWord = _generateWord(c_ValidPairSize - firstWord.size());
+
+        // either an uppercase letter or a digit
+        std::uniform_int_distribution<int> positionDist{0, static_cast<int>(firstWord.size()) - 1};
+        std::bernoulli_distribution isDigitDist{0.5};
+
+        const int c_Position{positionDist(m_Engine)};
+        firstWord[c_Position] = isDigitDist(m_Engine) ? QChar{'0' + c_Position % 10} : firstWord.at(c_Position).toUpper();
+    }
+        break;
+    case InvalidEntryTypes::IDENTICAL_WORDS:
+        firstWord = _generateWord(c_ValidPairSize / 2);
+        secondWord = firstWord;
+        break;
+    default:
+        Q_ASSERT(false);
+    }
+
+    return DataSource::DataEntry{firstWord, secondWord, areSynonymsDist(m_Engine)};
+}
+
+QString DictionaryGenerator::_generateWord(int wordSize)
+{
+    std::uniform_int_distribution<int> letterDist{0, 25};
+
+    QString word;
+    word.reserve(wordSize);
+
+    for (int characterNumber{0}; characterNumber < wordSize; ++characterNumber)
+    {
+        word.append(QChar{'a' + letterDist(m_Engine)});
+    }
+
+    return word;
+}
+
+QString DictionaryGenerator::_getEntryNumberSuffix(int entryNumber, int suffixSize)
+{
+    QString suffix;
+    suffix.reserve(suffixSize);
+
+    for (int digitNumber{0}; digitNumber < suffixSize; ++digitNumber)
+    {
+        suffix.append(QChar{'a' + entryNumber % 26});
+        entryNumber /= 26;
+    }
+
+    return suffix;
+}
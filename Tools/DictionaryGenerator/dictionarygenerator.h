@@ -0,0 +1,71 @@
+/*
+   This class generates synthetic game data for load testing:
+   1) Creates a configurable number of word pairs for each requested language; the valid ones respect the constraints enforced by the data source loader (Game::Constraints)
+   2) Mixes in invalid pairs (each one breaking exactly one constraint) according to the requested ratio
+   3) Writes the pairs to a new database file by using the same table schema and insert query as the game
+
+   The output is deterministic: the same settings (including seed) always produce the same database content.
+*/
+
+#ifndef DICTIONARYGENERATOR_H
+#define DICTIONARYGENERATOR_H
+
+#include <QString>
+#include <QVector>
+
+#include <random>
+
+#include "datasource.h"
+
+class DictionaryGenerator
+{
+public:
+    struct Settings
+    {
+        Settings();
+
+        int nrOfEntriesPerLanguage;
+        QVector<int> languageIndexes; // indexes from Database::Query::c_LanguageCodes
+        double invalidEntriesRatio;   // 0.0 (all valid) to 1.0 (all invalid)
+        quint32 seed;
+    };
+
+    explicit DictionaryGenerator(const Settings& settings);
+
+    bool writeToDatabase(const QString& databasePath);
+
+    int getNrOfValidEntries() const;
+    int getNrOfInvalidEntries() const;
+    QString getErrorMessage() const;
+
+private:
+    enum class InvalidEntryTypes
+    {
+        WORD_TOO_SHORT,
+        PAIR_TOO_SHORT,
+        PAIR_TOO_LONG,
+        INVALID_CHARACTER,
+        IDENTICAL_WORDS,
+        InvalidEntryTypesCount
+    };
+
+    bool _writeLanguageEntries(int languageIndex);
+    DataSource::DataEntry _generateValidEntry(int entryNumber);
+    DataSource::DataEntry _generateInvalidEntry();
+    QString _generateWord(int wordSize);
+
+    static QString _getEntryNumberSuffix(int entryNumber, int suffixSize);
+
+    static constexpr int sc_NrOfEntriesPerTransaction{100000};
+
+    Settings m_Settings;
+    int m_EntryNumberSuffixSize; // number of letters required for making each valid first word unique within its language
+    int m_NrOfValidEntries;
+    int m_NrOfInvalidEntries;
+    QString m_ErrorMessage;
+    QString m_ConnectionName;
+
+    std::mt19937 m_Engine;
+};
+
+#endif // DICTIONARYGENERATOR_H
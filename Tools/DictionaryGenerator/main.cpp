@@ -0,0 +1,115 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTextStream>
+#include <QFile>
+
+#include "dictionarygenerator.h"
+#include "databaseutils.h"
+
+/* Command line tool for creating synthetic game databases (load testing fixtures), e.g.:
+   DictionaryGenerator --entries 2000000 --languages EN,DE --invalid-ratio 0.05 --seed 7 --output data.db
+*/
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("DictionaryGenerator");
+
+    QTextStream output{stdout};
+    QTextStream errorOutput{stderr};
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Generates a SynAnt database filled with synthetic word pairs.");
+    parser.addHelpOption();
+
+    const QCommandLineOption c_EntriesOption{QStringList{} << "n" << "entries", "Number of entries generated for each language.", "count", "1000"};
+    const QCommandLineOption c_LanguagesOption{QStringList{} << "l" << "languages", "Comma separated language codes (all game languages by default).", "codes",
+                                               QStringList(Database::Query::c_LanguageCodes.cbegin(), Database::Query::c_LanguageCodes.cend()).join(",")};
+    const QCommandLineOption c_InvalidRatioOption{QStringList{} << "i" << "invalid-ratio", "Ratio of invalid entries, between 0 and 1.", "ratio", "0"};
+    const QCommandLineOption c_SeedOption{QStringList{} << "s" << "seed", "Seed of the random generator (same seed, same content).", "seed", "1"};
+    const QCommandLineOption c_OutputOption{QStringList{} << "o" << "output", "Path of the generated database file.", "path", Database::Query::c_DatabaseName};
+    const QCommandLineOption c_OverwriteOption{"overwrite", "Overwrite the output file if it already exists."};
+
+    parser.addOption(c_EntriesOption);
+    parser.addOption(c_LanguagesOption);
+    parser.addOption(c_InvalidRatioOption);
+    parser.addOption(c_SeedOption);
+    parser.addOption(c_OutputOption);
+    parser.addOption(c_OverwriteOption);
+    parser.process(app);
+
+    DictionaryGenerator::Settings settings;
+    bool isValidNumber{false};
+
+    settings.nrOfEntriesPerLanguage = parser.value(c_EntriesOption).toInt(&isValidNumber);
+
+    if (!isValidNumber || settings.nrOfEntriesPerLanguage <= 0)
+    {
+        errorOutput << "Invalid number of entries: " << parser.value(c_EntriesOption) << Qt::endl;
+        return 1;
+    }
+
+    settings.invalidEntriesRatio = parser.value(c_InvalidRatioOption).toDouble(&isValidNumber);
+
+    if (!isValidNumber || settings.invalidEntriesRatio < 0.0 || settings.invalidEntriesRatio > 1.0)
+    {
+        errorOutput << "Invalid ratio of invalid entries: " << parser.value(c_InvalidRatioOption) << Qt::endl;
+        return 1;
+    }
+
+    settings.seed = parser.value(c_SeedOption).toUInt(&isValidNumber);
+
+    if (!isValidNumber)
+    {
+        errorOutput << "Invalid seed: " << parser.value(c_SeedOption) << Qt::endl;
+        return 1;
+    }
+
+    for (const auto& languageCode : parser.value(c_LanguagesOption).split(",", Qt::SkipEmptyParts))
+    {
+        const int c_LanguageIndex{static_cast<int>(Database::Query::c_LanguageCodes.indexOf(languageCode.trimmed().toUpper()))};
+
+        if (c_LanguageIndex == -1)
+        {
+            errorOutput << "Unknown language code: " << languageCode << Qt::endl;
+            return 1;
+        }
+
+        if (!settings.languageIndexes.contains(c_LanguageIndex))
+        {
+            settings.languageIndexes.append(c_LanguageIndex);
+        }
+    }
+
+    const QString c_DatabasePath{parser.value(c_OutputOption)};
+
+    if (QFile::exists(c_DatabasePath))
+    {
+        if (!parser.isSet(c_OverwriteOption))
+        {
+            errorOutput << "The output file already exists (use --overwrite for replacing it): " << c_DatabasePath << Qt::endl;
+            return 1;
+        }
+
+        if (!QFile::remove(c_DatabasePath))
+        {
+            errorOutput << "Cannot remove the existing output file: " << c_DatabasePath << Qt::endl;
+            return 1;
+        }
+    }
+
+    DictionaryGenerator dictionaryGenerator{settings};
+
+    if (!dictionaryGenerator.writeToDatabase(c_DatabasePath))
+    {
+        errorOutput << dictionaryGenerator.getErrorMessage() << Qt::endl;
+        return 1;
+    }
+
+    output << "Database written: " << c_DatabasePath << Qt::endl;
+    output << "Languages: " << settings.languageIndexes.size() << Qt::endl;
+    output << "Valid entries: " << dictionaryGenerator.getNrOfValidEntries() << Qt::endl;
+    output << "Invalid entries: " << dictionaryGenerator.getNrOfInvalidEntries() << Qt::endl;
+
+    return 0;
+}
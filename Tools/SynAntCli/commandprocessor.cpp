@@ -0,0 +1,705 @@
+#include <QCoreApplication>
+#include <QEventLoop>
+#include <QTimer>
+#include <QElapsedTimer>
+
+#include "commandprocessor.h"
+#include "gamefacade.h"
+#include "dataentryfacade.h"
+#include "databaseutils.h"
+#include "tracer.h"
+#include "gameinitproxy.h"
+
+CommandProcessor::CommandProcessor(GameFacade* pGameFacade, DataEntryFacade* pDataEntryFacade, QTextStream& output, QObject *parent)
+    : QObject(parent)
+    , m_pGameFacade{pGameFacade}
+    , m_pDataEntryFacade{pDataEntryFacade}
+    , m_Output{output}
+    , m_NrOfProcessedCommands{0}
+    , m_NrOfFailedCommands{0}
+{
+    Q_ASSERT(m_pGameFacade);
+    Q_ASSERT(m_pDataEntryFacade);
+
+    m_CommandHandlers.insert("language", &CommandProcessor::_onLanguageCommand);
+    m_CommandHandlers.insert("level", &CommandProcessor::_onLevelCommand);
+    m_CommandHandlers.insert("start", &CommandProcessor::_onStartCommand);
+    m_CommandHandlers.insert("pieces", &CommandProcessor::_onPiecesCommand);
+    m_CommandHandlers.insert("mix", &CommandProcessor::_onMixCommand);
+    m_CommandHandlers.insert("add", &CommandProcessor::_onAddCommand);
+    m_CommandHandlers.insert("remove", &CommandProcessor::_onRemoveCommand);
+    m_CommandHandlers.insert("clear", &CommandProcessor::_onClearCommand);
+    m_CommandHandlers.insert("submit", &CommandProcessor::_onSubmitCommand);
+    m_CommandHandlers.insert("solution", &CommandProcessor::_onSolutionCommand);
+    m_CommandHandlers.insert("autoplay", &CommandProcessor::_onAutoplayCommand);
+    m_CommandHandlers.insert("addpair", &CommandProcessor::_onAddPairCommand);
+    m_CommandHandlers.insert("save", &CommandProcessor::_onSaveCommand);
+    m_CommandHandlers.insert("stats", &CommandProcessor::_onStatsCommand);
+    m_CommandHandlers.insert("trace", &CommandProcessor::_onTraceCommand);
+    m_CommandHandlers.insert("metrics", &CommandProcessor::_onMetricsCommand);
+    m_CommandHandlers.insert("help", &CommandProcessor::_onHelpCommand);
+
+    m_pGameFacade->init();
+}
+
+bool CommandProcessor::processCommand(const QString& commandLine)
+{
+    bool shouldContinue{true};
+    QStringList arguments{commandLine.simplified().split(' ', Qt::SkipEmptyParts)};
+
+    if (!arguments.isEmpty() && !arguments.first().startsWith('#'))
+    {
+        const QString c_Command{arguments.takeFirst().toLower()};
+
+        if (c_Command == "quit")
+        {
+            shouldContinue = false;
+            m_Output << "OK bye" << Qt::endl;
+        }
+        else
+        {
+            QString reply;
+            bool success{false};
+
+            if (m_CommandHandlers.contains(c_Command))
+            {
+                success = (this->*m_CommandHandlers.value(c_Command))(arguments, reply);
+            }
+            else
+            {
+                reply = "unknown command: " + c_Command + " (type help for the list of commands)";
+            }
+
+            if (!success)
+            {
+                ++m_NrOfFailedCommands;
+            }
+
+            m_Output << (success ? "OK" : "ERROR") << (reply.isEmpty() ? "" : " ") << reply << Qt::endl;
+        }
+
+        ++m_NrOfProcessedCommands;
+
+        // deliver the results of the background operations triggered by the command (e.g. the prefetched words pairs)
+        QCoreApplication::processEvents();
+    }
+
+    return shouldContinue;
+}
+
+int CommandProcessor::getNrOfProcessedCommands() const
+{
+    return m_NrOfProcessedCommands;
+}
+
+int CommandProcessor::getNrOfFailedCommands() const
+{
+    return m_NrOfFailedCommands;
+}
+
+bool CommandProcessor::_onLanguageCommand(const QStringList& arguments, QString& reply)
+{
+    bool success{false};
+    const int c_LanguageIndex{arguments.size() == 1 ? static_cast<int>(Database::Query::c_LanguageCodes.indexOf(arguments.first().toUpper())) : -1};
+
+    if (c_LanguageIndex == -1)
+    {
+        reply = "usage: language <" + QStringList(Database::Query::c_LanguageCodes.cbegin(), Database::Query::c_LanguageCodes.cend()).join("|") + ">";
+    }
+    else
+    {
+        m_pGameFacade->setLanguage(c_LanguageIndex, false);
+
+        // the language is usable once the first chunk of entries has been received (the remaining ones are streamed in the background)
+        const bool c_FetchingDone{_waitUntil([this]() {return !m_pGameFacade->isDataFetchingInProgress() ||
+                                                              m_pGameFacade->getStatusCode() == GameFacade::StatusCodes::DATA_FETCHING_ERROR;})};
+
+        if (!c_FetchingDone)
+        {
+            reply = "timeout while fetching data";
+        }
+        else if (m_pGameFacade->getStatusCode() == GameFacade::StatusCodes::DATA_FETCHING_ERROR)
+        {
+            reply = "data fetching error";
+        }
+        else if (!m_pGameFacade->isDataAvailable())
+        {
+            reply = "no valid words pairs available for language " + Database::Query::c_LanguageCodes.at(c_LanguageIndex);
+        }
+        else
+        {
+            success = true;
+            reply = Database::Query::c_LanguageCodes.at(c_LanguageIndex);
+        }
+    }
+
+    return success;
+}
+
+bool CommandProcessor::_onLevelCommand(const QStringList& arguments, QString& reply)
+{
+    bool success{arguments.size() == 1};
+
+    if (success)
+    {
+        const QString c_Level{arguments.first().toLower()};
+
+        if (c_Level == "easy")
+        {
+            m_pGameFacade->setGameLevel(Game::Levels::LEVEL_EASY);
+        }
+        else if (c_Level == "medium")
+        {
+            m_pGameFacade->setGameLevel(Game::Levels::LEVEL_MEDIUM);
+        }
+        else if (c_Level == "hard")
+        {
+            m_pGameFacade->setGameLevel(Game::Levels::LEVEL_HARD);
+        }
+        else
+        {
+            success = false;
+        }
+    }
+
+    if (!success)
+    {
+        reply = "usage: level <easy|medium|hard>";
+    }
+
+    return success;
+}
+
+bool CommandProcessor::_onStartCommand(const QStringList& arguments, QString& reply)
+{
+    Q_UNUSED(arguments);
+
+    const bool c_Success{_checkDataAvailable(reply)};
+
+    if (c_Success)
+    {
+        m_pGameFacade->startGame();
+        reply = _getMixedWordsPieces();
+    }
+
+    return c_Success;
+}
+
+bool CommandProcessor::_onPiecesCommand(const QStringList& arguments, QString& reply)
+{
+    Q_UNUSED(arguments);
+
+    const bool c_Success{_checkDataAvailable(reply)};
+
+    if (c_Success)
+    {
+        reply = _getMixedWordsPieces();
+    }
+
+    return c_Success;
+}
+
+// the current pair is skipped (same as requesting the solution) and replaced by a newly mixed one
+bool CommandProcessor::_onMixCommand(const QStringList& arguments, QString& reply)
+{
+    Q_UNUSED(arguments);
+
+    const bool c_Success{_checkDataAvailable(reply)};
+
+    if (c_Success)
+    {
+        m_pGameFacade->provideCorrectWordsPairToUser();
+        reply = _getMixedWordsPieces();
+    }
+
+    return c_Success;
+}
+
+bool CommandProcessor::_onAddCommand(const QStringList& arguments, QString& reply)
+{
+    bool success{false};
+    int inputWordNumber{0};
+    bool isValidIndex{false};
+    const int c_PieceIndex{arguments.size() == 2 ? arguments.at(1).toInt(&isValidIndex) : -1};
+
+    if (!_parseInputWordNumber(arguments.value(0), inputWordNumber) || !isValidIndex)
+    {
+        reply = "usage: add <1|2> <piece index>";
+    }
+    else if (_checkDataAvailable(reply))
+    {
+        if (c_PieceIndex < 0 || c_PieceIndex >= m_pGameFacade->getMixedWordsPiecesContent().size())
+        {
+            reply = "piece index out of range";
+        }
+        else if (m_pGameFacade->getAreMixedWordsPiecesSelected().at(c_PieceIndex))
+        {
+            reply = "piece already added to input";
+        }
+        else
+        {
+            m_pGameFacade->addPieceToInputWord(inputWordNumber == 1 ? Game::InputWordNumber::ONE : Game::InputWordNumber::TWO, c_PieceIndex);
+
+            const GameFacade::StatusCodes c_StatusCode{m_pGameFacade->getStatusCode()};
+
+            success = c_StatusCode == GameFacade::StatusCodes::PIECE_ADDED_COMPLETE_INPUT || c_StatusCode == GameFacade::StatusCodes::PIECE_ADDED_INCOMPLETE_INPUT;
+            reply = success ? (m_pGameFacade->isInputComplete() ? "input complete" : "input incomplete") : "piece cannot be added at this position";
+        }
+    }
+
+    return success;
+}
+
+bool CommandProcessor::_onRemoveCommand(const QStringList& arguments, QString& reply)
+{
+    bool success{false};
+    int inputWordNumber{0};
+    bool isValidIndex{false};
+    const int c_InputRangeStart{arguments.size() == 2 ? arguments.at(1).toInt(&isValidIndex) : -1};
+
+    if (!_parseInputWordNumber(arguments.value(0), inputWordNumber) || !isValidIndex)
+    {
+        reply = "usage: remove <1|2> <input range start>";
+    }
+    else if (_checkDataAvailable(reply))
+    {
+        const Game::InputWordNumber c_InputWordNumber{inputWordNumber == 1 ? Game::InputWordNumber::ONE : Game::InputWordNumber::TWO};
+        const int c_InputWordSize{static_cast<int>(inputWordNumber == 1 ? m_pGameFacade->getFirstWordInputIndexes().size()
+                                                                        : m_pGameFacade->getSecondWordInputIndexes().size())};
+
+        // the input builder does not check the range so it should be done here
+        success = c_InputRangeStart >= 0 && c_InputRangeStart < c_InputWordSize;
+
+        if (success)
+        {
+            m_pGameFacade->removePiecesFromInputWord(c_InputWordNumber, c_InputRangeStart);
+        }
+        else
+        {
+            reply = "input range start out of range";
+        }
+    }
+
+    return success;
+}
+
+bool CommandProcessor::_onClearCommand(const QStringList& arguments, QString& reply)
+{
+    Q_UNUSED(arguments);
+
+    const bool c_Success{_checkDataAvailable(reply)};
+
+    if (c_Success)
+    {
+        m_pGameFacade->clearInput();
+    }
+
+    return c_Success;
+}
+
+bool CommandProcessor::_onSubmitCommand(const QStringList& arguments, QString& reply)
+{
+    Q_UNUSED(arguments);
+
+    const bool c_Success{_checkDataAvailable(reply)};
+
+    if (c_Success)
+    {
+        if (!m_pGameFacade->isInputComplete())
+        {
+            reply = "incomplete";
+        }
+        else
+        {
+            m_pGameFacade->handleSubmitRequest();
+            reply = m_pGameFacade->getStatusCode() == GameFacade::StatusCodes::CORRECT_USER_INPUT ? "correct" : "incorrect";
+        }
+    }
+
+    return c_Success;
+}
+
+bool CommandProcessor::_onSolutionCommand(const QStringList& arguments, QString& reply)
+{
+    Q_UNUSED(arguments);
+
+    const bool c_Success{_checkDataAvailable(reply)};
+
+    if (c_Success)
+    {
+        reply = QString{"%1 %2 %3"}.arg(m_pGameFacade->getFirstReferenceWord(),
+                                        m_pGameFacade->getSecondReferenceWord(),
+                                        m_pGameFacade->areWordsFromCurrentPairSynonyms() ? "syn" : "ant");
+    }
+
+    return c_Success;
+}
+
+bool CommandProcessor::_onAutoplayCommand(const QStringList& arguments, QString& reply)
+{
+    bool success{false};
+    bool isValidNumber{false};
+    const int c_NrOfPairs{arguments.size() == 1 ? arguments.first().toInt(&isValidNumber) : 0};
+
+    if (!isValidNumber || c_NrOfPairs <= 0)
+    {
+        reply = "usage: autoplay <number of pairs>";
+    }
+    else if (_checkDataAvailable(reply))
+    {
+        QElapsedTimer elapsedTimer;
+        elapsedTimer.start();
+
+        int nrOfSolvedPairs{0};
+
+        while (nrOfSolvedPairs < c_NrOfPairs && _solveCurrentWordsPair())
+        {
+            ++nrOfSolvedPairs;
+
+            // same as when playing interactively: the prefetched pairs are received between two submits
+            QCoreApplication::processEvents();
+        }
+
+        const qint64 c_ElapsedTime{elapsedTimer.elapsed()};
+
+        success = nrOfSolvedPairs == c_NrOfPairs;
+        reply = QString{"solved %1 pairs in %2 ms (%3 pairs/s)"}.arg(nrOfSolvedPairs)
+                                                                  .arg(c_ElapsedTime)
+                                                                  .arg(c_ElapsedTime > 0 ? 1000.0 * nrOfSolvedPairs / c_ElapsedTime : 0.0, 0, 'f', 1);
+    }
+
+    return success;
+}
+
+// the pair is added to the current game language
+bool CommandProcessor::_onAddPairCommand(const QStringList& arguments, QString& reply)
+{
+    bool success{false};
+    const QString c_PairType{arguments.value(2).toLower()};
+    const int c_LanguageIndex{m_pGameFacade->getCurrentLanguageIndex()};
+
+    if (arguments.size() != 3 || (c_PairType != "syn" && c_PairType != "ant"))
+    {
+        reply = "usage: addpair <first word> <second word> <syn|ant>";
+    }
+    else if (c_LanguageIndex == -1)
+    {
+        reply = "no language selected";
+    }
+    else
+    {
+        m_pDataEntryFacade->setLanguage(c_LanguageIndex);
+
+        const bool c_DataEntryReady{_waitUntil([this]() {return (m_pDataEntryFacade->isDataEntryAllowed() && !m_pDataEntryFacade->isDataFetchingInProgress()) ||
+                                                                m_pGameFacade->getStatusCode() == GameFacade::StatusCodes::DATA_FETCHING_ERROR;})};
+
+        if (!c_DataEntryReady || !m_pDataEntryFacade->isDataEntryAllowed() || m_pDataEntryFacade->isDataFetchingInProgress())
+        {
+            reply = "data entry not available";
+        }
+        else if (!m_pDataEntryFacade->isAddingToCacheAllowed())
+        {
+            reply = "adding pairs not allowed while saving";
+        }
+        else
+        {
+            m_pDataEntryFacade->requestAddPairToCache(arguments.at(0), arguments.at(1), c_PairType == "syn");
+
+            if (!_waitUntil([this]() {return m_pDataEntryFacade->isAddingToCacheAllowed();}))
+            {
+                reply = "timeout while adding pair";
+            }
+            else
+            {
+                success = m_pDataEntryFacade->getStatusCode() == DataEntryFacade::StatusCodes::DATA_ENTRY_ADD_SUCCESS;
+                reply = success ? QString{"%1 pairs added, not saved yet"}.arg(m_pDataEntryFacade->getCurrentNrOfAddedPairs()) : _getAddPairFailureReason();
+            }
+        }
+    }
+
+    return success;
+}
+
+bool CommandProcessor::_onSaveCommand(const QStringList& arguments, QString& reply)
+{
+    Q_UNUSED(arguments);
+
+    bool success{false};
+
+    if (!m_pDataEntryFacade->isSavingToDbAllowed())
+    {
+        reply = "no added pairs to save";
+    }
+    else
+    {
+        m_pDataEntryFacade->requestSaveDataToDb();
+
+        const bool c_SavingDone{_waitUntil([this]() {return m_pDataEntryFacade->getStatusCode() == DataEntryFacade::StatusCodes::DATA_SUCCESSFULLY_SAVED ||
+                                                            m_pDataEntryFacade->getStatusCode() == DataEntryFacade::StatusCodes::DATA_SAVING_ERROR;})};
+
+        success = c_SavingDone && m_pDataEntryFacade->getStatusCode() == DataEntryFacade::StatusCodes::DATA_SUCCESSFULLY_SAVED;
+
+        if (success)
+        {
+            reply = QString{"%1 pairs saved"}.arg(m_pDataEntryFacade->getLastSavedTotalNrOfPairs());
+        }
+        else if (c_SavingDone)
+        {
+            QStringList failedPairs;
+
+            for (const auto& failedEntry : m_pDataEntryFacade->getFailedSaveEntries())
+            {
+                failedPairs.append(failedEntry.firstWord + "/" + failedEntry.secondWord);
+            }
+
+            reply = failedPairs.isEmpty() ? "saving error" : "saving error, pairs not saved: " + failedPairs.join(" ");
+        }
+        else
+        {
+            reply = "timeout while saving";
+        }
+    }
+
+    return success;
+}
+
+bool CommandProcessor::_onStatsCommand(const QStringList& arguments, QString& reply)
+{
+    Q_UNUSED(arguments);
+
+    reply = QString{"score %1/%2 pairs %3/%4"}.arg(m_pGameFacade->getObtainedScore(),
+                                                   m_pGameFacade->getTotalAvailableScore(),
+                                                   m_pGameFacade->getGuessedWordPairs(),
+                                                   m_pGameFacade->getTotalWordPairs());
+
+    return true;
+}
+
+bool CommandProcessor::_onTraceCommand(const QStringList& arguments, QString& reply)
+{
+    bool success{arguments.size() == 1};
+
+    if (!success)
+    {
+        reply = "usage: trace <file path>";
+    }
+    else if (!Tracer::isTracingEnabled())
+    {
+        success = false;
+        reply = "tracing not available (build with -DENABLE_TRACING=ON)";
+    }
+    else
+    {
+        success = Tracer::getTracer()->writeChromeTrace(arguments.at(0));
+        reply = success ? "trace written to " + arguments.at(0) : "cannot write trace to " + arguments.at(0);
+    }
+
+    return success;
+}
+
+bool CommandProcessor::_onMetricsCommand(const QStringList& arguments, QString& reply)
+{
+    bool success{arguments.size() == 1};
+
+    if (!success)
+    {
+        reply = "usage: metrics <file path>";
+    }
+    else
+    {
+        success = GameInitProxy{}.getMetricsSnapshot().writePrometheusText(arguments.at(0));
+        reply = success ? "metrics written to " + arguments.at(0) : "cannot write metrics to " + arguments.at(0);
+    }
+
+    return success;
+}
+
+bool CommandProcessor::_onHelpCommand(const QStringList& arguments, QString& reply)
+{
+    Q_UNUSED(arguments);
+
+    reply = "commands: language <code>, level <easy|medium|hard>, start, pieces, mix, add <1|2> <piece index>, remove <1|2> <input range start>, clear, "
+            "submit, solution, autoplay <number of pairs>, addpair <first word> <second word> <syn|ant>, save, stats, trace <file path>, metrics <file path>, help, quit";
+
+    return true;
+}
+
+bool CommandProcessor::_checkDataAvailable(QString& reply) const
+{
+    const bool c_IsDataAvailable{m_pGameFacade->isDataAvailable()};
+
+    if (!c_IsDataAvailable)
+    {
+        reply = "no words pair available (select a language with valid pairs first)";
+    }
+
+    return c_IsDataAvailable;
+}
+
+bool CommandProcessor::_parseInputWordNumber(const QString& argument, int& inputWordNumber) const
+{
+    inputWordNumber = argument == "1" ? 1 : argument == "2" ? 2 : 0;
+
+    return inputWordNumber != 0;
+}
+
+// the pieces are added in the same way as a user would do it (through the facade) so the measured throughput is end-to-end
+bool CommandProcessor::_solveCurrentWordsPair()
+{
+    QVector<bool> usedPieces(m_pGameFacade->getMixedWordsPiecesContent().size(), false);
+    QVector<int> firstWordPieceIndexes;
+    QVector<int> secondWordPieceIndexes;
+
+    bool success{_findWordPieces(m_pGameFacade->getFirstReferenceWord(), 0, usedPieces, firstWordPieceIndexes) &&
+                 _findWordPieces(m_pGameFacade->getSecondReferenceWord(), 0, usedPieces, secondWordPieceIndexes)};
+
+    if (success)
+    {
+        m_pGameFacade->clearInput();
+
+        for (auto pieceIndex : firstWordPieceIndexes)
+        {
+            m_pGameFacade->addPieceToInputWord(Game::InputWordNumber::ONE, pieceIndex);
+        }
+
+        for (auto pieceIndex : secondWordPieceIndexes)
+        {
+            m_pGameFacade->addPieceToInputWord(Game::InputWordNumber::TWO, pieceIndex);
+        }
+
+        m_pGameFacade->handleSubmitRequest();
+        success = m_pGameFacade->getStatusCode() == GameFacade::StatusCodes::CORRECT_USER_INPUT;
+    }
+
+    return success;
+}
+
+/* Backtracking is required as different pieces might match the same word position (e.g. "ab" and "abc"):
+   - the first piece of the word should be a begin piece, the last one an end piece and all others middle pieces
+   - pieces with identical content and type are interchangeable so the first match is used
+*/
+bool CommandProcessor::_findWordPieces(const QString& word, int wordPosition, QVector<bool>& usedPieces, QVector<int>& pieceIndexes) const
+{
+    const QVector<QString>& c_PiecesContent{m_pGameFacade->getMixedWordsPiecesContent()};
+    const QVector<Game::PieceTypes>& c_PiecesTypes{m_pGameFacade->getMixedWordsPiecesTypes()};
+
+    bool found{wordPosition == word.size()};
+
+    for (int pieceIndex{0}; !found && pieceIndex < c_PiecesContent.size(); ++pieceIndex)
+    {
+        const QString& c_PieceContent{c_PiecesContent.at(pieceIndex)};
+        const int c_NextWordPosition{wordPosition + static_cast<int>(c_PieceContent.size())};
+        const Game::PieceTypes c_RequiredPieceType{wordPosition == 0 ? Game::PieceTypes::BEGIN_PIECE
+                                                                     : c_NextWordPosition == word.size() ? Game::PieceTypes::END_PIECE
+                                                                                                         : Game::PieceTypes::MIDDLE_PIECE};
+
+        if (!usedPieces.at(pieceIndex) && c_PiecesTypes.at(pieceIndex) == c_RequiredPieceType && c_NextWordPosition <= word.size() &&
+            word.mid(wordPosition, c_PieceContent.size()) == c_PieceContent)
+        {
+            usedPieces[pieceIndex] = true;
+            pieceIndexes.append(pieceIndex);
+
+            found = _findWordPieces(word, c_NextWordPosition, usedPieces, pieceIndexes);
+
+            if (!found)
+            {
+                usedPieces[pieceIndex] = false;
+                pieceIndexes.removeLast();
+            }
+        }
+    }
+
+    return found;
+}
+
+// runs a local event loop (queued signals from the backend threads get delivered) until the condition is fulfilled or the request times out
+bool CommandProcessor::_waitUntil(const std::function<bool()>& isDone)
+{
+    if (!isDone())
+    {
+        QEventLoop eventLoop;
+        QTimer timeoutTimer;
+
+        auto checkIsDone = [&eventLoop, &isDone]()
+        {
+            if (isDone())
+            {
+                eventLoop.quit();
+            }
+        };
+
+        auto connected{connect(m_pGameFacade, &GameFacade::statusChanged, &eventLoop, checkIsDone)};
+        Q_ASSERT(connected);
+        connected = connect(m_pGameFacade, &GameFacade::fetchingInProgressChanged, &eventLoop, checkIsDone);
+        Q_ASSERT(connected);
+        connected = connect(m_pDataEntryFacade, &DataEntryFacade::statusChanged, &eventLoop, checkIsDone);
+        Q_ASSERT(connected);
+        connected = connect(m_pDataEntryFacade, &DataEntryFacade::dataEntryAllowedChanged, &eventLoop, checkIsDone);
+        Q_ASSERT(connected);
+        connected = connect(m_pDataEntryFacade, &DataEntryFacade::addPairToCacheAllowedChanged, &eventLoop, checkIsDone);
+        Q_ASSERT(connected);
+        connected = connect(&timeoutTimer, &QTimer::timeout, &eventLoop, &QEventLoop::quit);
+        Q_ASSERT(connected);
+
+        timeoutTimer.setSingleShot(true);
+        timeoutTimer.start(sc_RequestTimeout);
+        eventLoop.exec();
+    }
+
+    return isDone();
+}
+
+// format: <content>:<B|M|E> for each piece, followed by a * if the piece has been added to input
+QString CommandProcessor::_getMixedWordsPieces() const
+{
+    const QVector<QString>& c_PiecesContent{m_pGameFacade->getMixedWordsPiecesContent()};
+    const QVector<Game::PieceTypes>& c_PiecesTypes{m_pGameFacade->getMixedWordsPiecesTypes()};
+    const QVector<bool>& c_ArePiecesSelected{m_pGameFacade->getAreMixedWordsPiecesSelected()};
+
+    QStringList pieces;
+
+    for (int pieceIndex{0}; pieceIndex < c_PiecesContent.size(); ++pieceIndex)
+    {
+        const Game::PieceTypes c_PieceType{c_PiecesTypes.at(pieceIndex)};
+
+        pieces.append(QString{"%1:%2%3"}.arg(c_PiecesContent.at(pieceIndex),
+                                             c_PieceType == Game::PieceTypes::BEGIN_PIECE ? "B" : c_PieceType == Game::PieceTypes::END_PIECE ? "E" : "M",
+                                             c_ArePiecesSelected.at(pieceIndex) ? "*" : ""));
+    }
+
+    return pieces.join(' ');
+}
+
+QString CommandProcessor::_getAddPairFailureReason() const
+{
+    QString reason;
+
+    switch (m_pDataEntryFacade->getStatusCode())
+    {
+    case DataEntryFacade::StatusCodes::ADD_FAILED_LESS_MIN_CHARS_PER_WORD:
+        reason = "words too short";
+        break;
+    case DataEntryFacade::StatusCodes::ADD_FAILED_LESS_MIN_TOTAL_PAIR_CHARS:
+        reason = "pair too short";
+        break;
+    case DataEntryFacade::StatusCodes::ADD_FAILED_MORE_MAX_TOTAL_PAIR_CHARS:
+        reason = "pair too long";
+        break;
+    case DataEntryFacade::StatusCodes::ADD_FAILED_INVALID_CHARACTERS:
+        reason = "invalid characters";
+        break;
+    case DataEntryFacade::StatusCodes::ADD_FAILED_PAIR_ALREADY_EXISTS_IN_DATABASE:
+        reason = "pair already exists in database";
+        break;
+    case DataEntryFacade::StatusCodes::ADD_FAILED_IDENTICAL_WORDS:
+        reason = "identical words";
+        break;
+    case DataEntryFacade::StatusCodes::PAIR_ALREADY_ADDED_SAVE_OR_DISCARD:
+        reason = "pair already added";
+        break;
+    default:
+        reason = "pair not added";
+    }
+
+    return reason;
+}
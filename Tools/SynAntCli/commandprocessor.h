@@ -0,0 +1,73 @@
+/*
+   This class drives the game backend through a line-oriented text protocol (no GUI required):
+   1) Parses the commands (one per line) and forwards them to the game facade (language, level, input, submit) and to the data entry facade (add pairs, save)
+   2) Waits for the asynchronous backend operations (language fetching, adding pairs to cache, saving) to complete before replying
+   3) Replies to each command with exactly one line starting with OK or ERROR so scripts can check every result
+   4) Solves pairs automatically (autoplay) for measuring the end-to-end throughput of the backend
+*/
+
+#ifndef COMMANDPROCESSOR_H
+#define COMMANDPROCESSOR_H
+
+#include <QObject>
+#include <QHash>
+#include <QStringList>
+#include <QTextStream>
+
+#include <functional>
+
+class GameFacade;
+class DataEntryFacade;
+
+class CommandProcessor : public QObject
+{
+    Q_OBJECT
+public:
+    explicit CommandProcessor(GameFacade* pGameFacade, DataEntryFacade* pDataEntryFacade, QTextStream& output, QObject *parent = nullptr);
+
+    // returns false once the quit command has been received, empty lines and comments (starting with #) are ignored
+    bool processCommand(const QString& commandLine);
+
+    int getNrOfProcessedCommands() const;
+    int getNrOfFailedCommands() const;
+
+private:
+    using CommandHandler = bool (CommandProcessor::*)(const QStringList& arguments, QString& reply);
+
+    bool _onLanguageCommand(const QStringList& arguments, QString& reply);
+    bool _onLevelCommand(const QStringList& arguments, QString& reply);
+    bool _onStartCommand(const QStringList& arguments, QString& reply);
+    bool _onPiecesCommand(const QStringList& arguments, QString& reply);
+    bool _onMixCommand(const QStringList& arguments, QString& reply);
+    bool _onAddCommand(const QStringList& arguments, QString& reply);
+    bool _onRemoveCommand(const QStringList& arguments, QString& reply);
+    bool _onClearCommand(const QStringList& arguments, QString& reply);
+    bool _onSubmitCommand(const QStringList& arguments, QString& reply);
+    bool _onSolutionCommand(const QStringList& arguments, QString& reply);
+    bool _onAutoplayCommand(const QStringList& arguments, QString& reply);
+    bool _onAddPairCommand(const QStringList& arguments, QString& reply);
+    bool _onSaveCommand(const QStringList& arguments, QString& reply);
+    bool _onStatsCommand(const QStringList& arguments, QString& reply);
+    bool _onTraceCommand(const QStringList& arguments, QString& reply);
+    bool _onMetricsCommand(const QStringList& arguments, QString& reply);
+    bool _onHelpCommand(const QStringList& arguments, QString& reply);
+
+    bool _checkDataAvailable(QString& reply) const;
+    bool _parseInputWordNumber(const QString& argument, int& inputWordNumber) const;
+    bool _solveCurrentWordsPair();
+    bool _findWordPieces(const QString& word, int wordPosition, QVector<bool>& usedPieces, QVector<int>& pieceIndexes) const;
+    bool _waitUntil(const std::function<bool()>& isDone);
+    QString _getMixedWordsPieces() const;
+    QString _getAddPairFailureReason() const;
+
+    static constexpr int sc_RequestTimeout{60000}; // ms
+
+    GameFacade* m_pGameFacade;
+    DataEntryFacade* m_pDataEntryFacade;
+    QTextStream& m_Output;
+    QHash<QString, CommandHandler> m_CommandHandlers;
+    int m_NrOfProcessedCommands;
+    int m_NrOfFailedCommands;
+};
+
+#endif // COMMANDPROCESSOR_H
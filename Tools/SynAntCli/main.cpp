@@ -0,0 +1,159 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTextStream>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QDir>
+
+#include "commandprocessor.h"
+#include "sessionreplayer.h"
+#include "gamefacade.h"
+#include "exceptions.h"
+#include "gameinitproxy.h"
+#include "gameproxy.h"
+#include "dataproxy.h"
+#include "metricsregistry.h"
+
+/* Headless front end of the game (no GUI required), one command per line is read from stdin (or from a script file) and one reply line is written to stdout, e.g.:
+   printf "language EN\nlevel hard\nautoplay 10000\nstats\nquit\n" | synant-cli --data-dir /path/to/data/dir
+   Run synant-cli --help for the options and enter help for the list of commands.
+   A session can be recorded (--record) and replayed later on identical workload (--replay), e.g. for comparing backend changes.
+   The runtime metrics (counters, latency percentiles) can be written in Prometheus text format when exiting (--metrics) or at any time by using the metrics command.
+*/
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("synant-cli");
+
+    QTextStream output{stdout};
+    QTextStream errorOutput{stderr};
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Plays SynAnt by using a line-oriented command protocol on stdin/stdout.");
+    parser.addHelpOption();
+
+    const QCommandLineOption c_DataDirOption{QStringList{} << "d" << "data-dir", "Directory containing the game database (created if missing).", "path", app.applicationDirPath()};
+    const QCommandLineOption c_ScriptOption{QStringList{} << "s" << "script", "Read the commands from this file instead of stdin.", "path"};
+    const QCommandLineOption c_RecordOption{QStringList{} << "r" << "record", "Record the session into this log file.", "path"};
+    const QCommandLineOption c_ReplayOption{QStringList{} << "p" << "replay", "Replay the session recorded in this log file (no commands are read).", "path"};
+    const QCommandLineOption c_WalOption{QStringList{} << "w" << "wal", "Use write-ahead logging for the database (otherwise its journal mode is kept)."};
+    const QCommandLineOption c_MetricsOption{QStringList{} << "m" << "metrics", "Write the runtime metrics (Prometheus text format) into this file when exiting.", "path"};
+
+    parser.addOption(c_DataDirOption);
+    parser.addOption(c_ScriptOption);
+    parser.addOption(c_RecordOption);
+    parser.addOption(c_ReplayOption);
+    parser.addOption(c_WalOption);
+    parser.addOption(c_MetricsOption);
+    parser.process(app);
+
+    if (parser.isSet(c_RecordOption) && parser.isSet(c_ReplayOption))
+    {
+        errorOutput << "A session cannot be recorded and replayed at the same time" << Qt::endl;
+        return 1;
+    }
+
+    const QString c_DataDirPath{parser.value(c_DataDirOption)};
+
+    if (!QDir{c_DataDirPath}.exists())
+    {
+        errorOutput << "The data directory does not exist: " << c_DataDirPath << Qt::endl;
+        return 1;
+    }
+
+    QFile scriptFile;
+    QTextStream input{stdin};
+
+    if (parser.isSet(c_ScriptOption))
+    {
+        scriptFile.setFileName(parser.value(c_ScriptOption));
+
+        if (!scriptFile.open(QIODevice::ReadOnly | QIODevice::Text))
+        {
+            errorOutput << "Cannot open the script file: " << scriptFile.fileName() << Qt::endl;
+            return 1;
+        }
+
+        input.setDevice(&scriptFile);
+    }
+
+    try
+    {
+        GameInitProxy gameInitProxy;
+        GameProxy gameProxy;
+        DataProxy dataProxy;
+
+        if (parser.isSet(c_WalOption))
+        {
+            gameInitProxy.enableWriteAheadLogging();
+        }
+
+        gameInitProxy.setEnvironment(c_DataDirPath);
+
+        // written before releasing the resources so the data source gauges are still available
+        auto writeMetrics = [&parser, &c_MetricsOption, &gameInitProxy, &errorOutput]()
+        {
+            if (parser.isSet(c_MetricsOption) && !gameInitProxy.getMetricsSnapshot().writePrometheusText(parser.value(c_MetricsOption)))
+            {
+                errorOutput << "Cannot write the metrics into: " << parser.value(c_MetricsOption) << Qt::endl;
+            }
+        };
+
+        if (parser.isSet(c_ReplayOption))
+        {
+            SessionReplayer sessionReplayer{gameProxy.getGameFacade()};
+
+            const bool c_Success{sessionReplayer.replay(parser.value(c_ReplayOption))};
+
+            errorOutput << "Replayed calls: " << sessionReplayer.getNrOfReplayedCalls()
+                        << ", divergent submits: " << sessionReplayer.getNrOfDivergentSubmits()
+                        << ", recorded: " << sessionReplayer.getRecordedDuration() << " ms"
+                        << ", replayed: " << sessionReplayer.getReplayDuration() << " ms" << Qt::endl;
+
+            if (!c_Success)
+            {
+                errorOutput << "Replay failed: " << sessionReplayer.getErrorMessage() << Qt::endl;
+            }
+
+            writeMetrics();
+            gameProxy.releaseResources();
+
+            return c_Success && sessionReplayer.getNrOfDivergentSubmits() == 0 ? 0 : 1;
+        }
+
+        // should be started before the facade gets initialized by the command processor so the init call is recorded too
+        if (parser.isSet(c_RecordOption) && !gameProxy.getGameFacade()->startRecording(parser.value(c_RecordOption)))
+        {
+            errorOutput << "Cannot record the session into: " << parser.value(c_RecordOption) << Qt::endl;
+            gameProxy.releaseResources();
+            return 1;
+        }
+
+        CommandProcessor commandProcessor{gameProxy.getGameFacade(), dataProxy.getDataEntryFacade(), output};
+
+        QElapsedTimer elapsedTimer;
+        elapsedTimer.start();
+
+        QString commandLine;
+
+        while (input.readLineInto(&commandLine) && commandProcessor.processCommand(commandLine))
+        {
+        }
+
+        // the summary goes to stderr so the replies can be parsed without filtering
+        errorOutput << "Commands: " << commandProcessor.getNrOfProcessedCommands()
+                    << ", failed: " << commandProcessor.getNrOfFailedCommands()
+                    << ", elapsed: " << elapsedTimer.elapsed() << " ms" << Qt::endl;
+
+        writeMetrics();
+        gameProxy.releaseResources();
+    }
+    catch (const GameException& exception)
+    {
+        errorOutput << exception.getDescription() << Qt::endl;
+        return 1;
+    }
+
+    return 0;
+}
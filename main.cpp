@@ -1,9 +1,15 @@
 #include <QGuiApplication>
 #include <QQmlApplicationEngine>
 #include <QQmlComponent>
+#include <QCommandLineParser>
+#include <QTimer>
 
 #include "exceptions.h"
 #include "gameinitproxy.h"
+#include "gameproxy.h"
+#include "gamefacade.h"
+#include "tracer.h"
+#include "metricsregistry.h"
 
 extern void registerDataTypesForQML();
 
@@ -20,7 +26,56 @@ int main(int argc, char* argv[])
     {
         GameInitProxy gameInitProxy;
 
+        /* optional:
+           --wal enables write-ahead logging for the database (otherwise its journal mode is kept)
+           --record <file> records the game session so it can be replayed later (see synant-cli --replay)
+           --trace <file> writes the trace events to file when quitting (only if built with -DENABLE_TRACING=ON)
+           --metrics <file> periodically writes the runtime metrics to file in Prometheus text format (--metrics-interval <seconds>, default 15)
+        */
+        QCommandLineParser parser;
+        const QCommandLineOption c_WalOption{"wal", "Use write-ahead logging for the database."};
+        const QCommandLineOption c_RecordOption{"record", "Record the game session into this log file.", "path"};
+        const QCommandLineOption c_TraceOption{"trace", "Write the trace events into this file when quitting.", "path"};
+        const QCommandLineOption c_MetricsOption{"metrics", "Periodically write the runtime metrics into this file.", "path"};
+        const int c_DefaultMetricsInterval{15};
+        const QCommandLineOption c_MetricsIntervalOption{"metrics-interval", "Interval between metrics writes.", "seconds", QString::number(c_DefaultMetricsInterval)};
+
+        parser.addOption(c_WalOption);
+        parser.addOption(c_RecordOption);
+        parser.addOption(c_TraceOption);
+        parser.addOption(c_MetricsOption);
+        parser.addOption(c_MetricsIntervalOption);
+
+        const bool c_ArgumentsParsed{parser.parse(app.arguments())};
+
+        if (c_ArgumentsParsed && parser.isSet(c_WalOption))
+        {
+            gameInitProxy.enableWriteAheadLogging();
+        }
+
         gameInitProxy.setEnvironment(app.applicationDirPath());
+
+        if (c_ArgumentsParsed && parser.isSet(c_RecordOption) && !GameProxy{}.getGameFacade()->startRecording(parser.value(c_RecordOption)))
+        {
+            qWarning("Cannot record the game session to %s", qPrintable(parser.value(c_RecordOption)));
+        }
+
+        const bool c_ShouldWriteMetrics{c_ArgumentsParsed && parser.isSet(c_MetricsOption)};
+        QTimer metricsTimer;
+
+        if (c_ShouldWriteMetrics)
+        {
+            bool isIntervalValid{false};
+            const int c_MetricsInterval{parser.value(c_MetricsIntervalOption).toInt(&isIntervalValid)};
+
+            // the file is replaced atomically so a collector can read it at any time
+            QObject::connect(&metricsTimer, &QTimer::timeout, [&gameInitProxy, &parser, &c_MetricsOption]() {
+                Q_UNUSED(gameInitProxy.getMetricsSnapshot().writePrometheusText(parser.value(c_MetricsOption)));
+            });
+
+            metricsTimer.start((isIntervalValid && c_MetricsInterval > 0 ? c_MetricsInterval : c_DefaultMetricsInterval) * 1000);
+        }
+
         engine.load(QUrl(QLatin1String("qrc:/Application/main.qml")));
 
         if (engine.rootObjects().isEmpty())
@@ -28,7 +83,19 @@ int main(int argc, char* argv[])
             return -1;
         }
 
-        return app.exec();
+        const int c_ExitCode{app.exec()};
+
+        if (c_ArgumentsParsed && parser.isSet(c_TraceOption) && !Tracer::getTracer()->writeChromeTrace(parser.value(c_TraceOption)))
+        {
+            qWarning("Cannot write the trace events to %s", qPrintable(parser.value(c_TraceOption)));
+        }
+
+        if (c_ShouldWriteMetrics && !gameInitProxy.getMetricsSnapshot().writePrometheusText(parser.value(c_MetricsOption)))
+        {
+            qWarning("Cannot write the metrics to %s", qPrintable(parser.value(c_MetricsOption)));
+        }
+
+        return c_ExitCode;
     }
     catch (const GameException& exception)
     {